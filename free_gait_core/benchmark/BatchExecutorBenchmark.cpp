@@ -0,0 +1,182 @@
+/*
+ * BatchExecutorBenchmark.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#include "Benchmark.hpp"
+#include "BenchmarkFixtures.hpp"
+#include "AdapterDummy.hpp"
+#include "free_gait_core/executor/BatchExecutor.hpp"
+#include "free_gait_core/executor/CandidateEvaluator.hpp"
+#include "free_gait_core/executor/Executor.hpp"
+#include "free_gait_core/executor/StateBatchComputer.hpp"
+
+// STD
+#include <thread>
+
+using namespace free_gait;
+
+namespace {
+
+const size_t nSteps = 8;
+
+/*!
+ * Processes the walking steps with a batch executor and waits for the result.
+ * @return true if successful, false otherwise.
+ */
+bool processSteps(AdapterDummy& adapter, BatchExecutor& batchExecutor, const State& startState,
+                  const std::vector<Step>& steps)
+{
+  adapter.setInternalDataFromState(startState);
+  if (!batchExecutor.process(steps)) return false;
+  while (batchExecutor.isProcessing()) std::this_thread::yield();
+  return !batchExecutor.getStateBatch().empty();
+}
+
+void benchmarkBatchExecutor(Benchmark& benchmark, const size_t nThreads, const bool isAdaptiveTimeStep = false)
+{
+  AdapterDummy adapter;
+  const State startState = createStandingState(adapter);
+  adapter.setInternalDataFromState(startState);
+  const std::vector<Step> steps = createWalkingSteps(adapter, getStance(adapter, startState), nSteps);
+
+  State state;
+  StepParameters parameters;
+  StepCompleter completer(parameters, adapter);
+  StepComputer computer;
+  Executor executor(completer, computer, adapter, state);
+  if (!executor.initialize()) return benchmark.skipWithError("Could not initialize executor.");
+  BatchExecutor batchExecutor(executor);
+  batchExecutor.addProcessingCallback([](bool) {});
+  batchExecutor.setNumberOfThreads(nThreads);
+  batchExecutor.setAdaptiveTimeStep(isAdaptiveTimeStep);
+
+  while (benchmark.keepRunning()) {
+    if (!processSteps(adapter, batchExecutor, startState, steps)) {
+      return benchmark.skipWithError("Could not process steps.");
+    }
+  }
+}
+
+/*!
+ * Benchmarks a pass of the state batch computer on the batch of the walking steps.
+ */
+void benchmarkStateBatchComputer(Benchmark& benchmark, void (StateBatchComputer::*pass)(StateBatch&))
+{
+  AdapterDummy adapter;
+  const State startState = createStandingState(adapter);
+  adapter.setInternalDataFromState(startState);
+  const std::vector<Step> steps = createWalkingSteps(adapter, getStance(adapter, startState), nSteps);
+
+  State state;
+  StepParameters parameters;
+  StepCompleter completer(parameters, adapter);
+  StepComputer computer;
+  Executor executor(completer, computer, adapter, state);
+  if (!executor.initialize()) return benchmark.skipWithError("Could not initialize executor.");
+  BatchExecutor batchExecutor(executor);
+  batchExecutor.addProcessingCallback([](bool) {});
+  if (!processSteps(adapter, batchExecutor, startState, steps)) {
+    return benchmark.skipWithError("Could not process steps.");
+  }
+  StateBatchComputer stateBatchComputer(adapter);
+
+  while (benchmark.keepRunning()) {
+    benchmark.pauseTiming();
+    StateBatch stateBatch(batchExecutor.getStateBatch());
+    benchmark.resumeTiming();
+    (stateBatchComputer.*pass)(stateBatch);
+  }
+}
+
+/*!
+ * Benchmarks the evaluation of walking candidates of different lengths.
+ */
+void benchmarkCandidateEvaluator(Benchmark& benchmark, const size_t nThreads)
+{
+  const size_t nCandidates = 16;
+  AdapterDummy adapter;
+  const State startState = createStandingState(adapter);
+  adapter.setInternalDataFromState(startState);
+  std::vector<std::vector<Step>> candidates;
+  for (size_t i = 0; i < nCandidates; ++i) {
+    candidates.push_back(createWalkingSteps(adapter, getStance(adapter, startState), nSteps / 2 + i % 4));
+  }
+
+  StepParameters parameters;
+  CandidateEvaluator evaluator(adapter, parameters);
+  evaluator.setNumberOfThreads(nThreads);
+  std::vector<CandidateEvaluator::Summary> summaries;
+
+  while (benchmark.keepRunning()) {
+    if (!evaluator.evaluate(candidates, startState, summaries)) {
+      return benchmark.skipWithError("Could not evaluate candidates.");
+    }
+  }
+}
+
+}
+
+FREE_GAIT_BENCHMARK("BatchExecutor/process/serial", benchmark)
+{
+  benchmarkBatchExecutor(benchmark, 1);
+}
+
+FREE_GAIT_BENCHMARK("BatchExecutor/process/parallel", benchmark)
+{
+  benchmarkBatchExecutor(benchmark, std::max(2u, std::thread::hardware_concurrency()));
+}
+
+FREE_GAIT_BENCHMARK("BatchExecutor/process/adaptive", benchmark)
+{
+  benchmarkBatchExecutor(benchmark, 1, true);
+}
+
+//! Scaling of the candidate evaluation with the number of threads.
+FREE_GAIT_BENCHMARK("CandidateEvaluator/evaluate/1", benchmark)
+{
+  benchmarkCandidateEvaluator(benchmark, 1);
+}
+
+FREE_GAIT_BENCHMARK("CandidateEvaluator/evaluate/2", benchmark)
+{
+  benchmarkCandidateEvaluator(benchmark, 2);
+}
+
+FREE_GAIT_BENCHMARK("CandidateEvaluator/evaluate/4", benchmark)
+{
+  benchmarkCandidateEvaluator(benchmark, 4);
+}
+
+FREE_GAIT_BENCHMARK("CandidateEvaluator/evaluate/all", benchmark)
+{
+  benchmarkCandidateEvaluator(benchmark, std::max(1u, std::thread::hardware_concurrency()));
+}
+
+FREE_GAIT_BENCHMARK("StateBatchComputer/computeEndEffectorTargetsAndSurfaceNormals", benchmark)
+{
+  benchmarkStateBatchComputer(benchmark, &StateBatchComputer::computeEndEffectorTargetsAndSurfaceNormals);
+}
+
+FREE_GAIT_BENCHMARK("StateBatchComputer/computeEndEffectorTrajectories", benchmark)
+{
+  benchmarkStateBatchComputer(benchmark, &StateBatchComputer::computeEndEffectorTrajectories);
+}
+
+FREE_GAIT_BENCHMARK("StateBatchComputer/computeStances", benchmark)
+{
+  benchmarkStateBatchComputer(benchmark, &StateBatchComputer::computeStances);
+}
+
+FREE_GAIT_BENCHMARK("StateBatchComputer/computeStepIds", benchmark)
+{
+  benchmarkStateBatchComputer(benchmark, &StateBatchComputer::computeStepIds);
+}
+
+//! All derived data in a single pass (compare with the sum of the separate passes).
+FREE_GAIT_BENCHMARK("StateBatchComputer/compute", benchmark)
+{
+  benchmarkStateBatchComputer(benchmark, &StateBatchComputer::compute);
+}
@@ -0,0 +1,265 @@
+/*
+ * Benchmark.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#include "Benchmark.hpp"
+
+// STD
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+#include <regex>
+#include <sstream>
+#include <thread>
+
+namespace free_gait {
+
+Benchmark::Benchmark(const double minTime, const size_t maxIterations)
+    : minTime_(minTime),
+      maxIterations_(maxIterations),
+      isRunning_(false),
+      isPaused_(false),
+      nIterations_(0),
+      elapsed_(Clock::duration::zero()),
+      totalElapsed_(Clock::duration::zero()),
+      cpuStart_(0),
+      cpuElapsed_(0)
+{
+}
+
+Benchmark::~Benchmark()
+{
+}
+
+bool Benchmark::keepRunning()
+{
+  const Clock::time_point now = Clock::now();
+  const std::clock_t cpuNow = std::clock();
+  if (isRunning_) {
+    if (!isPaused_) {
+      elapsed_ += now - start_;
+      if (nIterations_ > 0) cpuElapsed_ += cpuNow - cpuStart_;
+    }
+    // The first iteration is used as warm-up.
+    if (nIterations_ > 0) {
+      durations_.push_back(std::chrono::duration<double, std::nano>(elapsed_).count());
+      totalElapsed_ += elapsed_;
+    } else {
+      wallStart_ = now;
+    }
+    ++nIterations_;
+  }
+
+  if (!error_.empty() || durations_.size() >= maxIterations_) return false;
+  if (isRunning_ && nIterations_ > 1) {
+    const double totalTime = std::chrono::duration<double>(totalElapsed_).count();
+    const double wallTime = std::chrono::duration<double>(now - wallStart_).count();
+    // Limit the wall time if most of the time is spent in paused setup.
+    if (totalTime >= minTime_ || wallTime >= 10.0 * minTime_) return false;
+  }
+
+  isRunning_ = true;
+  isPaused_ = false;
+  elapsed_ = Clock::duration::zero();
+  cpuStart_ = std::clock();
+  start_ = Clock::now();
+  return true;
+}
+
+void Benchmark::pauseTiming()
+{
+  if (isPaused_) return;
+  elapsed_ += Clock::now() - start_;
+  if (nIterations_ > 0) cpuElapsed_ += std::clock() - cpuStart_;
+  isPaused_ = true;
+}
+
+void Benchmark::resumeTiming()
+{
+  if (!isPaused_) return;
+  isPaused_ = false;
+  cpuStart_ = std::clock();
+  start_ = Clock::now();
+}
+
+void Benchmark::skipWithError(const std::string& error)
+{
+  error_ = error;
+}
+
+bool Benchmark::hasError() const
+{
+  return !error_.empty();
+}
+
+const std::string& Benchmark::getError() const
+{
+  return error_;
+}
+
+const std::vector<double>& Benchmark::getDurations() const
+{
+  return durations_;
+}
+
+double Benchmark::getCpuTime() const
+{
+  if (durations_.empty()) return 0.0;
+  return 1e9 * static_cast<double>(cpuElapsed_) / CLOCKS_PER_SEC / durations_.size();
+}
+
+bool BenchmarkRunner::add(const std::string& name, BenchmarkFunction function)
+{
+  getEntries().push_back(Entry{name, function});
+  return true;
+}
+
+int BenchmarkRunner::run(int argc, char** argv)
+{
+  std::string filter(".*"), format("console"), outputFile;
+  double minTime = 0.5;
+  for (int i = 1; i < argc; ++i) {
+    const std::string argument(argv[i]);
+    const size_t separator = argument.find('=');
+    const std::string key = argument.substr(0, separator);
+    const std::string value = separator == std::string::npos ? "" : argument.substr(separator + 1);
+    if (key == "--benchmark_filter") {
+      filter = value;
+    } else if (key == "--benchmark_min_time") {
+      minTime = std::atof(value.c_str());
+    } else if (key == "--benchmark_format") {
+      format = value;
+    } else if (key == "--benchmark_out") {
+      outputFile = value;
+    } else {
+      std::cerr << "Unknown argument: " << argument << std::endl;
+      std::cerr << "Usage: " << argv[0] << " [--benchmark_filter=<regex>] [--benchmark_min_time=<seconds>]"
+                << " [--benchmark_format=<console|json>] [--benchmark_out=<file>]" << std::endl;
+      return 1;
+    }
+  }
+
+  std::vector<Entry> entries(getEntries());
+  std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {return a.name < b.name;});
+  const std::regex filterRegex(filter);
+  const bool isConsole = format != "json";
+  if (isConsole) {
+    std::cout << std::left << std::setw(50) << "Benchmark" << std::right << std::setw(14) << "Mean [ns]"
+              << std::setw(14) << "Median [ns]" << std::setw(14) << "Min [ns]" << std::setw(12) << "Iterations"
+              << std::endl << std::string(104, '-') << std::endl;
+  }
+
+  std::vector<Result> results;
+  bool success = true;
+  for (const auto& entry : entries) {
+    if (!std::regex_search(entry.name, filterRegex)) continue;
+    Benchmark benchmark(minTime, 1000000);
+    try {
+      entry.function(benchmark);
+    } catch (const std::exception& exception) {
+      benchmark.skipWithError(exception.what());
+    }
+    results.push_back(evaluate(entry.name, benchmark));
+    if (!results.back().error.empty()) success = false;
+    if (isConsole) writeConsole(std::cout, results.back());
+  }
+
+  if (!isConsole) writeJson(std::cout, argv[0], results);
+  if (!outputFile.empty()) {
+    std::ofstream file(outputFile);
+    if (!file) {
+      std::cerr << "Could not open output file " << outputFile << "." << std::endl;
+      return 1;
+    }
+    writeJson(file, argv[0], results);
+  }
+  return success ? 0 : 1;
+}
+
+std::vector<BenchmarkRunner::Entry>& BenchmarkRunner::getEntries()
+{
+  static std::vector<Entry> entries;
+  return entries;
+}
+
+BenchmarkRunner::Result BenchmarkRunner::evaluate(const std::string& name, const Benchmark& benchmark)
+{
+  Result result{name, benchmark.getError(), 0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+  std::vector<double> durations(benchmark.getDurations());
+  if (result.error.empty() && durations.empty()) result.error = "No iterations measured.";
+  if (!result.error.empty()) return result;
+
+  result.iterations = durations.size();
+  result.mean = std::accumulate(durations.begin(), durations.end(), 0.0) / durations.size();
+  double squaredDeviations = 0.0;
+  for (const double duration : durations) squaredDeviations += std::pow(duration - result.mean, 2);
+  result.stddev = std::sqrt(squaredDeviations / durations.size());
+  std::sort(durations.begin(), durations.end());
+  result.median = durations[durations.size() / 2];
+  result.min = durations.front();
+  result.max = durations.back();
+  result.cpuTime = benchmark.getCpuTime();
+  return result;
+}
+
+void BenchmarkRunner::writeJson(std::ostream& stream, const std::string& executable, const std::vector<Result>& results)
+{
+  const std::time_t now = std::time(nullptr);
+  char date[32];
+  std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+#ifdef NDEBUG
+  const std::string buildType("release");
+#else
+  const std::string buildType("debug");
+#endif
+
+  stream << std::setprecision(12);
+  stream << "{\n  \"context\": {\n"
+         << "    \"date\": \"" << date << "\",\n"
+         << "    \"executable\": \"" << executable << "\",\n"
+         << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n"
+         << "    \"library_build_type\": \"" << buildType << "\"\n"
+         << "  },\n  \"benchmarks\": [";
+  for (size_t i = 0; i < results.size(); ++i) {
+    const Result& result = results[i];
+    stream << (i == 0 ? "\n" : ",\n") << "    {\n"
+           << "      \"name\": \"" << result.name << "\",\n"
+           << "      \"run_name\": \"" << result.name << "\",\n"
+           << "      \"run_type\": \"iteration\",\n";
+    if (!result.error.empty()) {
+      std::string error(result.error);
+      std::replace(error.begin(), error.end(), '"', '\'');
+      stream << "      \"error_occurred\": true,\n"
+             << "      \"error_message\": \"" << error << "\"\n    }";
+      continue;
+    }
+    stream << "      \"iterations\": " << result.iterations << ",\n"
+           << "      \"real_time\": " << result.mean << ",\n"
+           << "      \"cpu_time\": " << result.cpuTime << ",\n"
+           << "      \"time_unit\": \"ns\",\n"
+           << "      \"median\": " << result.median << ",\n"
+           << "      \"min\": " << result.min << ",\n"
+           << "      \"max\": " << result.max << ",\n"
+           << "      \"stddev\": " << result.stddev << "\n    }";
+  }
+  stream << "\n  ]\n}" << std::endl;
+}
+
+void BenchmarkRunner::writeConsole(std::ostream& stream, const Result& result)
+{
+  stream << std::left << std::setw(50) << result.name << std::right;
+  if (!result.error.empty()) {
+    stream << "ERROR: " << result.error << std::endl;
+    return;
+  }
+  stream << std::fixed << std::setprecision(0) << std::setw(14) << result.mean << std::setw(14) << result.median
+         << std::setw(14) << result.min << std::setw(12) << result.iterations << std::endl;
+}
+
+} /* namespace free_gait */
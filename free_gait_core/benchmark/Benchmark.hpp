@@ -0,0 +1,146 @@
+/*
+ * Benchmark.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#pragma once
+
+// STD
+#include <chrono>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace free_gait {
+
+/*!
+ * State of a running benchmark. The benchmarked code is executed in a loop
+ *   while (benchmark.keepRunning()) { ... }
+ * and each iteration is timed individually. Setup which should not be
+ * measured can be excluded with pauseTiming() and resumeTiming().
+ */
+class Benchmark
+{
+ public:
+  /*!
+   * Constructor.
+   * @param minTime the minimal measured time [s].
+   * @param maxIterations the max. number of iterations.
+   */
+  Benchmark(const double minTime, const size_t maxIterations);
+  virtual ~Benchmark();
+
+  /*!
+   * Ends the timing of the previous iteration and starts the next iteration.
+   * @return true if another iteration should be run, false otherwise.
+   */
+  bool keepRunning();
+  void pauseTiming();
+  void resumeTiming();
+
+  /*!
+   * Stops the benchmark and reports it as failed.
+   * @param error the error message.
+   */
+  void skipWithError(const std::string& error);
+  bool hasError() const;
+  const std::string& getError() const;
+
+  //! Durations of the measured iterations [ns], without the warm-up iteration.
+  const std::vector<double>& getDurations() const;
+
+  //! Measured process CPU time per iteration [ns].
+  double getCpuTime() const;
+
+ private:
+  typedef std::chrono::steady_clock Clock;
+
+  const double minTime_;
+  const size_t maxIterations_;
+  bool isRunning_;
+  bool isPaused_;
+  size_t nIterations_;
+  Clock::time_point start_;
+  Clock::time_point wallStart_;
+  Clock::duration elapsed_;
+  Clock::duration totalElapsed_;
+  std::clock_t cpuStart_;
+  std::clock_t cpuElapsed_;
+  std::vector<double> durations_;
+  std::string error_;
+};
+
+/*!
+ * Registry and runner of the benchmarks. The command line interface and the
+ * JSON output follow Google Benchmark, such that its tools (e.g. compare.py)
+ * can be used to track regressions:
+ *   --benchmark_filter=<regex>
+ *   --benchmark_min_time=<seconds>
+ *   --benchmark_format=<console|json>
+ *   --benchmark_out=<file> (JSON)
+ */
+class BenchmarkRunner
+{
+ public:
+  typedef std::function<void(Benchmark&)> BenchmarkFunction;
+
+  struct Result
+  {
+    std::string name;
+    std::string error;
+    size_t iterations;
+    double mean;
+    double median;
+    double min;
+    double max;
+    double stddev;
+    double cpuTime;
+  };
+
+  /*!
+   * Registers a benchmark, used by FREE_GAIT_BENCHMARK.
+   * @param name the name of the benchmark.
+   * @param function the benchmark function.
+   * @return true.
+   */
+  static bool add(const std::string& name, BenchmarkFunction function);
+
+  /*!
+   * Runs the registered benchmarks.
+   * @param argc the number of command line arguments.
+   * @param argv the command line arguments.
+   * @return 0 if all benchmarks succeeded, 1 otherwise.
+   */
+  static int run(int argc, char** argv);
+
+ private:
+  struct Entry
+  {
+    std::string name;
+    BenchmarkFunction function;
+  };
+
+  static std::vector<Entry>& getEntries();
+  static Result evaluate(const std::string& name, const Benchmark& benchmark);
+  static void writeJson(std::ostream& stream, const std::string& executable, const std::vector<Result>& results);
+  static void writeConsole(std::ostream& stream, const Result& result);
+};
+
+} /* namespace free_gait */
+
+#define FREE_GAIT_BENCHMARK_CONCATENATE_(a, b) a##b
+#define FREE_GAIT_BENCHMARK_CONCATENATE(a, b) FREE_GAIT_BENCHMARK_CONCATENATE_(a, b)
+
+/*!
+ * Defines and registers a benchmark, e.g.
+ *   FREE_GAIT_BENCHMARK("Executor/advance", benchmark) { while (benchmark.keepRunning()) { ... } }
+ */
+#define FREE_GAIT_BENCHMARK(name, benchmark) \
+  static void FREE_GAIT_BENCHMARK_CONCATENATE(benchmarkFunction, __LINE__)(free_gait::Benchmark& benchmark); \
+  static const bool FREE_GAIT_BENCHMARK_CONCATENATE(isBenchmarkRegistered, __LINE__) = \
+      free_gait::BenchmarkRunner::add(name, FREE_GAIT_BENCHMARK_CONCATENATE(benchmarkFunction, __LINE__)); \
+  static void FREE_GAIT_BENCHMARK_CONCATENATE(benchmarkFunction, __LINE__)(free_gait::Benchmark& benchmark)
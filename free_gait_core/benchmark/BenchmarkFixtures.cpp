@@ -0,0 +1,122 @@
+/*
+ * BenchmarkFixtures.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#include "BenchmarkFixtures.hpp"
+#include "free_gait_core/base_motion/BaseAuto.hpp"
+#include "free_gait_core/leg_motion/Footstep.hpp"
+#include "free_gait_core/step/StepCompleter.hpp"
+
+// STD
+#include <random>
+
+namespace free_gait {
+
+State createStandingState(const AdapterBase& adapter)
+{
+  State state;
+  state.initialize(adapter.getLimbs(), adapter.getBranches());
+  state.setPoseBaseToWorld(Pose(Position(0.0, 0.0, 0.45), RotationQuaternion()));
+  for (const auto& limb : adapter.getLimbs()) {
+    state.setJointPositionsForLimb(limb, JointPositionsLeg(Eigen::Vector3d(0.0, 0.0, -0.45)));
+    state.setSupportLeg(limb, true);
+  }
+  return state;
+}
+
+Stance getStance(const AdapterBase& adapter, const State& state)
+{
+  adapter.setInternalDataFromState(state);
+  Stance stance;
+  for (const auto& limb : adapter.getLimbs()) {
+    stance[limb] = adapter.getPositionWorldToFootInWorldFrame(limb);
+  }
+  return stance;
+}
+
+std::vector<Step> createWalkingSteps(const AdapterBase& adapter, const Stance& stance, const size_t nSteps,
+                                     const double stride)
+{
+  const std::vector<LimbEnum> sequence{LimbEnum::LF_LEG, LimbEnum::RH_LEG, LimbEnum::RF_LEG, LimbEnum::LH_LEG};
+  Stance footPositions(stance);
+  std::vector<Step> steps;
+  for (size_t i = 0; i < nSteps; ++i) {
+    const LimbEnum limb = sequence[i % sequence.size()];
+    footPositions[limb] += Position(stride, 0.0, 0.0);
+    Footstep footstep(limb);
+    footstep.setTargetPosition(adapter.getWorldFrameId(), footPositions[limb]);
+    Step step;
+    step.addLegMotion(footstep);
+    step.addBaseMotion(BaseAuto());
+    steps.push_back(step);
+  }
+  return steps;
+}
+
+PoseOptimizationProblemFixture::PoseOptimizationProblemFixture(const AdapterBase& adapter)
+    : state(createStandingState(adapter))
+{
+  stance = getStance(adapter, state);
+  stance[LimbEnum::LF_LEG] += Position(0.1, 0.0, 0.0);
+  supportStance = stance;
+  supportStance.erase(LimbEnum::LF_LEG);
+
+  // Counter-clockwise ordered support polygon.
+  for (const auto& limb : {LimbEnum::LH_LEG, LimbEnum::RH_LEG, LimbEnum::RF_LEG}) {
+    supportRegion.addVertex(supportStance[limb].vector().head<2>());
+  }
+  supportRegion.offsetInward(0.04);
+
+  const StepParameters parameters;
+  for (const auto& nominalPosition : parameters.baseAutoParameters.nominalPlanarStanceInBaseFrame) {
+    nominalStanceInBaseFrame[nominalPosition.first] = Position(nominalPosition.second.x(), nominalPosition.second.y(),
+                                                               -0.45);
+  }
+  for (const auto& limb : adapter.getLimbs()) {
+    minLimbLengths[limb] = 0.2;
+    maxLimbLengths[limb] = limb == LimbEnum::LF_LEG ? 0.565 : 0.545;
+  }
+  initialPose = Pose(state.getPositionWorldToBaseInWorldFrame(), state.getOrientationBaseToWorld());
+}
+
+std::vector<PositionProblemFixture> createRandomPositionProblems(const size_t nProblems)
+{
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+
+  const Stance nominalStance({
+    {LimbEnum::LF_LEG, Position(0.33, 0.22, -0.45)},
+    {LimbEnum::RF_LEG, Position(0.33, -0.22, -0.45)},
+    {LimbEnum::LH_LEG, Position(-0.33, 0.22, -0.45)},
+    {LimbEnum::RH_LEG, Position(-0.33, -0.22, -0.45)} });
+  // Counter-clockwise order of the feet.
+  const std::vector<LimbEnum> limbOrder{LimbEnum::LF_LEG, LimbEnum::LH_LEG, LimbEnum::RH_LEG, LimbEnum::RF_LEG};
+
+  std::vector<PositionProblemFixture> problems(nProblems);
+  for (auto& problem : problems) {
+    problem.nominalStanceInBaseFrame = nominalStance;
+    const double yaw = 0.5 * distribution(generator);
+    const RotationMatrix stanceOrientation(EulerAnglesZyx(yaw, 0.0, 0.0));
+    const Position center(distribution(generator), distribution(generator), 0.1 * distribution(generator));
+    for (const auto& foot : nominalStance) {
+      Position footPosition(foot.second.x(), foot.second.y(), 0.0);
+      footPosition += Position(0.1 * distribution(generator), 0.1 * distribution(generator), 0.02 * distribution(generator));
+      problem.stance[foot.first] = stanceOrientation.rotate(footPosition) + center;
+    }
+    problem.orientation = RotationMatrix(EulerAnglesZyx(yaw + 0.1 * distribution(generator), 0.0, 0.0));
+    problem.centerOfMassInBaseFrame = Position(0.05 * distribution(generator), 0.05 * distribution(generator), 0.0);
+    // Support triangle (one leg swinging) or full support polygon.
+    const size_t swingLeg = static_cast<size_t>(5.0 * (0.5 + 0.5 * distribution(generator)));
+    for (size_t i = 0; i < limbOrder.size(); ++i) {
+      if (i == swingLeg) continue;
+      problem.supportRegion.addVertex(problem.stance[limbOrder[i]].vector().head<2>());
+    }
+    problem.supportRegion.offsetInward(0.04);
+  }
+  return problems;
+}
+
+} /* namespace free_gait */
@@ -0,0 +1,86 @@
+/*
+ * BenchmarkFixtures.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#pragma once
+
+#include "free_gait_core/TypeDefs.hpp"
+#include "free_gait_core/executor/AdapterBase.hpp"
+#include "free_gait_core/executor/State.hpp"
+#include "free_gait_core/step/Step.hpp"
+
+#include <grid_map_core/Polygon.hpp>
+
+// STD
+#include <vector>
+
+namespace free_gait {
+
+/*!
+ * Returns the state of the robot standing with all feet on the ground.
+ * @param adapter the adapter (AdapterDummy with Cartesian legs).
+ * @return the standing state.
+ */
+State createStandingState(const AdapterBase& adapter);
+
+/*!
+ * Returns the feet positions of a state.
+ * @param adapter the adapter, its internal data is set to the state.
+ * @param state the state.
+ * @return the feet positions in world frame.
+ */
+Stance getStance(const AdapterBase& adapter, const State& state);
+
+/*!
+ * Creates the steps of a static walk (LF, RH, RF, LH), each with a footstep
+ * and a BaseAuto motion.
+ * @param adapter the adapter.
+ * @param stance the feet positions at the start.
+ * @param nSteps the number of steps.
+ * @param stride the length of the footsteps [m].
+ * @return the steps.
+ */
+std::vector<Step> createWalkingSteps(const AdapterBase& adapter, const Stance& stance, const size_t nSteps,
+                                     const double stride = 0.1);
+
+/*!
+ * Describes a BaseAuto pose optimization problem with the LF leg swinging.
+ */
+struct PoseOptimizationProblemFixture
+{
+  PoseOptimizationProblemFixture(const AdapterBase& adapter);
+  State state;
+  Stance stance;
+  Stance supportStance;
+  Stance nominalStanceInBaseFrame;
+  grid_map::Polygon supportRegion;
+  std::map<LimbEnum, double> minLimbLengths;
+  std::map<LimbEnum, double> maxLimbLengths;
+  Pose initialPose;
+};
+
+/*!
+ * Describes a random BaseAuto-like position problem of the pose optimization
+ * QP (see PoseOptimizationQP::optimizePosition()).
+ */
+struct PositionProblemFixture
+{
+  Stance stance;
+  Stance nominalStanceInBaseFrame;
+  RotationMatrix orientation;
+  Position centerOfMassInBaseFrame;
+  grid_map::Polygon supportRegion;
+};
+
+/*!
+ * Creates random position problems with a support triangle (one leg swinging)
+ * or the full support polygon. The problems are the same in every run.
+ * @param nProblems the number of problems.
+ * @return the problems.
+ */
+std::vector<PositionProblemFixture> createRandomPositionProblems(const size_t nProblems);
+
+} /* namespace free_gait */
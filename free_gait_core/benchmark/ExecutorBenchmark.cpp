@@ -0,0 +1,116 @@
+/*
+ * ExecutorBenchmark.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#include "Benchmark.hpp"
+#include "BenchmarkFixtures.hpp"
+#include "AdapterDummy.hpp"
+#include "free_gait_core/executor/Executor.hpp"
+#include "free_gait_core/base_motion/BaseAuto.hpp"
+#include "free_gait_core/leg_motion/Footstep.hpp"
+
+using namespace free_gait;
+
+namespace {
+
+const double timeStep = 0.0025;
+
+}
+
+FREE_GAIT_BENCHMARK("Executor/advance", benchmark)
+{
+  AdapterDummy adapter;
+  const State startState = createStandingState(adapter);
+  adapter.setInternalDataFromState(startState);
+  const std::vector<Step> steps = createWalkingSteps(adapter, getStance(adapter, startState), 8);
+
+  State state;
+  StepParameters parameters;
+  StepCompleter completer(parameters, adapter);
+  StepComputer computer;
+  Executor executor(completer, computer, adapter, state);
+  if (!executor.initialize()) return benchmark.skipWithError("Could not initialize executor.");
+
+  while (benchmark.keepRunning()) {
+    if (executor.getQueue().empty()) {
+      // Walk the same steps again from the start.
+      benchmark.pauseTiming();
+      adapter.setInternalDataFromState(startState);
+      executor.reset();
+      executor.getQueue().add(steps);
+      benchmark.resumeTiming();
+    }
+    if (!executor.advance(timeStep)) return benchmark.skipWithError("Could not advance executor.");
+    // The robot follows the commands perfectly.
+    benchmark.pauseTiming();
+    adapter.setInternalDataFromState(executor.getState());
+    benchmark.resumeTiming();
+  }
+}
+
+FREE_GAIT_BENCHMARK("StepCompleter/complete", benchmark)
+{
+  AdapterDummy adapter;
+  const State state = createStandingState(adapter);
+  StepQueue queue;
+  queue.add(createWalkingSteps(adapter, getStance(adapter, state), 4));
+  StepParameters parameters;
+  StepCompleter completer(parameters, adapter);
+
+  while (benchmark.keepRunning()) {
+    benchmark.pauseTiming();
+    Step step(queue.getCurrentStep());
+    adapter.setInternalDataFromState(state);
+    benchmark.resumeTiming();
+    if (!completer.complete(state, queue, step)) return benchmark.skipWithError("Could not complete step.");
+  }
+}
+
+FREE_GAIT_BENCHMARK("Footstep/compute", benchmark)
+{
+  AdapterDummy adapter;
+  const State state = createStandingState(adapter);
+  adapter.setInternalDataFromState(state);
+  StepQueue queue;
+  queue.add(createWalkingSteps(adapter, getStance(adapter, state), 1));
+  StepParameters parameters;
+  StepCompleter completer(parameters, adapter);
+  Step step(queue.getCurrentStep());
+  if (!completer.complete(state, queue, step)) return benchmark.skipWithError("Could not complete step.");
+  const Footstep& footstep = dynamic_cast<const Footstep&>(step.getLegMotion(LimbEnum::LF_LEG));
+
+  while (benchmark.keepRunning()) {
+    benchmark.pauseTiming();
+    Footstep footstepCopy(footstep);
+    benchmark.resumeTiming();
+    if (!footstepCopy.compute(false)) return benchmark.skipWithError("Could not compute footstep.");
+  }
+}
+
+FREE_GAIT_BENCHMARK("BaseAuto/prepareComputation", benchmark)
+{
+  AdapterDummy adapter;
+  const State state = createStandingState(adapter);
+  StepQueue queue;
+  queue.add(createWalkingSteps(adapter, getStance(adapter, state), 4));
+  StepParameters parameters;
+  StepCompleter completer(parameters, adapter);
+  Step step(queue.getCurrentStep());
+  if (!completer.complete(state, queue, step)) return benchmark.skipWithError("Could not complete step.");
+  const Pose startPose(state.getPositionWorldToBaseInWorldFrame(), state.getOrientationBaseToWorld());
+
+  while (benchmark.keepRunning()) {
+    benchmark.pauseTiming();
+    BaseAuto baseAuto;
+    completer.setParameters(baseAuto);
+    adapter.setInternalDataFromState(state);
+    benchmark.resumeTiming();
+    baseAuto.updateStartPose(startPose);
+    if (!baseAuto.prepareComputation(state, step, queue, adapter)) {
+      return benchmark.skipWithError("Could not prepare computation of BaseAuto.");
+    }
+  }
+}
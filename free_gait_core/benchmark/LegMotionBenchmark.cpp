@@ -0,0 +1,206 @@
+/*
+ * LegMotionBenchmark.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#include "Benchmark.hpp"
+#include "BenchmarkFixtures.hpp"
+#include "AdapterDummy.hpp"
+#include "free_gait_core/leg_motion/leg_motion.hpp"
+#include "free_gait_core/step/StepCompleter.hpp"
+#include "free_gait_core/step/StepQueue.hpp"
+
+// STD
+#include <cmath>
+#include <memory>
+
+using namespace free_gait;
+
+namespace {
+
+const size_t nSamples = 100;
+
+/*!
+ * Returns computed footsteps of a walk, such that the leg motions of all
+ * limbs are evaluated as in the executor.
+ */
+bool createFootsteps(std::vector<std::unique_ptr<LegMotionBase>>& footsteps)
+{
+  AdapterDummy adapter;
+  const State state = createStandingState(adapter);
+  adapter.setInternalDataFromState(state);
+  StepQueue queue;
+  queue.add(createWalkingSteps(adapter, getStance(adapter, state), 1));
+  StepParameters parameters;
+  StepCompleter completer(parameters, adapter);
+  Step step(queue.getCurrentStep());
+  if (!completer.complete(state, queue, step)) return false;
+  for (size_t i = 0; i < nLimbs; ++i) {
+    footsteps.push_back(step.getLegMotion(LimbEnum::LF_LEG).clone());
+    if (!static_cast<Footstep&>(*footsteps.back()).compute(false)) return false;
+  }
+  return true;
+}
+
+}
+
+//! Current path: run-time type check and virtual calls for every evaluation.
+FREE_GAIT_BENCHMARK("LegMotion/evaluateDynamicCast", benchmark)
+{
+  std::vector<std::unique_ptr<LegMotionBase>> footsteps;
+  if (!createFootsteps(footsteps)) return benchmark.skipWithError("Could not create footsteps.");
+  const double duration = footsteps.front()->getDuration();
+  Eigen::Vector3d sum(Eigen::Vector3d::Zero());
+
+  while (benchmark.keepRunning()) {
+    for (size_t i = 0; i < nSamples; ++i) {
+      const double time = duration * i / nSamples;
+      for (const auto& legMotion : footsteps) {
+        const auto& endEffectorMotion = dynamic_cast<const EndEffectorMotionBase&>(*legMotion);
+        sum += endEffectorMotion.evaluatePosition(time).vector();
+        sum += endEffectorMotion.evaluateVelocity(time).vector();
+        sum += endEffectorMotion.evaluateAcceleration(time).vector();
+      }
+    }
+  }
+  if (!sum.allFinite()) benchmark.skipWithError("Invalid evaluation.");
+}
+
+//! Type resolved once, direct calls for every evaluation (see LegMotionVariant).
+FREE_GAIT_BENCHMARK("LegMotion/evaluateVariant", benchmark)
+{
+  std::vector<std::unique_ptr<LegMotionBase>> footsteps;
+  if (!createFootsteps(footsteps)) return benchmark.skipWithError("Could not create footsteps.");
+  const double duration = footsteps.front()->getDuration();
+  std::vector<LegMotionVariant> legMotions;
+  for (const auto& footstep : footsteps) legMotions.emplace_back(*footstep);
+  Eigen::Vector3d sum(Eigen::Vector3d::Zero());
+
+  while (benchmark.keepRunning()) {
+    for (size_t i = 0; i < nSamples; ++i) {
+      const double time = duration * i / nSamples;
+      for (const auto& legMotion : legMotions) {
+        sum += legMotion.evaluatePosition(time).vector();
+        sum += legMotion.evaluateVelocity(time).vector();
+        sum += legMotion.evaluateAcceleration(time).vector();
+      }
+    }
+  }
+  if (!sum.allFinite()) benchmark.skipWithError("Invalid evaluation.");
+}
+
+//! All derivatives evaluated with a single trajectory lookup.
+FREE_GAIT_BENCHMARK("LegMotion/evaluateBatched", benchmark)
+{
+  std::vector<std::unique_ptr<LegMotionBase>> footsteps;
+  if (!createFootsteps(footsteps)) return benchmark.skipWithError("Could not create footsteps.");
+  const double duration = footsteps.front()->getDuration();
+  std::vector<LegMotionVariant> legMotions;
+  for (const auto& footstep : footsteps) legMotions.emplace_back(*footstep);
+  Eigen::Vector3d sum(Eigen::Vector3d::Zero());
+  Position position;
+  LinearVelocity velocity;
+  LinearAcceleration acceleration;
+
+  while (benchmark.keepRunning()) {
+    for (size_t i = 0; i < nSamples; ++i) {
+      const double time = duration * i / nSamples;
+      for (const auto& legMotion : legMotions) {
+        legMotion.evaluate(time, position, velocity, acceleration);
+        sum += position.vector() + velocity.vector() + acceleration.vector();
+      }
+    }
+  }
+  if (!sum.allFinite()) benchmark.skipWithError("Invalid evaluation.");
+}
+
+//! All derivatives evaluated from a uniformly sampled table.
+FREE_GAIT_BENCHMARK("LegMotion/evaluateSampled", benchmark)
+{
+  std::vector<std::unique_ptr<LegMotionBase>> footsteps;
+  if (!createFootsteps(footsteps)) return benchmark.skipWithError("Could not create footsteps.");
+  const double duration = footsteps.front()->getDuration();
+  std::vector<LegMotionVariant> legMotions;
+  for (const auto& footstep : footsteps) {
+    footstep->setSampling(0.01, SampleInterpolation::Cubic);
+    legMotions.emplace_back(*footstep);
+  }
+  Eigen::Vector3d sum(Eigen::Vector3d::Zero());
+  Position position;
+  LinearVelocity velocity;
+  LinearAcceleration acceleration;
+
+  while (benchmark.keepRunning()) {
+    for (size_t i = 0; i < nSamples; ++i) {
+      const double time = duration * i / nSamples;
+      for (const auto& legMotion : legMotions) {
+        legMotion.evaluate(time, position, velocity, acceleration);
+        sum += position.vector() + velocity.vector() + acceleration.vector();
+      }
+    }
+  }
+  if (!sum.allFinite()) benchmark.skipWithError("Invalid evaluation.");
+}
+
+namespace {
+
+const size_t nKnots = 500;
+
+bool createLongTrajectory(EndEffectorTrajectory& trajectory)
+{
+  std::vector<EndEffectorTrajectory::Time> times;
+  std::vector<EndEffectorTrajectory::ValueType> values;
+  for (size_t i = 0; i < nKnots; ++i) {
+    times.push_back(0.01 * i);
+    values.push_back(EndEffectorTrajectory::ValueType(0.1 * std::sin(0.1 * i), 0.1 * std::cos(0.1 * i), 0.01 * i));
+  }
+  std::unordered_map<ControlLevel, std::vector<EndEffectorTrajectory::ValueType>, EnumClassHash> controlLevelValues;
+  controlLevelValues[ControlLevel::Position] = values;
+  trajectory.setTrajectory({{ControlLevel::Position, "odom"}}, times, controlLevelValues);
+  AdapterDummy adapter;
+  return trajectory.prepareComputation(adapter.getState(), Step(), adapter);
+}
+
+}
+
+//! Per-tick evaluation of a long trajectory (segments found incrementally).
+FREE_GAIT_BENCHMARK("LegMotion/evaluateLongTrajectorySequential", benchmark)
+{
+  EndEffectorTrajectory trajectory(LimbEnum::LF_LEG);
+  if (!createLongTrajectory(trajectory)) return benchmark.skipWithError("Could not create trajectory.");
+  const double duration = trajectory.getDuration();
+  Eigen::Vector3d sum(Eigen::Vector3d::Zero());
+  Position position;
+  LinearVelocity velocity;
+  LinearAcceleration acceleration;
+
+  while (benchmark.keepRunning()) {
+    for (size_t i = 0; i < nKnots; ++i) {
+      trajectory.evaluate(duration * i / nKnots, position, velocity, acceleration);
+      sum += position.vector();
+    }
+  }
+  if (!sum.allFinite()) benchmark.skipWithError("Invalid evaluation.");
+}
+
+//! Random access evaluation of a long trajectory (segments found by binary search).
+FREE_GAIT_BENCHMARK("LegMotion/evaluateLongTrajectoryRandom", benchmark)
+{
+  EndEffectorTrajectory trajectory(LimbEnum::LF_LEG);
+  if (!createLongTrajectory(trajectory)) return benchmark.skipWithError("Could not create trajectory.");
+  const double duration = trajectory.getDuration();
+  Eigen::Vector3d sum(Eigen::Vector3d::Zero());
+  Position position;
+  LinearVelocity velocity;
+  LinearAcceleration acceleration;
+
+  while (benchmark.keepRunning()) {
+    for (size_t i = 0; i < nKnots; ++i) {
+      trajectory.evaluate(duration * ((i * 263) % nKnots) / nKnots, position, velocity, acceleration);
+      sum += position.vector();
+    }
+  }
+  if (!sum.allFinite()) benchmark.skipWithError("Invalid evaluation.");
+}
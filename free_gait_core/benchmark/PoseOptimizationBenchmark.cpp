@@ -0,0 +1,143 @@
+/*
+ * PoseOptimizationBenchmark.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#include "Benchmark.hpp"
+#include "BenchmarkFixtures.hpp"
+#include "AdapterDummy.hpp"
+#include "free_gait_core/pose_optimization/PoseOptimizationGeometric.hpp"
+#include "free_gait_core/pose_optimization/PoseOptimizationQP.hpp"
+#include "free_gait_core/pose_optimization/PoseOptimizationSQP.hpp"
+
+// STD
+#include <algorithm>
+#include <vector>
+
+using namespace free_gait;
+
+namespace {
+
+void setProblem(PoseOptimizationBase& optimization, const PoseOptimizationProblemFixture& problem)
+{
+  optimization.setCurrentState(problem.state);
+  optimization.setStance(problem.stance);
+  optimization.setSupportStance(problem.supportStance);
+  optimization.setNominalStance(problem.nominalStanceInBaseFrame);
+  optimization.setSupportRegion(problem.supportRegion);
+  optimization.setLimbLengthConstraints(problem.minLimbLengths, problem.maxLimbLengths);
+}
+
+void benchmarkQP(Benchmark& benchmark, const bool useGenericSolver)
+{
+  AdapterDummy adapter;
+  const PoseOptimizationProblemFixture problem(adapter);
+  PoseOptimizationQP optimization(adapter);
+  optimization.setUseGenericSolver(useGenericSolver);
+  setProblem(optimization, problem);
+
+  while (benchmark.keepRunning()) {
+    Pose pose(problem.initialPose);
+    if (!optimization.optimize(pose)) return benchmark.skipWithError("Could not optimize pose.");
+  }
+}
+
+/*!
+ * Solves random position problems, one per iteration. The solutions of the
+ * generic solver are compared with the closed-form solutions.
+ */
+void benchmarkQPPosition(Benchmark& benchmark, const bool useGenericSolver)
+{
+  AdapterDummy adapter;
+  PoseOptimizationQP optimization(adapter);
+  const std::vector<PositionProblemFixture> problems(createRandomPositionProblems(1000));
+  std::vector<Position> positions(problems.size());
+
+  size_t nSolved = 0;
+  while (benchmark.keepRunning()) {
+    const size_t i = nSolved++ % problems.size();
+    const PositionProblemFixture& problem = problems[i];
+    const bool isSuccessful = useGenericSolver ?
+        optimization.optimizePositionWithGenericSolver(problem.stance, problem.nominalStanceInBaseFrame,
+                                                       problem.orientation, problem.centerOfMassInBaseFrame,
+                                                       problem.supportRegion, positions[i]) :
+        PoseOptimizationQP::optimizePosition(problem.stance, problem.nominalStanceInBaseFrame, problem.orientation,
+                                             problem.centerOfMassInBaseFrame, problem.supportRegion, positions[i]);
+    if (!isSuccessful) return benchmark.skipWithError("Could not optimize position.");
+  }
+
+  if (!useGenericSolver) return;
+  double maxDeviation = 0.0;
+  for (size_t i = 0; i < std::min(nSolved, problems.size()); ++i) {
+    const PositionProblemFixture& problem = problems[i];
+    Position closedFormPosition;
+    PoseOptimizationQP::optimizePosition(problem.stance, problem.nominalStanceInBaseFrame, problem.orientation,
+                                         problem.centerOfMassInBaseFrame, problem.supportRegion, closedFormPosition);
+    maxDeviation = std::max(maxDeviation, (closedFormPosition - positions[i]).norm());
+  }
+  if (maxDeviation > 1e-6) benchmark.skipWithError("Generic and closed-form solutions differ.");
+}
+
+void benchmarkSQP(Benchmark& benchmark, const bool useWarmStart)
+{
+  AdapterDummy adapter;
+  const PoseOptimizationProblemFixture problem(adapter);
+  PoseOptimizationSQP optimization(adapter);
+  optimization.setWarmStart(useWarmStart);
+  setProblem(optimization, problem);
+
+  while (benchmark.keepRunning()) {
+    benchmark.pauseTiming();
+    Pose pose(problem.initialPose);
+    benchmark.resumeTiming();
+    if (!optimization.optimize(pose)) return benchmark.skipWithError("Could not optimize pose.");
+  }
+}
+
+}
+
+FREE_GAIT_BENCHMARK("PoseOptimizationGeometric/optimize", benchmark)
+{
+  AdapterDummy adapter;
+  const PoseOptimizationProblemFixture problem(adapter);
+  PoseOptimizationGeometric optimization(adapter);
+  setProblem(optimization, problem);
+  optimization.setStanceForOrientation(problem.stance);
+
+  while (benchmark.keepRunning()) {
+    Pose pose(problem.initialPose);
+    if (!optimization.optimize(pose)) return benchmark.skipWithError("Could not optimize pose.");
+  }
+}
+
+FREE_GAIT_BENCHMARK("PoseOptimizationQP/optimize", benchmark)
+{
+  benchmarkQP(benchmark, false);
+}
+
+FREE_GAIT_BENCHMARK("PoseOptimizationQP/optimize/generic_solver", benchmark)
+{
+  benchmarkQP(benchmark, true);
+}
+
+FREE_GAIT_BENCHMARK("PoseOptimizationQP/optimizePosition/random", benchmark)
+{
+  benchmarkQPPosition(benchmark, false);
+}
+
+FREE_GAIT_BENCHMARK("PoseOptimizationQP/optimizePosition/random/generic_solver", benchmark)
+{
+  benchmarkQPPosition(benchmark, true);
+}
+
+FREE_GAIT_BENCHMARK("PoseOptimizationSQP/optimize/cold_start", benchmark)
+{
+  benchmarkSQP(benchmark, false);
+}
+
+FREE_GAIT_BENCHMARK("PoseOptimizationSQP/optimize/warm_start", benchmark)
+{
+  benchmarkSQP(benchmark, true);
+}
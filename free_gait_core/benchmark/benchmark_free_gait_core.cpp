@@ -0,0 +1,13 @@
+/*
+ * benchmark_free_gait_core.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#include "Benchmark.hpp"
+
+int main(int argc, char** argv)
+{
+  return free_gait::BenchmarkRunner::run(argc, argv);
+}
@@ -15,6 +15,11 @@
 // STL
 #include <unordered_map>
 #include <map>
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <initializer_list>
+#include <utility>
 
 
 namespace free_gait {
@@ -80,12 +85,163 @@ enum class ControlLevel
   Effort
 };
 
+//! Sizes for enum-indexed containers.
+constexpr size_t nControlLevels = 4;
+constexpr size_t nLimbs = 4;
+constexpr size_t nBranches = 5;
+
+inline size_t getIndex(const LimbEnum& limb)
+{
+  return static_cast<size_t>(limb);
+}
+
+inline size_t getIndex(const BranchEnum& branch)
+{
+  return static_cast<size_t>(branch);
+}
+
+inline size_t getIndex(const ControlLevel& controlLevel)
+{
+  return static_cast<size_t>(controlLevel);
+}
+
+/*!
+ * Set of control levels stored as a bitmask (one bit per level).
+ * Trivially copyable, but accessed like the map it replaces, e.g.
+ * `controlSetup[ControlLevel::Position] = true` or iterating over
+ * (control level, is active) pairs.
+ */
+class ControlSetup
+{
+ public:
+  class Reference
+  {
+   public:
+    Reference(ControlSetup& controlSetup, const ControlLevel& controlLevel)
+        : controlSetup_(controlSetup),
+          controlLevel_(controlLevel)
+    {
+    }
+
+    Reference& operator=(bool isActive)
+    {
+      controlSetup_.set(controlLevel_, isActive);
+      return *this;
+    }
+
+    operator bool() const
+    {
+      return controlSetup_.at(controlLevel_);
+    }
+
+   private:
+    ControlSetup& controlSetup_;
+    ControlLevel controlLevel_;
+  };
+
+  class ConstIterator
+  {
+   public:
+    ConstIterator(const ControlSetup& controlSetup, size_t index)
+        : controlSetup_(controlSetup),
+          index_(index)
+    {
+    }
+
+    std::pair<ControlLevel, bool> operator*() const
+    {
+      const ControlLevel controlLevel = static_cast<ControlLevel>(index_);
+      return std::make_pair(controlLevel, controlSetup_.at(controlLevel));
+    }
+
+    ConstIterator& operator++()
+    {
+      ++index_;
+      return *this;
+    }
+
+    bool operator!=(const ConstIterator& other) const
+    {
+      return index_ != other.index_;
+    }
+
+   private:
+    const ControlSetup& controlSetup_;
+    size_t index_;
+  };
+
+  ControlSetup()
+      : bits_(0)
+  {
+  }
+
+  ControlSetup(std::initializer_list<std::pair<ControlLevel, bool>> controlLevels)
+      : bits_(0)
+  {
+    for (const auto& controlLevel : controlLevels) set(controlLevel.first, controlLevel.second);
+  }
+
+  bool at(const ControlLevel& controlLevel) const
+  {
+    return (bits_ >> getIndex(controlLevel)) & 1u;
+  }
+
+  bool operator[](const ControlLevel& controlLevel) const
+  {
+    return at(controlLevel);
+  }
+
+  Reference operator[](const ControlLevel& controlLevel)
+  {
+    return Reference(*this, controlLevel);
+  }
+
+  void set(const ControlLevel& controlLevel, bool isActive)
+  {
+    const uint8_t mask = static_cast<uint8_t>(1u << getIndex(controlLevel));
+    bits_ = isActive ? (bits_ | mask) : (bits_ & ~mask);
+  }
+
+  //! True if no control level is active.
+  bool none() const
+  {
+    return bits_ == 0;
+  }
+
+  void clear()
+  {
+    bits_ = 0;
+  }
+
+  bool operator==(const ControlSetup& other) const
+  {
+    return bits_ == other.bits_;
+  }
+
+  bool operator!=(const ControlSetup& other) const
+  {
+    return bits_ != other.bits_;
+  }
+
+  ConstIterator begin() const
+  {
+    return ConstIterator(*this, 0);
+  }
+
+  ConstIterator end() const
+  {
+    return ConstIterator(*this, nControlLevels);
+  }
+
+ private:
+  uint8_t bits_;
+};
+
 const std::vector<LimbEnum> limbEnumCounterClockWiseOrder = { LimbEnum::LF_LEG,
                                                               LimbEnum::LH_LEG,
                                                               LimbEnum::RH_LEG,
                                                               LimbEnum::RF_LEG };
 
-typedef std::unordered_map<ControlLevel, bool, EnumClassHash> ControlSetup;
 typedef std::unordered_map<LimbEnum, Position, EnumClassHash> Stance;
 typedef std::unordered_map<LimbEnum, Position2, EnumClassHash> PlanarStance;
 
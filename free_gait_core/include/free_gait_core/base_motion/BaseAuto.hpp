@@ -22,6 +22,7 @@
 
 #include <string>
 #include <memory>
+#include <mutex>
 
 namespace free_gait {
 
@@ -34,6 +35,19 @@ class BaseAuto : public BaseMotionBase
   typedef typename curves::CubicHermiteSE3Curve::ValueType ValueType;
   typedef typename curves::Time Time;
 
+  /*!
+   * Optimization data kept across steps by the step completer: the SQP pose
+   * optimizer for warm starting and the copy of the adapter it works on. The
+   * data is shared by the steps completed with the same completer, hence it
+   * is only accessed with the mutex locked.
+   */
+  struct PersistentOptimization
+  {
+    std::mutex mutex;
+    std::unique_ptr<AdapterBase> adapter;
+    std::shared_ptr<PoseOptimizationSQP> poseOptimizationSQP;
+  };
+
   BaseAuto();
   virtual ~BaseAuto();
 
@@ -41,7 +55,7 @@ class BaseAuto : public BaseMotionBase
 
   std::unique_ptr<BaseMotionBase> clone() const;
 
-  const ControlSetup getControlSetup() const;
+  const ControlSetup& getControlSetup() const;
 
   /*!
    * Update the profile with the base start pose.
@@ -60,8 +74,10 @@ class BaseAuto : public BaseMotionBase
    * @return the duration.
    */
   double getDuration() const;
+  void setSampling(const double timeStep, const SampleInterpolation interpolation);
+  double getSamplingTimeStep() const;
 
-  const std::string& getFrameId(const ControlLevel& controlLevel) const;
+  FrameId getFrameHandle(const ControlLevel& controlLevel) const;
 
   void setNominalStanceInBaseFrame(const PlanarStance& nominalPlanarStanceInBaseFrame);
   void setHeight(const double height);
@@ -88,13 +104,15 @@ class BaseAuto : public BaseMotionBase
    */
   Twist evaluateTwist(const double time) const;
 
+  void evaluate(const double time, Pose& pose, Twist& twist) const;
+
   friend std::ostream& operator << (std::ostream& out, const BaseAuto& baseAuto);
 
   friend class StepCompleter;
   friend class StepRosConverter;
 
  protected:
-  std::string frameId_;
+  FrameId frameId_;
   std::unique_ptr<double> height_; // In control frame.
   PoseOptimizationBase::LimbLengths minLimbLenghts_, maxLimbLenghts_;
   bool ignoreTimingOfLegMotion_;
@@ -102,9 +120,13 @@ class BaseAuto : public BaseMotionBase
   double averageAngularVelocity_;
   double supportMargin_;
   double minimumDuration_;
+  size_t maxOptimizationIterations_;
+  double maxOptimizationDuration_; // In micro seconds.
 
  private:
 
+  bool prepareComputationWithAdapter(const State& state, const Step& step, const StepQueue& queue,
+                                     const AdapterBase& adapter);
   bool computeHeight(const State& state, const StepQueue& queue, const AdapterBase& adapter);
   bool generateFootholdLists(const State& state, const Step& step, const StepQueue& queue, const AdapterBase& adapter);
   void computeDuration(const State& state, const Step& step, const AdapterBase& adapter);
@@ -115,6 +137,13 @@ class BaseAuto : public BaseMotionBase
    */
   bool computeTrajectory();
 
+  /*!
+   * Samples the trajectory. The position is interpolated as set, the
+   * orientation by spherical linear and the angular velocity by linear
+   * interpolation.
+   */
+  void sampleTrajectory();
+
   Pose start_; // In world frame.
   Pose target_; // In world frame.
   double duration_;
@@ -125,6 +154,13 @@ class BaseAuto : public BaseMotionBase
   //! Base trajectory.
   curves::CubicHermiteSE3Curve trajectory_;
 
+  //! Uniformly sampled trajectory, evaluated instead of the curve if sampled.
+  double samplingTimeStep_;
+  SampleInterpolation samplingInterpolation_;
+  SampledTrajectory<3> sampledPositions_;
+  SampledTrajectory<4> sampledOrientations_; // Quaternion coefficients (w, x, y, z).
+  SampledTrajectory<3> sampledAngularVelocities_;
+
   // In world frame.
   Stance footholdsToReach_, footholdsInSupport_, footholdsForOrientation_, footholdsOfNextLegMotion_;
   // In base frame.
@@ -135,10 +171,16 @@ class BaseAuto : public BaseMotionBase
 
   bool tolerateFailingOptimization_;
 
+  //! Copy of the adapter used by the optimizers (if the adapter supports copies).
+  std::unique_ptr<AdapterBase> adapterCopy_;
+
   //! Optimizers.
   std::unique_ptr<PoseOptimizationGeometric> poseOptimizationGeometric_;
   std::unique_ptr<PoseOptimizationQP> poseOptimizationQP_;
-  std::unique_ptr<PoseOptimizationSQP> poseOptimizationSQP_;
+  std::shared_ptr<PoseOptimizationSQP> poseOptimizationSQP_;
+
+  //! Optimization kept across steps (set by the step completer), warm starts from the previous step.
+  std::shared_ptr<PersistentOptimization> persistentOptimization_;
   std::unique_ptr<PoseConstraintsChecker> constraintsChecker_;
 
 };
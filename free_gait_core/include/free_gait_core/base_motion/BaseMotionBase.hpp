@@ -11,8 +11,10 @@
 #include <free_gait_core/TypeDefs.hpp>
 #include <free_gait_core/executor/State.hpp>
 #include <free_gait_core/executor/AdapterBase.hpp>
+#include <free_gait_core/executor/FrameRegistry.hpp>
 #include <free_gait_core/step/Step.hpp>
 #include <free_gait_core/step/StepQueue.hpp>
+#include <free_gait_core/leg_motion/SampledTrajectory.hpp>
 
 #include <string>
 #include <memory>
@@ -56,7 +58,7 @@ class BaseMotionBase
    */
   BaseMotionBase::Type getType() const;
 
-  virtual const ControlSetup getControlSetup() const;
+  virtual const ControlSetup& getControlSetup() const;
 
   /*!
    * Update the trajectory with the base start pose.
@@ -82,11 +84,27 @@ class BaseMotionBase
    */
   virtual double getDuration() const;
 
+  /*!
+   * Sets the motion to be sampled uniformly once computed, afterwards it is
+   * evaluated by table lookup and interpolation (see SampledTrajectory for
+   * the error bounds). An already computed motion is sampled immediately.
+   * @param timeStep the maximum time between two samples, 0 for no sampling.
+   * @param interpolation the interpolation between the samples.
+   */
+  virtual void setSampling(const double timeStep, const SampleInterpolation interpolation);
+  virtual double getSamplingTimeStep() const;
+
   /*!
    * Returns the frame id base motion.
    * @return the frame id.
    */
-  virtual const std::string& getFrameId(const ControlLevel& controlLevel) const;
+  const std::string& getFrameId(const ControlLevel& controlLevel) const;
+
+  /*!
+   * Returns the handle of the frame id of the base motion (see FrameRegistry).
+   * @return the frame id handle.
+   */
+  virtual FrameId getFrameHandle(const ControlLevel& controlLevel) const;
 
   /*!
    * Evaluate the base pose at a given time.
@@ -105,6 +123,14 @@ class BaseMotionBase
   virtual Force evaluateForce(const double time) const;
   virtual Torque evaluateTorque(const double time) const;
 
+  /*!
+   * Evaluate the base pose and twist together.
+   * @param time the time to evaluate the motion at.
+   * @param pose the pose of the base in the defined frame id.
+   * @param twist the twist of the base in the defined frame id.
+   */
+  virtual void evaluate(const double time, Pose& pose, Twist& twist) const;
+
   /*!
    * Print the contents to console for debugging.
    * @param out the output stream.
@@ -32,7 +32,7 @@ class BaseTarget : public BaseMotionBase
    */
   std::unique_ptr<BaseMotionBase> clone() const;
 
-  const ControlSetup getControlSetup() const;
+  const ControlSetup& getControlSetup() const;
 
   /*!
    * Update the base motion with the base start pose.
@@ -58,7 +58,7 @@ class BaseTarget : public BaseMotionBase
    * Returns the frame id base motion.
    * @return the frame id.
    */
-  const std::string& getFrameId(const ControlLevel& controlLevel) const;
+  FrameId getFrameHandle(const ControlLevel& controlLevel) const;
 
   /*!
    * Evaluate the base motion pose at a given time.
@@ -94,7 +94,7 @@ class BaseTarget : public BaseMotionBase
 
   Pose start_;
   Pose target_;
-  std::string frameId_;
+  FrameId frameId_;
   double duration_;
   ControlSetup controlSetup_;
 
@@ -55,7 +55,7 @@ class BaseTrajectory : public BaseMotionBase
       const std::unordered_map<ControlLevel, std::vector<Time>, EnumClassHash>& times,
       const std::unordered_map<ControlLevel, std::vector<ValueType>, EnumClassHash>& values);
 
-  const ControlSetup getControlSetup() const;
+  const ControlSetup& getControlSetup() const;
 
   /*!
    * Update the trajectory with the base start pose.
@@ -80,7 +80,7 @@ class BaseTrajectory : public BaseMotionBase
    * Returns the frame id base motion.
    * @return the frame id.
    */
-  const std::string& getFrameId(const ControlLevel& controlLevel) const;
+  FrameId getFrameHandle(const ControlLevel& controlLevel) const;
 
   /*!
    * Evaluate the base motion at a given time.
@@ -115,7 +115,7 @@ class BaseTrajectory : public BaseMotionBase
   ControlSetup controlSetup_;
 
   //! Knots.
-  std::unordered_map<ControlLevel, std::string, EnumClassHash> frameIds_;
+  ControlLevelFrameIds frameIds_;
   std::unordered_map<ControlLevel, std::vector<Time>, EnumClassHash> times_;
   std::unordered_map<ControlLevel, std::vector<ValueType>, EnumClassHash> values_;
   std::unordered_map<ControlLevel, std::vector<DerivativeType>, EnumClassHash> derivatives_;
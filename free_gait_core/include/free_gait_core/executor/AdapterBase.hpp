@@ -9,8 +9,10 @@
 #pragma once
 
 #include "free_gait_core/executor/State.hpp"
+#include "free_gait_core/executor/FrameRegistry.hpp"
 #include "free_gait_core/step/StepQueue.hpp"
 
+#include <deque>
 #include <memory>
 #include <string>
 
@@ -25,6 +27,23 @@ class AdapterBase
   AdapterBase();
   virtual ~AdapterBase();
 
+  /*!
+   * Creates an independent copy of the adapter including its internal robot
+   * model, such that the copy can be modified (e.g. with setInternalDataFromState())
+   * concurrently to this adapter. Adapters that do not support copies return
+   * a null pointer, and users fall back to createCopyOfState()/resetToCopyOfState().
+   * @return the copy of the adapter or a null pointer if not supported.
+   */
+  virtual std::unique_ptr<AdapterBase> clone() const;
+
+  /*!
+   * Updates a copy created with clone() to the current internal data of this
+   * adapter, such that the copy can be reused instead of creating a new one.
+   * @param clone the copy of this adapter.
+   * @return true if successful, false if not supported (default).
+   */
+  virtual bool updateClone(AdapterBase& clone) const;
+
   //! Copying data from real robot to free gait state.
   virtual bool resetExtrasWithRobot(const StepQueue& stepQueue, State& state) = 0;
   virtual bool updateExtrasBefore(const StepQueue& stepQueue, State& state) = 0;
@@ -100,6 +119,37 @@ class AdapterBase
                                                          const LinearAcceleration& linearAcceleration) const;
   virtual Vector transformVector(const std::string& inputFrameId, const std::string& outputFrameId,
                                  const Vector& vector) const;
+
+  /*!
+   * Returns the registry of the frame ids for the transformations with
+   * interned frame ids. The registry is shared by all adapters.
+   * @return the frame registry.
+   */
+  FrameRegistry& getFrameRegistry() const;
+
+  /*!
+   * Transformations with interned frame ids (see getFrameRegistry()). The
+   * transforms of the frames to the world and base frame are cached until
+   * resetFrameTransformCache() is called or the base pose changes (e.g. with
+   * setInternalDataFromState()), such that they are computed once even if used
+   * for several limbs and control levels. The executor resets the cache in
+   * every advance, as the transforms of other frames (e.g. map) can change. The cache is not thread-safe and is only to
+   * be used by the thread advancing the executor. It holds the first block of
+   * frames of the registry and grows (allocates) when frames of further
+   * blocks are used for the first time.
+   */
+  void resetFrameTransformCache() const;
+  bool frameIdExists(const FrameId frameId) const;
+  Position transformPosition(const FrameId inputFrameId, const FrameId outputFrameId, const Position& position) const;
+  Pose transformPose(const FrameId inputFrameId, const FrameId outputFrameId, const Pose& pose) const;
+  Vector transformVector(const FrameId inputFrameId, const FrameId outputFrameId, const Vector& vector) const;
+  LinearVelocity transformLinearVelocity(const FrameId inputFrameId, const FrameId outputFrameId,
+                                         const LinearVelocity& linearVelocity) const;
+  LocalAngularVelocity transformAngularVelocity(const FrameId inputFrameId, const FrameId outputFrameId,
+                                                const LocalAngularVelocity& angularVelocity) const;
+  LinearAcceleration transformLinearAcceleration(const FrameId inputFrameId, const FrameId outputFrameId,
+                                                 const LinearAcceleration& linearAcceleration) const;
+
   virtual JointVelocitiesLeg getJointVelocitiesFromEndEffectorLinearVelocityInWorldFrame(
       const LimbEnum& limb, const LinearVelocity& endEffectorLinearVelocityInWorldFrame) const = 0;
   virtual LinearVelocity getEndEffectorLinearVelocityFromJointVelocities(const LimbEnum& limb,
@@ -113,6 +163,33 @@ class AdapterBase
                                         bool updateVelocity = true, bool updateAcceleration = false) const = 0;
   virtual void createCopyOfState() const = 0;
   virtual void resetToCopyOfState() const = 0;
+
+ private:
+  struct CachedFrameTransform
+  {
+    //! Cache tick of the transform, outdated if not equal to the tick of the cache.
+    uint64_t tick;
+    bool exists;
+    Pose transformToWorld;
+    Pose transformToBase;
+  };
+
+  /*!
+   * Returns the cached transform of a frame, computed if outdated.
+   * @param frameId the handle of the frame.
+   * @return the transform.
+   */
+  const CachedFrameTransform& getCachedFrameTransform(const FrameId frameId) const;
+  const CachedFrameTransform& getValidCachedFrameTransform(const FrameId frameId) const;
+
+  //! Cached transforms by frame handle, references stay valid when growing.
+  mutable std::deque<CachedFrameTransform> frameTransformCache_;
+  mutable uint64_t frameTransformCacheTick_;
+  //! Base pose for which the cached transforms were computed.
+  mutable Position cachedBasePosition_;
+  mutable RotationQuaternion cachedBaseOrientation_;
+  mutable FrameId worldFrameId_;
+  mutable FrameId baseFrameId_;
 };
 
 } /* namespace free_gait */
@@ -0,0 +1,98 @@
+/*
+ * AdaptiveTimeStepper.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#pragma once
+
+#include "free_gait_core/TypeDefs.hpp"
+#include "free_gait_core/executor/State.hpp"
+#include "free_gait_core/step/StepQueue.hpp"
+
+// Eigen
+#include <Eigen/Core>
+
+// STD
+#include <bitset>
+#include <string>
+
+namespace free_gait {
+
+/*!
+ * Chooses the time steps for simulating a step queue (see BatchExecutor),
+ * such that the number of samples scales with the complexity of the motion
+ * instead of its duration:
+ * - Events (ends of the leg motions, the base motion, and the step) are
+ *   sampled at their exact time.
+ * - After events (step switches and contact changes), the time step is
+ *   reset to the minimum time step.
+ * - Otherwise, the time step is chosen from the curvature of the base
+ *   position and the joint positions (second divided difference of the last
+ *   three samples), such that the deviation of the motion from the chords
+ *   between two samples is below the tolerance (h^2 / 8 * max|f''|). The
+ *   time step grows at most by the growth factor per sample.
+ */
+class AdaptiveTimeStepper
+{
+ public:
+  struct Parameters
+  {
+    Parameters()
+        : minTimeStep(0.001),
+          maxTimeStep(0.05),
+          tolerance(0.0005),
+          maxGrowthFactor(2.0)
+    {
+    }
+
+    //! Bounds of the time step [s].
+    double minTimeStep;
+    double maxTimeStep;
+    //! Tolerated deviation from the chords between samples [m, rad].
+    double tolerance;
+    //! Maximum increase of the time step from one sample to the next.
+    double maxGrowthFactor;
+  };
+
+  AdaptiveTimeStepper(const Parameters& parameters = Parameters());
+  virtual ~AdaptiveTimeStepper();
+
+  const Parameters& getParameters() const;
+
+  /*!
+   * Resets the stepper for a new simulation.
+   */
+  void reset();
+
+  /*!
+   * Returns the time step for the next advance of the step queue.
+   * @param queue the step queue before the advance.
+   * @return the time step [s].
+   */
+  double getTimeStep(const StepQueue& queue) const;
+
+  /*!
+   * Updates the stepper with the state after an advance.
+   * @param timeStep the time step of the advance [s].
+   * @param state the state after the advance.
+   */
+  void update(const double timeStep, const State& state);
+
+ private:
+  Parameters parameters_;
+
+  //! Time step from the curvature [s].
+  double timeStep_;
+
+  //! Last samples since the last event.
+  size_t nSamples_;
+  Eigen::VectorXd values_;
+  Eigen::VectorXd previousValues_;
+  double previousTimeStep_;
+  std::bitset<nLimbs> supportLegs_;
+  std::string stepId_;
+};
+
+} /* namespace free_gait */
@@ -9,39 +9,247 @@
 #pragma once
 
 #include "free_gait_core/executor/Executor.hpp"
+#include "free_gait_core/executor/AdaptiveTimeStepper.hpp"
 #include "free_gait_core/executor/AdapterBase.hpp"
 #include "free_gait_core/executor/StateBatch.hpp"
+#include "free_gait_core/executor/StateBatchComputer.hpp"
+#include "free_gait_core/executor/StateBatchStream.hpp"
 
 #include <thread>
 #include <memory>
 #include <functional>
 #include <atomic>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <vector>
 
 namespace free_gait {
 
+/*!
+ * Simulates step sequences with an executor and records the states in a
+ * state batch. The requests are processed one after another by a persistent
+ * worker thread. A new request supersedes the request that is waiting to be
+ * processed and cancels the request that is being processed, such that the
+ * latest request wins without piling up work.
+ */
 class BatchExecutor
 {
  public:
+  typedef std::function<std::unique_ptr<AdapterBase>()> AdapterFactory;
+
   BatchExecutor(free_gait::Executor& executor);
   virtual ~BatchExecutor();
 
+  /*!
+   * Sets the callback which is called from the worker thread after each
+   * request with true if the request was processed completely and false if it
+   * was cancelled. The state batch can be accessed in the callback. Can be
+   * called from any thread, the callback is applied from the next request on.
+   * @param callback the callback.
+   */
   void addProcessingCallback(std::function<void(bool)> callback);
   void setTimeStep(const double timeStep);
   double getTimeStep() const;
+
+  /*!
+   * Enables adaptive time stepping (see AdaptiveTimeStepper) instead of the
+   * fixed time step, such that smooth motions are sampled sparsely and the
+   * events of the steps are sampled at their exact times. The states of the
+   * batch are then at non-uniform times.
+   * @param isAdaptive true for adaptive time stepping.
+   * @param parameters the parameters of the adaptive time stepping.
+   */
+  void setAdaptiveTimeStep(const bool isAdaptive,
+                           const AdaptiveTimeStepper::Parameters& parameters = AdaptiveTimeStepper::Parameters());
+  bool isAdaptiveTimeStep() const;
+
+  /*!
+   * Sets the factory for the adapters used in parallel processing. The step
+   * sequence is split into segments at full stance (all legs in support),
+   * and the segments are simulated on separate executors with adapters
+   * created by the factory. The adapters are set to the start state of their
+   * segment with `setInternalDataFromState()`. Without factory, copies of
+   * the executor's adapter are used if the adapter supports `clone()`. The
+   * adapters are created once (one per thread) and reused for later requests.
+   * @param adapterFactory the function to create an adapter per segment.
+   */
+  void setAdapterFactory(AdapterFactory adapterFactory);
+
+  /*!
+   * Sets the number of worker threads for parallel processing (default: 1).
+   * With one thread (or if no adapters can be created), the steps are
+   * processed serially. In parallel processing, the steps are first completed
+   * serially in a skeleton pass, which jumps to the last time step of each
+   * step, and the segments then simulate the completed steps concurrently.
+   * Parallel processing pays off for long step sequences with cheap
+   * completions, the completions (e.g. of BaseAuto motions) are not sped up.
+   * @param nThreads the number of threads.
+   */
+  void setNumberOfThreads(const size_t nThreads);
+  size_t getNumberOfThreads() const;
+
+  /*!
+   * Enables the computation of the derived data of the state batch (see
+   * StateBatchComputer). The data is updated while the states are added,
+   * with a separate adapter (see setAdapterFactory()) such that the
+   * simulation is not affected. If no separate adapter can be created, the
+   * data is computed with the executor's adapter after the simulation.
+   * @param computeDerivedData true if the derived data should be computed.
+   */
+  void setComputeDerivedData(const bool computeDerivedData);
+
+  /*!
+   * Enables the streaming of the states in chunks while processing (see
+   * getStream()), such that consumers can use the first states before the
+   * whole sequence is simulated. A chunk is published whenever the step
+   * changes (chunk duration of zero) or the chunk spans the chunk duration.
+   * With parallel processing, the states of a segment are published as soon
+   * as all previous segments are simulated. The chunks contain the derived
+   * data if it is computed during processing (see setComputeDerivedData()).
+   * @param isStreaming true if the states should be streamed.
+   * @param chunkDuration the simulated duration of a chunk [s], zero for one chunk per step.
+   */
+  void setStreaming(const bool isStreaming, const double chunkDuration = 0.0);
+
+  /*!
+   * Sets a callback which is called from the processing thread for each
+   * published chunk (see setStreaming()). Can be called from any thread, the
+   * callback is applied from the next request on.
+   * @param callback the callback.
+   */
+  void addChunkCallback(std::function<void(const StateBatchStream::Chunk&)> callback);
+
+  /*!
+   * Returns the stream of the current (or last) processing, which can be
+   * read from any thread during processing. Without streaming, the stream
+   * contains no chunks and is closed at the end of the processing.
+   * @return the stream.
+   */
+  std::shared_ptr<const StateBatchStream> getStream() const;
+
+  /*!
+   * Requests the processing of a step sequence. A waiting request is
+   * superseded and a request in processing is cancelled (cooperatively, at
+   * the next simulation step).
+   * @param steps the steps to process.
+   * @return the future result, true if the steps were processed completely,
+   *         false if the request was superseded or cancelled. The result is
+   *         set after the processing callback has returned.
+   */
+  std::future<bool> submit(const std::vector<free_gait::Step>& steps);
+
+  /*!
+   * Requests the processing of a step sequence (see submit()). The result is
+   * reported to the processing callback (see addProcessingCallback()).
+   * @return true if the request was added, false if the batch executor is
+   *         shutting down.
+   */
   bool process(const std::vector<free_gait::Step>& steps);
+
+  /*!
+   * @return true if a request is processed or waiting to be processed.
+   */
   bool isProcessing();
+
+  /*!
+   * Cancels the request in processing and the waiting request.
+   */
   void cancelProcessing();
 
+  /*!
+   * Returns the state batch of the last request. The reference is valid
+   * until the next request is processed, i.e. it is safe to use in the
+   * processing callback or if no request is submitted meanwhile.
+   * Throws if a request is being processed.
+   * @return the state batch.
+   */
   const StateBatch& getStateBatch() const;
 
+  /*!
+   * Moves the state batch out of the batch executor, which avoids the copy
+   * of getStateBatch(). The state batch of the batch executor is empty afterwards.
+   * Throws if a request is being processed.
+   * @return the state batch.
+   */
+  StateBatch takeStateBatch();
+
  private:
-  void processInThread();
+  //! Part of the step sequence that starts at full stance.
+  struct Segment
+  {
+    size_t firstStep;
+    size_t nSteps;
+    //! State at the last time step before the first step of the segment.
+    State startState;
+    std::unique_ptr<Step> previousStep;
+    StateBatch stateBatch;
+    double duration;
+  };
+
+  //! Request to process a step sequence.
+  struct Job
+  {
+    std::vector<Step> steps;
+    std::promise<bool> result;
+  };
+
+  bool addJob(std::unique_ptr<Job> job);
+  void runWorker();
+  bool processJob(const std::vector<Step>& steps);
+  void processSerially();
+  void processInParallel();
+  bool createSegmentAdapters();
+  void processAddedStates();
+  void publishStates(const bool isFinal);
+  size_t findChunkEnd();
+  bool computeSegments(std::vector<std::unique_ptr<Segment>>& segments);
+  void processSegment(Segment& segment, AdapterBase& adapter, const bool isLastSegment) const;
+  bool isStanceBoundary(const State& state) const;
+  std::unique_ptr<AdapterBase> createAdapter() const;
 
   StateBatch stateBatch_;
   free_gait::Executor& executor_;
+  std::vector<Step> steps_;
+  //! Steps as completed by the skeleton pass (see computeSegments()).
+  std::vector<Step> completedSteps_;
+  AdapterFactory adapterFactory_;
+  size_t nThreads_;
+  bool computeDerivedData_;
+  std::unique_ptr<AdapterBase> derivedDataAdapter_;
+  //! Adapters for the simulation of the segments, one per thread.
+  std::vector<std::unique_ptr<AdapterBase>> segmentAdapters_;
+  std::unique_ptr<StateBatchComputer> stateBatchComputer_;
 
+  // Streaming.
+  bool isStreaming_;
+  double chunkDuration_;
+  //! Set under the job mutex, copied to processingChunkCallback_ for each request.
+  std::function<void(const StateBatchStream::Chunk&)> chunkCallback_;
+  //! Chunk callback of the current request, only used by the worker.
+  std::function<void(const StateBatchStream::Chunk&)> processingChunkCallback_;
+  std::shared_ptr<StateBatchStream> stream_;
+  mutable std::mutex streamMutex_;
+  size_t nPublishedStates_;
+  //! Index from which the end of the next chunk is searched.
+  size_t chunkSearchIndex_;
+
+  //! Set under the job mutex.
   std::function<void(bool)> callback_;
   double timeStep_;
+  bool isAdaptiveTimeStep_;
+  AdaptiveTimeStepper::Parameters adaptiveTimeStepParameters_;
+
+  // Worker.
+  std::thread worker_;
+  mutable std::mutex jobMutex_;
+  std::condition_variable jobCondition_;
+  //! Request waiting to be processed, newer requests supersede it.
+  std::unique_ptr<Job> waitingJob_;
+  bool isShuttingDown_;
+  //! True while a request is simulated (the state batch is written),
+  //! changed only under the job mutex.
+  std::atomic<bool> isRunningJob_;
   std::atomic<bool> isProcessing_;
   std::atomic<bool> requestForCancelling_;
 };
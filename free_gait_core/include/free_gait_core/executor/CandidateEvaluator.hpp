@@ -0,0 +1,123 @@
+/*
+ * CandidateEvaluator.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#pragma once
+
+#include "free_gait_core/TypeDefs.hpp"
+#include "free_gait_core/executor/AdapterBase.hpp"
+#include "free_gait_core/executor/State.hpp"
+#include "free_gait_core/executor/StateBatch.hpp"
+#include "free_gait_core/step/Step.hpp"
+#include "free_gait_core/step/StepCompleter.hpp"
+
+// STD
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace free_gait {
+
+/*!
+ * Evaluates alternative step sequences (candidates, e.g. of a footstep
+ * planner) by simulating them from a common start state. The candidates are
+ * simulated concurrently, each with its own executor on an independent
+ * adapter clone, and summarized by a few scalar measures for comparison.
+ */
+class CandidateEvaluator
+{
+ public:
+  typedef std::function<std::unique_ptr<AdapterBase>()> AdapterFactory;
+
+  //! Outcome of the simulation of a candidate.
+  struct Summary
+  {
+    Summary();
+
+    //! True if the candidate was simulated completely.
+    bool isValid;
+    //! Simulated duration [s].
+    double duration;
+    //! Minimum signed distance of the center of mass (projected on the
+    //! horizontal plane) to the edges of the support polygon over the
+    //! simulation [m], negative if outside (e.g. with less than three
+    //! support legs).
+    double stabilityMargin;
+    //! Minimum distance of the joint positions to the joint limits over the
+    //! simulation [rad], negative if a limit is exceeded. Infinite if no
+    //! joint limits are set.
+    double jointLimitMargin;
+  };
+
+  /*!
+   * Constructor.
+   * @param adapter the adapter which is cloned for the simulations (see
+   *        AdapterBase::clone()), unless an adapter factory is set.
+   * @param parameters the step parameters for the completion of the steps.
+   */
+  CandidateEvaluator(const AdapterBase& adapter, const StepParameters& parameters);
+  virtual ~CandidateEvaluator();
+
+  void setTimeStep(const double timeStep);
+  double getTimeStep() const;
+
+  /*!
+   * Sets the factory for the adapters of the simulations (default: clones
+   * of the adapter).
+   */
+  void setAdapterFactory(AdapterFactory adapterFactory);
+
+  /*!
+   * Sets the maximum number of threads (default: number of cores).
+   */
+  void setNumberOfThreads(const size_t nThreads);
+  size_t getNumberOfThreads() const;
+
+  /*!
+   * Sets the joint limits for the joint limit margin of the summaries.
+   * @param minJointPositions the lower joint limits.
+   * @param maxJointPositions the upper joint limits.
+   */
+  void setJointLimits(const JointPositions& minJointPositions, const JointPositions& maxJointPositions);
+
+  /*!
+   * Simulates the candidates from the start state.
+   * @param candidates the step sequences.
+   * @param startState the start state (initialized for the limbs of the adapter).
+   * @param summaries the summaries of the candidates (in the order of the candidates).
+   * @param stateBatches the state batches of the candidates, recorded only if
+   *        not null.
+   * @return true if all candidates were simulated completely, false otherwise
+   *         (also if the adapters could not be created).
+   */
+  bool evaluate(const std::vector<std::vector<Step>>& candidates, const State& startState,
+                std::vector<Summary>& summaries, std::vector<StateBatch>* stateBatches = nullptr) const;
+
+  /*!
+   * Computes the signed distance of a point to the convex hull of the
+   * footholds (in the horizontal plane), negative if outside.
+   * @param footholds the positions of the footholds.
+   * @param point the point.
+   * @return the signed distance, -infinity if there are no footholds.
+   */
+  static double computeSupportMargin(const std::vector<Position>& footholds, const Position& point);
+
+ private:
+  void evaluateCandidate(const std::vector<Step>& steps, const State& startState, AdapterBase& simulationAdapter,
+                         AdapterBase& evaluationAdapter, Summary& summary, StateBatch* stateBatch) const;
+  std::unique_ptr<AdapterBase> createAdapter() const;
+
+  const AdapterBase& adapter_;
+  StepParameters parameters_;
+  AdapterFactory adapterFactory_;
+  size_t nThreads_;
+  double timeStep_;
+  bool hasJointLimits_;
+  JointPositions minJointPositions_;
+  JointPositions maxJointPositions_;
+};
+
+} /* namespace free_gait */
@@ -11,15 +11,22 @@
 #include <free_gait_core/executor/AdapterBase.hpp>
 #include "free_gait_core/TypeDefs.hpp"
 #include "free_gait_core/executor/State.hpp"
+#include "free_gait_core/executor/ExecutorFeedback.hpp"
+#include "free_gait_core/executor/ExecutorProfiler.hpp"
+#include "free_gait_core/executor/ExecutorSnapshot.hpp"
+#include "free_gait_core/executor/TripleBuffer.hpp"
+#include "free_gait_core/leg_motion/LegMotionVariant.hpp"
 #include "free_gait_core/step/StepQueue.hpp"
 #include "free_gait_core/step/StepCompleter.hpp"
 #include "free_gait_core/step/StepComputer.hpp"
 
-// Robot utils
-#include <std_utils/timers/ChronoTimer.hpp>
-
 // STD
+#include <array>
+#include <atomic>
+#include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 
 // Boost
@@ -27,6 +34,9 @@
 
 namespace free_gait {
 
+class SpeculativeStepCompleter;
+class ExecutorCommandQueue;
+
 class Executor
 {
  public:
@@ -47,7 +57,8 @@ class Executor
   Mutex& getMutex();
 
   /*!
-   * Advance in time
+   * Advance in time. Processes the commands of the command queue first and
+   * publishes a snapshot at the end.
    * @param dt the time step to advance [s].
    * @return true if successful, false otherwise.
    */
@@ -55,13 +66,19 @@ class Executor
   void pause(bool shouldPause);
 
   /*!
-   * Stop the execution. Depending on the preemption type.
+   * Stop the execution. Depending on the preemption type. The stop is queued
+   * as command (see getCommandQueue()) and applied at the next advance(),
+   * such that the caller does not lock the executor.
+   * @return true if successful, false if the command queue is full.
    */
-  void stop();
+  bool stop();
 
-  void addToFeedback(const std::string& feedbackDescription);
-  const std::string& getFeedbackDescription() const;
-  void clearFeedbackDescription();
+  /*!
+   * Returns the feedback events of the executor. The events can be read
+   * from other threads without locking the executor.
+   * @return the feedback events.
+   */
+  const ExecutorFeedbackRing& getFeedback() const;
 
   void reset();
 
@@ -73,9 +90,23 @@ class Executor
    * @return
    */
   StepQueue& getQueue();
+
+  /*!
+   * Note: The state is modified by advance(). To read it from other threads,
+   * use the snapshots (see getSnapshot() and createSnapshotReader()).
+   * @return the state.
+   */
   const State& getState() const;
   const AdapterBase& getAdapter() const;
 
+  /*!
+   * Note: The adapter is used by advance(), changing its internal data
+   * (e.g. with `setInternalDataFromState()`) affects the execution.
+   * @return the adapter.
+   */
+  AdapterBase& getAdapter();
+  const StepCompleter& getCompleter() const;
+
   enum class PreemptionType {
     PREEMPT_IMMEDIATE,
     PREEMPT_STEP,
@@ -84,8 +115,110 @@ class Executor
 
   void setPreemptionType(const PreemptionType& type);
 
+  /*!
+   * Enables the speculative completion of the next step in the background
+   * (see SpeculativeStepCompleter). Requires an adapter which supports copies.
+   * @param speculativeCompletion true if speculative completion should be enabled.
+   * @return true if successful, false otherwise.
+   */
+  bool setSpeculativeCompletion(const bool speculativeCompletion);
+  bool hasSpeculativeCompletion() const;
+
+  /*!
+   * Blocks until the started speculative completion is done.
+   * @param timeout the max. time to wait [s].
+   * @return true if no speculative completion is running, false if the
+   *         timeout has passed.
+   */
+  bool waitForSpeculativeCompletion(const double timeout) const;
+
+  /*!
+   * Sets the tolerance for reusing precomputed or speculatively completed steps.
+   * If the computer looks ahead (see StepComputer::getLookahead()), upcoming
+   * steps are completed from a predicted start state and computed in the
+   * background. At the step switch, the precomputed step is only used if the
+   * actual state matches the predicted state within this tolerance.
+   * @param tolerance the tolerance [rad] (and [m] for speculative completion).
+   */
+  void setPrecomputationTolerance(const double tolerance);
+  double getPrecomputationTolerance() const;
+
+  /*!
+   * Enables the measurement of the durations of the phases of the advance
+   * (see ExecutorProfiler). Disabled by default.
+   * @param profiling true if profiling should be enabled.
+   */
+  void setProfiling(const bool profiling);
+  bool isProfiling() const;
+
+  /*!
+   * Returns the latency statistics of the advance. The statistics can be
+   * queried without locking the executor.
+   * @return the profiler.
+   */
+  const ExecutorProfiler& getProfiler() const;
+
+  /*!
+   * Returns the queue for commands from other threads. The commands are
+   * processed at the start of the next advance, such that other threads do
+   * not need to lock the executor (see ExecutorCommandQueue).
+   * @return the command queue.
+   */
+  ExecutorCommandQueue& getCommandQueue();
+
+  /*!
+   * Copies the latest snapshot published by advance(). Reading the snapshot
+   * never blocks the advance of the executor, but concurrent calls of this
+   * method are serialized. Use a snapshot reader to read without waiting.
+   * @param snapshot the snapshot.
+   */
+  void getSnapshot(ExecutorSnapshot& snapshot) const;
+
+  /*!
+   * Creates a reader with its own snapshot buffer, such that the snapshots
+   * can be read wait-free at the rate of the reader. Each reader adds a copy
+   * of the snapshot to each advance. The reader has to be destroyed before
+   * the executor.
+   * @return the reader, nullptr if the maximal number of readers is reached.
+   */
+  std::unique_ptr<ExecutorSnapshotReader> createSnapshotReader();
+
  private:
+  //! Predicted start state of a precomputed step.
+  struct PredictedStartState
+  {
+    //! Identifies the queued step, as step ids can be reused (see Step::getSequenceNumber()).
+    uint64_t sequenceNumber;
+    State state;
+  };
+  typedef std::map<std::string, PredictedStartState, std::less<std::string>,
+      Eigen::aligned_allocator<std::pair<const std::string, PredictedStartState>>> PredictedStates;
+
+  bool advanceQueue(double dt, bool skipStateMeasurmentUpdate);
+  void processCommands();
+  void preempt();
+  void publishSnapshot();
+  void updateSnapshot(ExecutorSnapshot& snapshot) const;
   bool completeCurrentStep(bool multiThreaded = false);
+  bool completeStep(Step& step);
+
+  /*!
+   * Collects the result of the computer for a step or, if the computer is
+   * free, hands the step over for computation. Never waits for the computer.
+   * @param step the step to compute.
+   * @return true if successful, false otherwise.
+   */
+  bool updateComputation(Step& step);
+  bool precomputeNextSteps();
+
+  /*!
+   * Discards the precomputations and speculations of upcoming steps. Called
+   * whenever the queue is changed other than by advancing.
+   */
+  void clearPrecomputations();
+  bool isStartStatePredictable(const size_t stepIndex) const;
+  void predictStartState(const size_t stepIndex, State& state) const;
+  bool isValidPrediction(const Step& step, const State& predictedState) const;
   bool resetStateWithRobot();
   bool updateStateWithMeasurements();
   bool writeIgnoreContact();
@@ -96,6 +229,13 @@ class Executor
   bool writeTorsoMotion();
   bool writeStepId();
 
+  /*!
+   * Resolves the types of the leg motions of a step, such that the motions
+   * are evaluated without dynamic dispatch in every advance.
+   * @param step the step.
+   */
+  void resolveLegMotions(const Step& step);
+
   Mutex mutex_;
   bool isInitialized_;
   bool isReset_;
@@ -106,8 +246,36 @@ class Executor
   StepComputer& computer_;
   AdapterBase& adapter_;
   State& state_;
-  std::string feedbackDescription_;
-  bool firstFeedbackDescription_;
+  ExecutorFeedbackRing feedback_;
+
+  //! Id of the current step if it needs computation.
+  std::string computationStepId_;
+  //! True if the current step has been handed over to the computer.
+  bool isComputingStep_;
+
+  //! Leg motions of the current step by limb (see resolveLegMotions()).
+  bool areLegMotionsResolved_;
+  std::array<LegMotionVariant, nLimbs> legMotions_;
+
+  //! Interned world and base frame ids of the adapter.
+  FrameId worldFrameId_;
+  FrameId baseFrameId_;
+
+  //! Predicted start states of the precomputed steps by step id.
+  PredictedStates predictedStartStates_;
+  Step precomputedStep_;
+  double precomputationTolerance_;
+  std::unique_ptr<SpeculativeStepCompleter> speculativeCompleter_;
+  ExecutorProfiler profiler_;
+
+  std::unique_ptr<ExecutorCommandQueue> commandQueue_;
+  mutable TripleBuffer<ExecutorSnapshot> snapshots_;
+  //! Serializes the readers of the snapshot, never taken by the executor.
+  mutable std::mutex snapshotReaderMutex_;
+  //! Buffers of the snapshot readers, created on demand and kept until destruction.
+  static constexpr size_t maxSnapshotReaders_ = 8;
+  std::array<std::unique_ptr<ExecutorSnapshotChannel>, maxSnapshotReaders_> snapshotChannels_;
+  std::array<std::atomic<ExecutorSnapshotChannel*>, maxSnapshotReaders_> snapshotChannelPointers_;
 };
 
 } /* namespace free_gait */
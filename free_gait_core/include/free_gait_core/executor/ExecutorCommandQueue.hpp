@@ -0,0 +1,95 @@
+/*
+ * ExecutorCommandQueue.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#pragma once
+
+#include "free_gait_core/executor/Executor.hpp"
+#include "free_gait_core/step/Step.hpp"
+
+// STD
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace free_gait {
+
+/*!
+ * Command to the executor from another thread.
+ */
+struct ExecutorCommand
+{
+  enum class Type
+  {
+    AddSteps,
+    Stop,
+    Pause,
+    SetPreemptionType
+  };
+
+  ExecutorCommand();
+  static ExecutorCommand addSteps(const std::vector<Step>& steps, const bool replaceLastBaseAuto = false);
+  static ExecutorCommand stop();
+  static ExecutorCommand pause(const bool shouldPause);
+  static ExecutorCommand setPreemptionType(const Executor::PreemptionType& preemptionType);
+
+  Type type;
+  std::vector<Step> steps;
+  //! If the last step in the queue is a pure BaseAuto step, it is replaced by the new steps.
+  bool replaceLastBaseAuto;
+  bool shouldPause;
+  Executor::PreemptionType preemptionType;
+};
+
+/*!
+ * Fixed-capacity queue of commands to the executor. The executor processes
+ * the commands at the start of Executor::advance() without locks, such that
+ * other threads (e.g. the action server) do not need to lock the executor.
+ * Pushing commands from several threads is serialized with a mutex, which is
+ * never taken by the executor. The commands are copied when pushed, and the
+ * memory of processed commands is released by the pushing threads.
+ */
+class ExecutorCommandQueue
+{
+ public:
+  static constexpr size_t capacity = 16;
+
+  ExecutorCommandQueue();
+  virtual ~ExecutorCommandQueue();
+
+  /*!
+   * Adds a command (producers).
+   * @param command the command.
+   * @return true if successful, false if the queue is full.
+   */
+  bool push(const ExecutorCommand& command);
+
+  /*!
+   * Returns the next command (executor only).
+   * @return the command, nullptr if the queue is empty.
+   */
+  const ExecutorCommand* front() const;
+
+  /*!
+   * Removes the next command (executor only).
+   */
+  void pop();
+
+  //! Total number of pushed and processed (popped) commands.
+  uint64_t getNumberOfPushedCommands() const;
+  uint64_t getNumberOfProcessedCommands() const;
+
+ private:
+  std::array<ExecutorCommand, capacity> commands_;
+  std::mutex producerMutex_;
+  //! Monotonic counters, the slot index is the counter modulo capacity.
+  std::atomic<uint64_t> head_;
+  std::atomic<uint64_t> tail_;
+};
+
+} /* namespace free_gait */
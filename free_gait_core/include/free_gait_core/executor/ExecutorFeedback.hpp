@@ -0,0 +1,138 @@
+/*
+ * ExecutorFeedback.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#pragma once
+
+#include "free_gait_core/TypeDefs.hpp"
+
+// STD
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+namespace free_gait {
+
+/*!
+ * Feedback event of the executor. Events are stored without formatting,
+ * such that adding feedback in the advance of the executor is cheap and does
+ * not allocate. The text is generated by the consumer (see operator<<).
+ */
+struct ExecutorFeedbackEvent
+{
+  enum class Type
+  {
+    StepStarted,
+    Paused,
+    RobotNotOk,
+    Resumed,
+    StopRequested,
+    ComputationStarted,
+    UsingPrecomputedStep,
+    UsingSpeculativeStep,
+    RejectedSpeculativeStep,
+    Error
+  };
+
+  enum class ErrorCode
+  {
+    None,
+    CompletionFailed,
+    ComputationFailed,
+    PrecomputationFailed,
+    FrameNotFound,
+    InverseKinematicsFailed
+  };
+
+  //! Max. length of the stored step id, longer ids are truncated.
+  static constexpr size_t maxStepIdLength = 63;
+
+  ExecutorFeedbackEvent();
+
+  /*!
+   * Sets the step id without allocating memory.
+   * @param id the step id.
+   */
+  void setStepId(const std::string& id);
+  const char* getStepId() const;
+  bool hasStepId() const;
+
+  Type type;
+  ErrorCode errorCode;
+  //! Limb of the error, if hasLimb.
+  bool hasLimb;
+  LimbEnum limb;
+  std::array<char, maxStepIdLength + 1> stepId;
+};
+
+/*!
+ * Formats the feedback event as human readable description.
+ */
+std::ostream& operator<<(std::ostream& out, const ExecutorFeedbackEvent& event);
+std::ostream& operator<<(std::ostream& out, const ExecutorFeedbackEvent::ErrorCode& errorCode);
+
+/*!
+ * Fixed-capacity ring buffer of the feedback events of the executor. The
+ * executor is the single producer and never waits: when the ring is full,
+ * the oldest event is overwritten. Any number of consumers can read the
+ * events wait-free, each with its own sequence number of the last read
+ * event. Events overwritten before being read are reported as dropped.
+ */
+class ExecutorFeedbackRing
+{
+ public:
+  static constexpr size_t capacity = 64;
+
+  ExecutorFeedbackRing();
+  virtual ~ExecutorFeedbackRing();
+
+  /*!
+   * Adds an event (executor only).
+   * @param type the type of the event.
+   * @param stepId the id of the concerned step (optional).
+   */
+  void push(const ExecutorFeedbackEvent::Type type, const std::string& stepId = "");
+
+  /*!
+   * Adds an error event (executor only).
+   * @param errorCode the error code.
+   * @param stepId the id of the concerned step.
+   */
+  void pushError(const ExecutorFeedbackEvent::ErrorCode errorCode, const std::string& stepId);
+  void pushError(const ExecutorFeedbackEvent::ErrorCode errorCode, const std::string& stepId, const LimbEnum& limb);
+
+  /*!
+   * Reads the next event after the given sequence number (consumers).
+   * @param sequence the sequence number of the last read event, is set to
+   *        the sequence number of the read event.
+   * @param event the read event.
+   * @param nDropped the number of events which have been overwritten before
+   *        they could be read.
+   * @return true if an event has been read, false if no newer event exists.
+   */
+  bool read(uint64_t& sequence, ExecutorFeedbackEvent& event, uint64_t& nDropped) const;
+
+  //! Sequence number of the last added event (0 if none).
+  uint64_t getSequence() const;
+
+ private:
+  struct Slot
+  {
+    //! Sequence number of the stored event, 0 while the event is written.
+    std::atomic<uint64_t> sequence;
+    ExecutorFeedbackEvent event;
+  };
+
+  ExecutorFeedbackEvent& beginPush();
+  void endPush();
+
+  std::array<Slot, capacity> slots_;
+  std::atomic<uint64_t> sequence_;
+};
+
+} /* namespace free_gait */
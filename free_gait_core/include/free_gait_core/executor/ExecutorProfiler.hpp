@@ -0,0 +1,134 @@
+/*
+ * ExecutorProfiler.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#pragma once
+
+#include "free_gait_core/executor/LatencyHistogram.hpp"
+
+// STD
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <string>
+
+namespace free_gait {
+
+class Step;
+
+/*!
+ * Measures the durations of the phases of `Executor::advance()` in rolling
+ * latency histograms per phase and step type. Measuring does not allocate
+ * memory and only reads the clock once per phase. The statistics can be
+ * queried from any thread.
+ */
+class ExecutorProfiler
+{
+ public:
+  typedef std::chrono::steady_clock Clock;
+
+  enum class Phase
+  {
+    ProcessCommands,
+    UpdateStateWithMeasurements,
+    UpdateComputation,
+    AdvanceQueue,
+    UpdateExtrasBefore,
+    CompleteStep,
+    WriteIgnoreContact,
+    WriteIgnoreForPoseAdaptation,
+    WriteSupportLegs,
+    WriteSurfaceNormals,
+    WriteLegMotion,
+    WriteTorsoMotion,
+    WriteStepId,
+    UpdateExtrasAfter,
+    PrecomputeNextSteps,
+    PublishSnapshot,
+    //! The entire advance.
+    Advance,
+    //! The entire advance, only for advances which failed.
+    FailedAdvance,
+    Size
+  };
+
+  enum class StepType
+  {
+    //! No active step.
+    None,
+    //! Step with leg motions only.
+    LegMotion,
+    BaseAuto,
+    BaseTarget,
+    BaseTrajectory,
+    Size
+  };
+
+  static constexpr size_t nPhases = static_cast<size_t>(Phase::Size);
+  static constexpr size_t nStepTypes = static_cast<size_t>(StepType::Size);
+
+  ExecutorProfiler();
+  virtual ~ExecutorProfiler();
+
+  void setEnabled(const bool enabled);
+  bool isEnabled() const;
+
+  /*!
+   * Starts the measurement of an advance of the executor and its first phase.
+   */
+  void startAdvance();
+
+  /*!
+   * Ends the measurement of a phase and starts the next phase. Phases which
+   * are run several times in one advance are summed up.
+   * @param phase the phase.
+   */
+  void endPhase(const Phase& phase);
+
+  /*!
+   * Ends the measurement of an advance and adds the durations of the phases
+   * to the histograms. Failed advances are added to the Advance and
+   * FailedAdvance histograms, the phases run until the failure are added too.
+   * @param stepType the type of the step of the advance.
+   * @param isSuccessful true if the advance was successful, false otherwise.
+   */
+  void endAdvance(const StepType& stepType, const bool isSuccessful = true);
+
+  /*!
+   * Removes all measurements. Only to be called from the executor thread.
+   */
+  void clear();
+
+  /*!
+   * Returns the statistics of a phase over all step types.
+   * @param phase the phase.
+   * @return the statistics.
+   */
+  LatencyHistogram::Statistics getStatistics(const Phase& phase) const;
+
+  /*!
+   * Returns the statistics of a phase for steps of a type.
+   * @param phase the phase.
+   * @param stepType the step type.
+   * @return the statistics.
+   */
+  LatencyHistogram::Statistics getStatistics(const Phase& phase, const StepType& stepType) const;
+
+  static StepType getStepType(const Step& step);
+  static const std::string& getPhaseName(const Phase& phase);
+  static const std::string& getStepTypeName(const StepType& stepType);
+
+ private:
+  std::atomic<bool> isEnabled_;
+  bool isMeasuring_;
+  Clock::time_point startTime_;
+  Clock::time_point phaseStartTime_;
+  //! Durations of the phases of the current advance [ns], negative if not run.
+  std::array<int64_t, nPhases> durations_;
+  std::array<std::array<LatencyHistogram, nStepTypes>, nPhases> histograms_;
+};
+
+} /* namespace free_gait */
@@ -0,0 +1,90 @@
+/*
+ * ExecutorSnapshot.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#pragma once
+
+#include "free_gait_core/TypeDefs.hpp"
+#include "free_gait_core/executor/State.hpp"
+#include "free_gait_core/executor/TripleBuffer.hpp"
+
+// STD
+#include <atomic>
+#include <bitset>
+#include <cstdint>
+#include <string>
+
+namespace free_gait {
+
+/*!
+ * Read-only copy of the executor data for monitoring, published by the
+ * executor once per advance (see Executor::getSnapshot() and
+ * Executor::createSnapshotReader()).
+ */
+struct ExecutorSnapshot
+{
+  ExecutorSnapshot();
+
+  //! Number of commands which have been processed (see ExecutorCommandQueue).
+  uint64_t nProcessedCommands;
+  size_t queueSize;
+  bool isQueueActive;
+  bool robotExecutionStatus;
+
+  //! Current step (if queue is active).
+  std::string stepId;
+  double stepDuration;
+  double stepPhase;
+  //! Branches with a motion in the current step.
+  std::bitset<nLimbs> activeLimbs;
+  bool isBaseActive;
+
+  //! State of the executor at the end of the advance.
+  State state;
+
+  //! Sequence number of the last feedback event (see Executor::getFeedback()).
+  uint64_t feedbackSequence;
+};
+
+/*!
+ * Buffer of the snapshots for one reader.
+ */
+struct ExecutorSnapshotChannel
+{
+  ExecutorSnapshotChannel();
+  TripleBuffer<ExecutorSnapshot> buffer;
+  std::atomic<bool> isUsed;
+};
+
+/*!
+ * Reader of the executor snapshots with its own buffer, such that readers
+ * never wait for the executor or for each other. Has to be destroyed before
+ * the executor.
+ */
+class ExecutorSnapshotReader
+{
+ public:
+  ExecutorSnapshotReader(ExecutorSnapshotChannel& channel);
+  virtual ~ExecutorSnapshotReader();
+
+  /*!
+   * Takes over the latest snapshot published by the executor.
+   * @return true if a new snapshot is available, false otherwise.
+   */
+  bool update();
+
+  /*!
+   * Returns the snapshot taken over with update(). The reference stays valid
+   * until the next update().
+   * @return the snapshot.
+   */
+  const ExecutorSnapshot& getSnapshot() const;
+
+ private:
+  ExecutorSnapshotChannel& channel_;
+};
+
+} /* namespace free_gait */
@@ -0,0 +1,127 @@
+/*
+ * FrameRegistry.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#pragma once
+
+#include "free_gait_core/TypeDefs.hpp"
+
+// STD
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace free_gait {
+
+//! Compact handle of an interned frame id (see FrameRegistry).
+typedef uint16_t FrameId;
+
+/*!
+ * Registry of the frame ids, which maps the frame id strings to compact
+ * handles (interning). Frames are registered once and never removed, such
+ * that handles stay valid. The registry grows in blocks of frames, which are
+ * never moved. Registering is thread-safe, looking up the name of a handle is
+ * wait-free.
+ */
+class FrameRegistry
+{
+ public:
+  static constexpr FrameId invalidFrameId = UINT16_MAX;
+  //! Number of frames per block.
+  static constexpr size_t blockSize = 64;
+  //! Max. number of frames, limited by the size of the handles.
+  static constexpr size_t maxSize = invalidFrameId;
+
+  FrameRegistry();
+  virtual ~FrameRegistry();
+
+  /*!
+   * Returns the registry shared by all adapters, such that handles are valid
+   * for all steps and copies of the adapters.
+   * @return the registry.
+   */
+  static FrameRegistry& getInstance();
+
+  /*!
+   * Returns the handle of a frame id and registers the frame id if needed.
+   * @param name the frame id.
+   * @return the handle, invalidFrameId if the registry is full (maxSize frames).
+   */
+  FrameId intern(const std::string& name);
+
+  /*!
+   * Returns the handle of a frame id like intern(), but throws if the frame
+   * id cannot be registered, such that a motion never silently loses its frame.
+   * @param name the frame id.
+   * @return the handle.
+   * @throw std::runtime_error if the registry is full.
+   */
+  FrameId internOrThrow(const std::string& name);
+
+  /*!
+   * Returns the handle of a registered frame id.
+   * @param name the frame id.
+   * @return the handle, invalidFrameId if the frame id is not registered.
+   */
+  FrameId find(const std::string& name) const;
+
+  /*!
+   * Returns the frame id of a handle.
+   * @param frameId the handle.
+   * @return the frame id, an empty string for invalid handles.
+   */
+  const std::string& getName(const FrameId frameId) const;
+
+  /*!
+   * Returns a description of a handle for error messages, the quoted frame id
+   * or the handle number if it is not registered (e.g. frame not set).
+   * @param frameId the handle.
+   * @return the description.
+   */
+  std::string getDescription(const FrameId frameId) const;
+
+  bool isValid(const FrameId frameId) const;
+  size_t size() const;
+
+ private:
+  typedef std::array<std::string, blockSize> Block;
+  static constexpr size_t maxNumberOfBlocks = (maxSize + blockSize - 1) / blockSize;
+
+  //! Blocks of the names, allocated when needed (owned by the registry).
+  std::array<std::atomic<Block*>, maxNumberOfBlocks> blocks_;
+  //! Number of registered frames, names up to size_ are immutable.
+  std::atomic<size_t> size_;
+  std::mutex mutex_;
+};
+
+/*!
+ * Frame id handles of a motion for each control level, invalid if not set.
+ */
+class ControlLevelFrameIds
+{
+ public:
+  ControlLevelFrameIds()
+  {
+    frameIds_.fill(FrameRegistry::invalidFrameId);
+  }
+
+  FrameId& operator[](const ControlLevel& controlLevel)
+  {
+    return frameIds_[getIndex(controlLevel)];
+  }
+
+  FrameId operator[](const ControlLevel& controlLevel) const
+  {
+    return frameIds_[getIndex(controlLevel)];
+  }
+
+ private:
+  std::array<FrameId, nControlLevels> frameIds_;
+};
+
+} /* namespace free_gait */
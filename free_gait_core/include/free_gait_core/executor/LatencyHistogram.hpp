@@ -0,0 +1,94 @@
+/*
+ * LatencyHistogram.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#pragma once
+
+// STD
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace free_gait {
+
+/*!
+ * Rolling histogram of durations. The durations are counted in logarithmic
+ * buckets with 8 linear sub-buckets per power of two (relative resolution of
+ * 12.5%). The samples are counted in two alternating windows, such that the
+ * statistics cover the last `windowSize` to `2 * windowSize` samples.
+ * Adding samples is wait-free and does not allocate memory. It must only be
+ * done from one thread, while the statistics can be read from any thread.
+ */
+class LatencyHistogram
+{
+ public:
+  static constexpr size_t windowSize = 1024;
+  static constexpr size_t nSubBuckets = 8;
+  static constexpr size_t nBuckets = 36 * nSubBuckets;
+
+  struct Statistics
+  {
+    //! Number of samples in the rolling window.
+    size_t nSamples;
+    //! Durations [s].
+    double median;
+    double percentile99;
+    double max;
+  };
+
+  /*!
+   * Sum of the bucket counts, used to merge histograms.
+   */
+  struct Counts
+  {
+    Counts();
+    void add(const Counts& other);
+    Statistics getStatistics() const;
+    std::array<uint32_t, nBuckets> buckets;
+    size_t nSamples;
+    uint64_t max;
+  };
+
+  LatencyHistogram();
+  virtual ~LatencyHistogram();
+
+  /*!
+   * Adds a sample. Only to be called from a single (writing) thread.
+   * @param duration the duration [ns].
+   */
+  void add(const uint64_t duration);
+
+  /*!
+   * Removes all samples. Only to be called from the writing thread.
+   */
+  void clear();
+
+  /*!
+   * Adds the counts of the rolling window to the counts.
+   * @param counts the counts to add to.
+   */
+  void getCounts(Counts& counts) const;
+  Statistics getStatistics() const;
+
+  static size_t getBucket(const uint64_t duration);
+  static uint64_t getBucketUpperBound(const size_t bucket);
+
+ private:
+  struct Window
+  {
+    std::array<std::atomic<uint16_t>, nBuckets> buckets;
+    std::atomic<uint32_t> nSamples;
+    std::atomic<uint64_t> max;
+  };
+
+  void clear(Window& window);
+
+  std::array<Window, 2> windows_;
+  std::atomic<size_t> activeWindow_;
+};
+
+} /* namespace free_gait */
@@ -0,0 +1,137 @@
+/*
+ * SpeculativeStepCompleter.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#pragma once
+
+#include "free_gait_core/TypeDefs.hpp"
+#include "free_gait_core/executor/AdapterBase.hpp"
+#include "free_gait_core/executor/State.hpp"
+#include "free_gait_core/step/Step.hpp"
+#include "free_gait_core/step/StepCompleter.hpp"
+#include "free_gait_core/step/StepQueue.hpp"
+
+// STD
+#include <atomic>
+#include <bitset>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace free_gait {
+
+/*!
+ * Completes (and computes) the next step of the queue in the background while
+ * the current step is executed. The state at the end of the current step is
+ * predicted by executing the rest of the step on a copy of the adapter (see
+ * AdapterBase::clone()). At the step switch, the speculatively completed step
+ * is only used if the actual state matches the predicted state.
+ * The speculation uses its own step completer, hence automatic base motions
+ * are optimized without warm start from the steps of the executor.
+ */
+class SpeculativeStepCompleter
+{
+ public:
+  SpeculativeStepCompleter(const StepParameters& parameters, const AdapterBase& adapter);
+  virtual ~SpeculativeStepCompleter();
+
+  /*!
+   * Creates the copy of the adapter and starts the worker thread.
+   * @return true if successful, false if the adapter does not support copies.
+   */
+  bool initialize();
+  bool isInitialized() const;
+
+  /*!
+   * Starts the speculative completion of the next step in the queue. Does not
+   * block, only the input data is copied.
+   * @param state the current state.
+   * @param queue the step queue, the current step has to be active.
+   * @param dt the time step with which the executor is advanced [s].
+   * @return true if the speculation was started, false otherwise.
+   */
+  bool speculate(const State& state, const StepQueue& queue, const double dt);
+
+  /*!
+   * Checks if a speculation was started for a step.
+   * @param stepId the id of the step.
+   * @return true if a speculation is running or done, false otherwise.
+   */
+  bool hasSpeculation(const std::string& stepId) const;
+
+  /*!
+   * Takes the result of the speculation for the current step at the step
+   * switch. The speculation is removed in any case.
+   * @param state the actual state at the step switch.
+   * @param queue the step queue, switched to the new step.
+   * @param step the step to replace with the speculatively completed step.
+   * @return true if the speculation is done and valid for the actual state
+   *         and queue, false otherwise (step is not changed).
+   */
+  bool takeSpeculation(const State& state, const StepQueue& queue, Step& step);
+  void clear();
+
+  /*!
+   * Blocks until the worker has processed the started speculation.
+   * @param timeout the max. time to wait [s].
+   * @return true if the worker is idle, false if the timeout has passed.
+   */
+  bool waitUntilIdle(const double timeout) const;
+
+  /*!
+   * Sets the tolerance for validating the predicted state, applied to the
+   * base and foot positions [m], the base orientation [rad] and the joint
+   * positions [rad].
+   * @param tolerance the tolerance.
+   */
+  void setTolerance(const double tolerance);
+  double getTolerance() const;
+
+ private:
+  struct Speculation
+  {
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+    std::string stepId;
+    uint64_t sequenceNumber;
+    std::string previousStepId;
+    std::string nextStepId;
+    double dt;
+    State state;
+    std::unique_ptr<Step> previousStep;
+    std::vector<Step> steps;
+    Step step;
+    Stance footPositions;
+    std::bitset<nLimbs> groundedLegs;
+    std::atomic<bool> isDone;
+    bool isSuccessful;
+  };
+
+  void work();
+  bool process(Speculation& speculation) const;
+  bool isValid(const State& state, const StepQueue& queue, const Speculation& speculation) const;
+
+  const StepParameters& parameters_;
+  const AdapterBase& adapter_;
+  std::unique_ptr<AdapterBase> adapterCopy_;
+
+  std::thread worker_;
+  mutable std::mutex mutex_;
+  std::condition_variable condition_;
+  mutable std::condition_variable idleCondition_;
+  bool isStopping_;
+  bool isRunning_;
+
+  //! Speculation of the next step, processed by the worker if not done.
+  std::shared_ptr<Speculation> speculation_;
+  bool isQueued_;
+
+  double tolerance_;
+};
+
+} /* namespace free_gait */
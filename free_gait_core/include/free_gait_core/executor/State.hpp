@@ -13,9 +13,10 @@
 #include <quadruped_model/QuadrupedModel.hpp>
 
 // STD
+#include <array>
+#include <bitset>
 #include <vector>
 #include <iostream>
-#include <unordered_map>
 
 namespace free_gait {
 
@@ -35,6 +36,13 @@ class State : public quadruped_model::QuadrupedState
   const std::string& getStepId() const;
   void setStepId(const std::string& stepId);
 
+  /*!
+   * Reserves memory for the step id, such that setting ids up to this
+   * length does not allocate.
+   * @param length the max. length of the step id.
+   */
+  void reserveStepId(const size_t length);
+
   bool isSupportLeg(const LimbEnum& limb) const;
   void setSupportLeg(const LimbEnum& limb, bool isSupportLeg);
   unsigned int getNumberOfSupportLegs() const;
@@ -88,14 +96,15 @@ class State : public quadruped_model::QuadrupedState
   LinearAcceleration linearAccelerationBaseInWorldFrame_;
   AngularAcceleration angularAccelerationBaseInBaseFrame_;
 
-  // Free gait specific.
-  std::unordered_map<BranchEnum, ControlSetup, EnumClassHash> controlSetups_;
+  // Free gait specific, stored in fixed-size containers indexed by enum.
+  std::array<ControlSetup, nBranches> controlSetups_;
   Force netForceOnBaseInBaseFrame_;
   Torque netTorqueOnBaseInBaseFrame_;
-  std::unordered_map<LimbEnum, bool, EnumClassHash> isSupportLegs_;
-  std::unordered_map<LimbEnum, bool, EnumClassHash> ignoreContact_;
-  std::unordered_map<LimbEnum, bool, EnumClassHash> ignoreForPoseAdaptation_;
-  std::unordered_map<LimbEnum, Vector, EnumClassHash> surfaceNormals_;
+  std::bitset<nLimbs> isSupportLegs_;
+  std::bitset<nLimbs> ignoreContact_;
+  std::bitset<nLimbs> ignoreForPoseAdaptation_;
+  std::bitset<nLimbs> hasSurfaceNormals_;
+  std::array<Vector, nLimbs> surfaceNormals_;
   bool robotExecutionStatus_;
   std::string stepId_; // empty if undefined.
 };
@@ -10,41 +10,157 @@
 
 #include <free_gait_core/executor/State.hpp>
 
+#include <Eigen/Core>
+
+#include <array>
+#include <bitset>
 #include <map>
 #include <string>
 #include <tuple>
+#include <vector>
 
 namespace free_gait {
 
+/*!
+ * Time series of states stored column-wise: one contiguous time vector and
+ * one contiguous array per state channel (base pose/twist, joint quantities,
+ * limb flags, control setups, step id index). Times have to be added in
+ * increasing order.
+ */
 class StateBatch
 {
  public:
+  template<typename T>
+  using AlignedVector = std::vector<T, Eigen::aligned_allocator<T>>;
+
   StateBatch();
+  StateBatch(const StateBatch& other) = default;
+  StateBatch(StateBatch&& other) = default;
+  StateBatch& operator=(const StateBatch& other) = default;
+  StateBatch& operator=(StateBatch&& other) = default;
   virtual ~StateBatch();
 
-  const std::map<double, State>& getStates() const;
   std::vector<std::map<double, Position>> getEndEffectorPositions() const;
   std::vector<std::map<double, Position>> getEndEffectorTargets() const;
   std::vector<std::map<double, std::tuple<Position, Vector>>> getSurfaceNormals() const;
   std::map<double, Stance> getStances() const;
   bool getEndTimeOfStep(std::string& stepId, double& endTime) const;
+
+  /*!
+   * Appends a state. If the time is equal to the last time, the last state
+   * is overwritten (and its derived data removed).
+   * @param time the time of the state, has to be >= the last added time.
+   * @param state the state to add.
+   */
   void addState(const double time, const State& state);
+
+  /*!
+   * Appends all states of another batch with their times shifted by an offset.
+   * @param other the batch to append, its shifted start time has to be
+   *        after the end time of this batch.
+   * @param timeOffset the offset added to the times of the other batch.
+   */
+  void append(const StateBatch& other, const double timeOffset);
+
+  /*!
+   * Appends the states with indices in [begin, end) of another batch with
+   * their times shifted by an offset. The derived data of these states is
+   * appended as well if it is computed for them in the other batch and for
+   * all states of this batch.
+   * @param other the batch to append from.
+   * @param begin the index of the first state to append.
+   * @param end the index after the last state to append.
+   * @param timeOffset the offset added to the times of the other batch.
+   */
+  void append(const StateBatch& other, const size_t begin, const size_t end, const double timeOffset = 0.0);
+
+  /*!
+   * Reserves memory for the given number of states.
+   * @param nStates the expected number of states.
+   */
+  void reserve(const size_t nStates);
+
+  size_t size() const;
+  bool empty() const;
   bool isValidTime(const double time) const;
   double getStartTime() const;
   double getEndTime() const;
-  const State& getState(const double time) const;
+
+  /*!
+   * Returns the index of the first state at or after the given time (the
+   * last state if the time is after the end time). Uses direct indexing if
+   * the states are on a uniform time grid and a binary search otherwise.
+   * @param time the requested time.
+   * @return the index of the state.
+   */
+  size_t getIndex(const double time) const;
+
+  /*!
+   * Reconstructs the state for the given time (see getIndex()).
+   * @param time the requested time.
+   * @return the state.
+   */
+  State getState(const double time) const;
+
+  /*!
+   * Writes the state with the given index into an existing state object,
+   * which avoids reallocations when iterating over the batch.
+   * @param index the index of the state.
+   * @param state the state to write to.
+   */
+  void getStateAtIndex(const size_t index, State& state) const;
+
+  const std::vector<double>& getTimes() const;
+  const AlignedVector<Position>& getPositionsWorldToBaseInWorldFrame() const;
+  const AlignedVector<RotationQuaternion>& getOrientationsBaseToWorld() const;
+  const AlignedVector<JointPositions>& getJointPositions() const;
+  const std::vector<std::bitset<nLimbs>>& getSupportLegs() const;
+  const std::string& getStepIdAtIndex(const size_t index) const;
+
   void clear();
 
   friend class StateBatchComputer;
 
  private:
-  std::map<double, State> states_;
+  void updateTimeGrid(const double time);
+  void removeDerivedData(const double time);
+  void appendDerivedData(const StateBatch& other, const size_t begin, const size_t end, const double timeOffset);
+
+  // Columns.
+  std::vector<double> times_;
+  AlignedVector<Position> positionsWorldToBaseInWorldFrame_;
+  AlignedVector<RotationQuaternion> orientationsBaseToWorld_;
+  AlignedVector<LinearVelocity> linearVelocitiesBaseInWorldFrame_;
+  AlignedVector<LocalAngularVelocity> angularVelocitiesBaseInBaseFrame_;
+  AlignedVector<JointPositions> jointPositions_;
+  AlignedVector<JointVelocities> jointVelocities_;
+  AlignedVector<JointAccelerations> jointAccelerations_;
+  AlignedVector<JointEfforts> jointEfforts_;
+  std::vector<std::bitset<nLimbs>> supportLegs_;
+  std::vector<std::bitset<nLimbs>> ignoreContact_;
+  std::vector<std::bitset<nLimbs>> ignoreForPoseAdaptation_;
+  std::vector<std::bitset<nLimbs>> hasSurfaceNormals_;
+  std::vector<std::array<Vector, nLimbs>> surfaceNormalVectors_;
+  std::vector<std::array<ControlSetup, nBranches>> controlSetups_;
+  std::vector<bool> robotExecutionStatus_;
+
+  //! Index into the step id table for each state.
+  std::vector<size_t> stepIdIndices_;
+  std::vector<std::string> stepIdTable_;
+
+  //! Time step if all states are on a uniform grid.
+  double uniformTimeStep_;
+  bool isUniform_;
+
+  // Derived data (see StateBatchComputer).
   std::vector<std::map<double, Position>> endEffectorPositions_;
   std::vector<std::map<double, Position>> endEffectorTargets_;
   std::vector<std::map<double, std::tuple<Position, Vector>>> surfaceNormals_;
   std::map<double, Stance> stances_;
-  std::map<double, Pose> basePoses_;
   std::map<double, std::string> stepIds_;
+
+  //! Number of states for which the derived data is computed (see StateBatchComputer::update()).
+  size_t nDerivedStates_;
 };
 
 } /* namespace free_gait */
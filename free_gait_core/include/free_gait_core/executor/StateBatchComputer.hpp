@@ -19,6 +19,23 @@ class StateBatchComputer
   StateBatchComputer(AdapterBase& adapter);
   virtual ~StateBatchComputer();
 
+  /*!
+   * Computes all derived data of the state batch (end effector trajectories,
+   * targets, surface normals, stances, and step ids) from scratch in a single
+   * pass (see update()).
+   * @param stateBatch the state batch.
+   */
+  void compute(StateBatch& stateBatch);
+
+  /*!
+   * Updates all derived data of the state batch with the states added since
+   * the last update, such that the data can be computed while the states are
+   * streamed in. The derived channels are computed together with a single
+   * kinematics evaluation (`setInternalDataFromState()`) per state.
+   * @param stateBatch the state batch.
+   */
+  void update(StateBatch& stateBatch);
+
   void computeEndEffectorTargetsAndSurfaceNormals(StateBatch& stateBatch);
   void computeSurfaceNormals(StateBatch& stateBatch);
   void computeEndEffectorTrajectories(StateBatch& stateBatch);
@@ -27,7 +44,12 @@ class StateBatchComputer
   void computeStepIds(StateBatch& stateBatch);
 
  private:
+  void updateStepIds(StateBatch& stateBatch, const size_t index) const;
+
   AdapterBase& adapter_;
+
+  //! State reused for the reconstruction of the states of the batch.
+  State state_;
 };
 
 } /* namespace free_gait */
@@ -0,0 +1,83 @@
+/*
+ * StateBatchStream.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#pragma once
+
+#include "free_gait_core/executor/StateBatch.hpp"
+
+// STD
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace free_gait {
+
+/*!
+ * Thread-safe, append-only sequence of state batch chunks. A producer (e.g.
+ * the batch executor) pushes consecutive chunks of states while simulating,
+ * consumers read the chunks from any thread without waiting for the end of
+ * the simulation. Chunks are immutable and shared, reading does not copy the
+ * states. A consumer keeps track of the number of chunks it has read and
+ * appends new chunks to its own batch (see StateBatch::append()).
+ */
+class StateBatchStream
+{
+ public:
+  typedef std::shared_ptr<const StateBatch> Chunk;
+
+  StateBatchStream();
+  virtual ~StateBatchStream();
+
+  /*!
+   * Adds a chunk (producer). The chunk has to start after the end of the
+   * previous chunk.
+   * @param chunk the chunk.
+   */
+  void push(const Chunk& chunk);
+
+  /*!
+   * Marks the end of the stream (producer), no chunks are added afterwards.
+   * @param success false if the stream ended before the end of the simulation
+   *        (e.g. cancelled).
+   */
+  void close(const bool success);
+
+  bool isClosed() const;
+
+  //! True if the stream is closed and complete.
+  bool isComplete() const;
+
+  size_t getNumberOfChunks() const;
+
+  /*!
+   * Returns the chunks with index >= firstChunk.
+   * @param firstChunk the index of the first chunk (e.g. the number of
+   *        chunks read so far).
+   * @return the chunks.
+   */
+  std::vector<Chunk> getChunks(const size_t firstChunk = 0) const;
+
+  /*!
+   * Waits until more than a given number of chunks are available or the
+   * stream is closed.
+   * @param nChunks the number of chunks read so far.
+   * @param timeout the maximum time to wait [s].
+   * @return true if more chunks are available or the stream is closed,
+   *         false on timeout.
+   */
+  bool waitForChunks(const size_t nChunks, const double timeout) const;
+
+ private:
+  mutable std::mutex mutex_;
+  mutable std::condition_variable condition_;
+  std::vector<Chunk> chunks_;
+  bool isClosed_;
+  bool isComplete_;
+};
+
+} /* namespace free_gait */
@@ -0,0 +1,87 @@
+/*
+ * TripleBuffer.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#pragma once
+
+// STD
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace free_gait {
+
+/*!
+ * Triple buffer to pass the latest value from one writing thread to one
+ * reading thread. Writing and reading are wait-free: The writer fills the
+ * back buffer and swaps it with the middle buffer, the reader swaps the
+ * middle buffer with the front buffer if it has been updated. Values which
+ * are not read before the next write are dropped.
+ */
+template<typename T>
+class TripleBuffer
+{
+ public:
+  TripleBuffer()
+      : front_(0),
+        middle_(1),
+        back_(2)
+  {
+  }
+
+  virtual ~TripleBuffer()
+  {
+  }
+
+  /*!
+   * Returns the buffer to write to (writer only). The buffer contains an
+   * old value and has to be overwritten completely.
+   * @return the back buffer.
+   */
+  T& getWriteBuffer()
+  {
+    return buffers_[back_];
+  }
+
+  /*!
+   * Publishes the written buffer (writer only).
+   */
+  void publish()
+  {
+    back_ = middle_.exchange(back_ | updatedFlag_, std::memory_order_acq_rel) & indexMask_;
+  }
+
+  /*!
+   * Takes over the latest published value (reader only).
+   * @return true if a new value is available, false otherwise.
+   */
+  bool update()
+  {
+    if (!(middle_.load(std::memory_order_relaxed) & updatedFlag_)) return false;
+    front_ = middle_.exchange(front_, std::memory_order_acq_rel) & indexMask_;
+    return true;
+  }
+
+  /*!
+   * Returns the latest value taken over with update() (reader only).
+   * @return the front buffer.
+   */
+  const T& getReadBuffer() const
+  {
+    return buffers_[front_];
+  }
+
+ private:
+  static constexpr uint8_t indexMask_ = 0x3;
+  static constexpr uint8_t updatedFlag_ = 0x4;
+
+  std::array<T, 3> buffers_;
+  uint8_t front_;
+  std::atomic<uint8_t> middle_;
+  uint8_t back_;
+};
+
+} /* namespace free_gait */
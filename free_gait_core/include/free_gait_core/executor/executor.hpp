@@ -9,9 +9,18 @@
 #pragma once
 
 #include "free_gait_core/executor/AdapterBase.hpp"
+#include "free_gait_core/executor/AdaptiveTimeStepper.hpp"
 #include "free_gait_core/executor/Executor.hpp"
 #include "free_gait_core/executor/BatchExecutor.hpp"
+#include "free_gait_core/executor/CandidateEvaluator.hpp"
 #include "free_gait_core/executor/ExecutorState.hpp"
+#include "free_gait_core/executor/ExecutorCommandQueue.hpp"
+#include "free_gait_core/executor/ExecutorFeedback.hpp"
+#include "free_gait_core/executor/ExecutorProfiler.hpp"
+#include "free_gait_core/executor/ExecutorSnapshot.hpp"
+#include "free_gait_core/executor/FrameRegistry.hpp"
+#include "free_gait_core/executor/LatencyHistogram.hpp"
 #include "free_gait_core/executor/State.hpp"
 #include "free_gait_core/executor/StateBatch.hpp"
 #include "free_gait_core/executor/StateBatchComputer.hpp"
+#include "free_gait_core/executor/StateBatchStream.hpp"
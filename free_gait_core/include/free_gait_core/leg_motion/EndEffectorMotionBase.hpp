@@ -11,6 +11,7 @@
 // Free Gait
 #include "free_gait_core/leg_motion/LegMotionBase.hpp"
 #include <free_gait_core/TypeDefs.hpp>
+#include <free_gait_core/executor/FrameRegistry.hpp>
 
 // STD
 #include <string>
@@ -62,6 +63,17 @@ class EndEffectorMotionBase : public LegMotionBase
   virtual const LinearAcceleration evaluateAcceleration(const double time) const;
   virtual const Force evaluateForce(const double time) const;
 
+  /*!
+   * Evaluate the position, velocity, and acceleration of the end effector
+   * together, such that motions can share the trajectory lookup.
+   * @param time the time to evaluate the motion at.
+   * @param position the position of the end effector.
+   * @param velocity the velocity of the end effector.
+   * @param acceleration the acceleration of the end effector.
+   */
+  virtual void evaluate(const double time, Position& position, LinearVelocity& velocity,
+                        LinearAcceleration& acceleration) const;
+
   /*!
    * Return the target (end position) of the swing trajectory.
    * @return the target.
@@ -73,7 +85,13 @@ class EndEffectorMotionBase : public LegMotionBase
    * Returns the frame id of the trajectory.
    * @return the frame id.
    */
-  virtual const std::string& getFrameId(const ControlLevel& controlLevel) const;
+  const std::string& getFrameId(const ControlLevel& controlLevel) const;
+
+  /*!
+   * Returns the handle of the frame id of the trajectory (see FrameRegistry).
+   * @return the frame id handle.
+   */
+  virtual FrameId getFrameHandle(const ControlLevel& controlLevel) const;
 
   /*!
    * Print the contents to console for debugging.
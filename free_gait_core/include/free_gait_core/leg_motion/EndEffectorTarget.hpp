@@ -11,6 +11,7 @@
 // Free Gait
 #include "free_gait_core/TypeDefs.hpp"
 #include "free_gait_core/leg_motion/EndEffectorMotionBase.hpp"
+#include "free_gait_core/leg_motion/HermiteSpline.hpp"
 
 // Curves
 #include <curves/CubicHermiteE3Curve.hpp>
@@ -21,7 +22,7 @@
 
 namespace free_gait {
 
-class EndEffectorTarget : public EndEffectorMotionBase
+class EndEffectorTarget final : public EndEffectorMotionBase
 {
  public:
   typedef typename curves::CubicHermiteE3Curve::ValueType ValueType;
@@ -46,7 +47,7 @@ class EndEffectorTarget : public EndEffectorMotionBase
   void updateStartPosition(const Position& startPosition);
   void updateStartVelocity(const LinearVelocity& startVelocity);
 
-  const ControlSetup getControlSetup() const;
+  const ControlSetup& getControlSetup() const;
 
   bool prepareComputation(const State& state, const Step& step, const AdapterBase& adapter);
   bool needsComputation() const;
@@ -64,6 +65,9 @@ class EndEffectorTarget : public EndEffectorMotionBase
 
   const LinearAcceleration evaluateAcceleration(const double time) const;
 
+  void evaluate(const double time, Position& position, LinearVelocity& velocity,
+                LinearAcceleration& acceleration) const;
+
   /*!
    * Returns the total duration of the trajectory.
    * @return the duration.
@@ -80,7 +84,7 @@ class EndEffectorTarget : public EndEffectorMotionBase
   const Position getTargetPosition() const;
   const LinearVelocity getTargetVelocity() const;
 
-  const std::string& getFrameId(const ControlLevel& controlLevel) const;
+  FrameId getFrameHandle(const ControlLevel& controlLevel) const;
 
   bool isIgnoreContact() const;
 
@@ -101,7 +105,7 @@ class EndEffectorTarget : public EndEffectorMotionBase
   double minimumDuration_;
 
   ControlSetup controlSetup_;
-  std::unordered_map<ControlLevel, std::string, EnumClassHash> frameIds_;
+  ControlLevelFrameIds frameIds_;
   Position startPosition_;
   Position targetPosition_;
   LinearVelocity startVelocity_;
@@ -112,6 +116,9 @@ class EndEffectorTarget : public EndEffectorMotionBase
   //! End effector trajectory.
   curves::CubicHermiteE3Curve trajectory_;
 
+  //! End effector trajectory as spline, for evaluation of all derivatives at once.
+  HermiteSpline<3> spline_;
+
   //! If trajectory is updated.
   bool isComputed_;
 };
@@ -11,6 +11,8 @@
 // Free Gait
 #include "free_gait_core/TypeDefs.hpp"
 #include "free_gait_core/leg_motion/EndEffectorMotionBase.hpp"
+#include "free_gait_core/leg_motion/HermiteSpline.hpp"
+#include "free_gait_core/leg_motion/SampledTrajectory.hpp"
 
 // Curves
 #include <curves/CubicHermiteE3Curve.hpp>
@@ -21,7 +23,7 @@
 
 namespace free_gait {
 
-class EndEffectorTrajectory : public EndEffectorMotionBase
+class EndEffectorTrajectory final : public EndEffectorMotionBase
 {
  public:
   typedef typename curves::CubicHermiteE3Curve::ValueType ValueType;
@@ -65,7 +67,7 @@ class EndEffectorTrajectory : public EndEffectorMotionBase
   const Position getStartPosition() const;
   const LinearVelocity getStartVelocity() const;
 
-  const ControlSetup getControlSetup() const;
+  const ControlSetup& getControlSetup() const;
 
   bool prepareComputation(const State& state, const Step& step, const AdapterBase& adapter);
   bool needsComputation() const;
@@ -83,11 +85,16 @@ class EndEffectorTrajectory : public EndEffectorMotionBase
 
   const LinearAcceleration evaluateAcceleration(const double time) const;
 
+  void evaluate(const double time, Position& position, LinearVelocity& velocity,
+                LinearAcceleration& acceleration) const;
+
   /*!
    * Returns the total duration of the trajectory.
    * @return the duration.
    */
   double getDuration() const;
+  void setSampling(const double timeStep, const SampleInterpolation interpolation);
+  double getSamplingTimeStep() const;
 
   /*!
    * Return the target (end position) of the swing profile.
@@ -95,7 +102,7 @@ class EndEffectorTrajectory : public EndEffectorMotionBase
    */
   const Position getTargetPosition() const;
 
-  const std::string& getFrameId(const ControlLevel& controlLevel) const;
+  FrameId getFrameHandle(const ControlLevel& controlLevel) const;
 
   void setIgnoreContact(bool ignoreContact);
   bool isIgnoreContact() const;
@@ -108,13 +115,15 @@ class EndEffectorTrajectory : public EndEffectorMotionBase
   friend class StepFrameConverter;
 
  private:
+  void sampleTrajectory();
+
   bool ignoreContact_;
   bool ignoreForPoseAdaptation_;
 
   ControlSetup controlSetup_;
 
   //! Knots.
-  std::unordered_map<ControlLevel, std::string, EnumClassHash> frameIds_;
+  ControlLevelFrameIds frameIds_;
   std::vector<Time> times_;
   std::unordered_map<ControlLevel, std::vector<ValueType>, EnumClassHash> values_;
 
@@ -123,6 +132,14 @@ class EndEffectorTrajectory : public EndEffectorMotionBase
   //! End effector trajectory.
   curves::CubicHermiteE3Curve trajectory_;
 
+  //! End effector trajectory as spline, for evaluation of all derivatives at once.
+  HermiteSpline<3> spline_;
+
+  //! Uniformly sampled trajectory, evaluated instead of the spline if sampled.
+  double samplingTimeStep_;
+  SampleInterpolation samplingInterpolation_;
+  SampledTrajectory<3> samples_;
+
   //! If trajectory is updated.
   bool isComputed_;
 };
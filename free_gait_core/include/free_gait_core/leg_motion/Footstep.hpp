@@ -11,6 +11,8 @@
 // Free Gait
 #include "free_gait_core/TypeDefs.hpp"
 #include "free_gait_core/leg_motion/EndEffectorMotionBase.hpp"
+#include "free_gait_core/leg_motion/HermiteSpline.hpp"
+#include "free_gait_core/leg_motion/SampledTrajectory.hpp"
 
 // Curves
 #include <curves/CubicHermiteE3Curve.hpp>
@@ -21,7 +23,7 @@
 
 namespace free_gait {
 
-class Footstep : public EndEffectorMotionBase
+class Footstep final : public EndEffectorMotionBase
 {
  public:
   typedef typename curves::CubicHermiteE3Curve::ValueType ValueType;
@@ -48,7 +50,7 @@ class Footstep : public EndEffectorMotionBase
   const Position getStartPosition() const;
   const LinearVelocity getStartVelocity() const;
 
-  const ControlSetup getControlSetup() const;
+  const ControlSetup& getControlSetup() const;
 
   bool compute(bool isSupportLeg);
   bool prepareComputation(const State& state, const Step& step, const AdapterBase& adapter);
@@ -67,11 +69,16 @@ class Footstep : public EndEffectorMotionBase
 
   const LinearAcceleration evaluateAcceleration(const double time) const;
 
+  void evaluate(const double time, Position& position, LinearVelocity& velocity,
+                LinearAcceleration& acceleration) const;
+
   /*!
    * Returns the total duration of the trajectory.
    * @return the duration.
    */
   double getDuration() const;
+  void setSampling(const double timeStep, const SampleInterpolation interpolation);
+  double getSamplingTimeStep() const;
   void setMinimumDuration(const double minimumDuration);
   double getMinimumDuration() const;
 
@@ -79,7 +86,7 @@ class Footstep : public EndEffectorMotionBase
   const Position getTargetPosition() const;
   const LinearVelocity getTargetVelocity() const;
 
-  const std::string& getFrameId(const ControlLevel& controlLevel) const;
+  FrameId getFrameHandle(const ControlLevel& controlLevel) const;
 
   void setProfileType(const std::string& profileType);
   const std::string& getProfileType() const;
@@ -107,6 +114,7 @@ class Footstep : public EndEffectorMotionBase
   friend class StepFrameConverter;
 
  private:
+  void sampleTrajectory();
   void generateStraightKnots();
   void generateTriangleKnots();
   void generateSquareKnots();
@@ -116,7 +124,7 @@ class Footstep : public EndEffectorMotionBase
   Position target_;
   LinearVelocity liftOffVelocity_;
   LinearVelocity touchdownVelocity_;
-  std::string frameId_;
+  FrameId frameId_;
   double profileHeight_;
   std::string profileType_;
   double averageVelocity_;
@@ -134,6 +142,14 @@ class Footstep : public EndEffectorMotionBase
   std::vector<Time> times_;
   curves::CubicHermiteE3Curve trajectory_;
 
+  //! Foot trajectory as spline, for evaluation of all derivatives at once.
+  HermiteSpline<3> spline_;
+
+  //! Uniformly sampled trajectory, evaluated instead of the spline if sampled.
+  double samplingTimeStep_;
+  SampleInterpolation samplingInterpolation_;
+  SampledTrajectory<3> samples_;
+
   //! If trajectory is updated.
   bool isComputed_;
 };
@@ -0,0 +1,324 @@
+/*
+ * HermiteSpline.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#pragma once
+
+// Eigen
+#include <Eigen/Core>
+#include <Eigen/StdVector>
+
+// STD
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+namespace free_gait {
+
+/*!
+ * Piecewise polynomial spline (up to quintic), which evaluates the value and
+ * its first and second derivative together with one segment search.
+ * The spline is defined by the values and derivatives at its knots (Hermite
+ * form). Sampling a fitted curve of the curves library at its knots
+ * reproduces the curve: cubic Hermite curves are determined by the values
+ * and first derivatives, quintic polynomial splines additionally by the
+ * second derivatives at the knots.
+ * The spline remembers the segment of the last evaluation, such that the
+ * common case of increasing evaluation times does not need a segment search.
+ */
+template<int Dimension>
+class HermiteSpline
+{
+ public:
+  typedef Eigen::Matrix<double, Dimension, 1> ValueType;
+  typedef std::vector<ValueType, Eigen::aligned_allocator<ValueType>> Values;
+
+  HermiteSpline()
+  {
+  }
+
+  void clear()
+  {
+    times_.clear();
+    coefficients_.clear();
+    cursor_.set(0);
+  }
+
+  bool empty() const
+  {
+    return times_.empty();
+  }
+
+  /*!
+   * Sets the knots of a cubic Hermite spline.
+   * @param times the knot times (not decreasing, segments of zero duration are skipped).
+   * @param values the values at the knots.
+   * @param firstDerivatives the first derivatives at the knots.
+   */
+  void setKnots(const std::vector<double>& times, const Values& values, const Values& firstDerivatives)
+  {
+    checkKnots(times, values, firstDerivatives);
+    times_ = times;
+    coefficients_.resize(times.size());
+    for (size_t i = 0; i + 1 < times.size(); ++i) {
+      const double h = times[i + 1] - times[i];
+      if (h == 0.0) {
+        setConstant(i, values[i]);
+        continue;
+      }
+      const ValueType slope = (values[i + 1] - values[i]) / h;
+      Coefficients& c = coefficients_[i];
+      c.setZero();
+      c.col(0) = values[i];
+      c.col(1) = firstDerivatives[i];
+      c.col(2) = (3.0 * slope - 2.0 * firstDerivatives[i] - firstDerivatives[i + 1]) / h;
+      c.col(3) = (firstDerivatives[i] + firstDerivatives[i + 1] - 2.0 * slope) / (h * h);
+    }
+    setConstant(times.size() - 1, values.back());
+    cursor_.set(0);
+  }
+
+  /*!
+   * Sets the knots of a quintic Hermite spline.
+   * @param times the knot times (not decreasing, segments of zero duration are skipped).
+   * @param values the values at the knots.
+   * @param firstDerivatives the first derivatives at the knots.
+   * @param secondDerivatives the second derivatives at the knots.
+   */
+  void setKnots(const std::vector<double>& times, const Values& values, const Values& firstDerivatives,
+                const Values& secondDerivatives)
+  {
+    checkKnots(times, values, firstDerivatives);
+    if (secondDerivatives.size() != times.size()) throw std::invalid_argument("HermiteSpline: Inconsistent knots.");
+    times_ = times;
+    coefficients_.resize(times.size());
+    for (size_t i = 0; i + 1 < times.size(); ++i) {
+      const double h = times[i + 1] - times[i];
+      if (h == 0.0) {
+        setConstant(i, values[i]);
+        continue;
+      }
+      Coefficients& c = coefficients_[i];
+      c.col(0) = values[i];
+      c.col(1) = firstDerivatives[i];
+      c.col(2) = 0.5 * secondDerivatives[i];
+      // Residuals at the end of the segment of the quadratic part.
+      const ValueType dp = values[i + 1] - (c.col(0) + h * (c.col(1) + h * c.col(2)));
+      const ValueType dv = (firstDerivatives[i + 1] - (c.col(1) + 2.0 * h * c.col(2))) * h;
+      const ValueType da = (secondDerivatives[i + 1] - secondDerivatives[i]) * h * h;
+      c.col(3) = (10.0 * dp - 4.0 * dv + 0.5 * da) / (h * h * h);
+      c.col(4) = (-15.0 * dp + 7.0 * dv - da) / (h * h * h * h);
+      c.col(5) = (6.0 * dp - 3.0 * dv + 0.5 * da) / (h * h * h * h * h);
+    }
+    setConstant(times.size() - 1, values.back());
+    cursor_.set(0);
+  }
+
+  /*!
+   * Sets the knots by sampling the values and first derivatives of a fitted
+   * cubic Hermite curve of the curves library (e.g. CubicHermiteE3Curve).
+   * @param curve the fitted curve.
+   * @param times the knot times of the curve.
+   */
+  template<typename Curve>
+  void setKnotsFromCubicCurve(const Curve& curve, const std::vector<double>& times)
+  {
+    Values values(times.size()), firstDerivatives(times.size());
+    for (size_t i = 0; i < times.size(); ++i) {
+      curve.evaluate(values[i], times[i]);
+      curve.evaluateDerivative(firstDerivatives[i], times[i], 1);
+    }
+    setKnots(times, values, firstDerivatives);
+  }
+
+  double getMinTime() const
+  {
+    return times_.empty() ? 0.0 : times_.front();
+  }
+
+  double getMaxTime() const
+  {
+    return times_.empty() ? 0.0 : times_.back();
+  }
+
+  const std::vector<double>& getTimes() const
+  {
+    return times_;
+  }
+
+  /*!
+   * Returns the index of the segment containing the time.
+   * @param time the time, clamped to the time range of the spline.
+   * @return the index of the segment.
+   */
+  size_t getSegmentIndex(const double time) const
+  {
+    if (times_.size() < 2) return 0;
+    const size_t index = std::upper_bound(times_.begin(), times_.end(), time) - times_.begin();
+    if (index == 0) return 0;
+    return std::min(index - 1, times_.size() - 2);
+  }
+
+  /*!
+   * Returns the index of the segment containing the time, starting the search
+   * at a hint segment. Advancing by a few segments from the hint is done
+   * incrementally, other times are found by binary search.
+   * @param time the time, clamped to the time range of the spline.
+   * @param hint the index of the segment to start the search from.
+   * @return the index of the segment.
+   */
+  size_t getSegmentIndex(const double time, const size_t hint) const
+  {
+    if (times_.size() < 2) return 0;
+    const size_t lastIndex = times_.size() - 2;
+    size_t index = std::min(hint, lastIndex);
+    if (time < times_[index]) return getSegmentIndex(time);
+    for (size_t nSteps = 0; index < lastIndex && times_[index + 1] <= time; ++nSteps) {
+      if (nSteps == maxIncrementalSteps) return getSegmentIndex(time);
+      ++index;
+    }
+    return index;
+  }
+
+  /*!
+   * Evaluates the spline and its derivatives at a given time. Times outside
+   * of the time range of the spline are clamped. Any order of evaluation
+   * times is supported, increasing times are found fastest.
+   * @param time the time.
+   * @param value the value.
+   * @param firstDerivative the first derivative.
+   * @param secondDerivative the second derivative.
+   */
+  void evaluate(const double time, ValueType& value, ValueType& firstDerivative, ValueType& secondDerivative) const
+  {
+    if (times_.empty()) {
+      value.setZero();
+      firstDerivative.setZero();
+      secondDerivative.setZero();
+      return;
+    }
+    const double timeInRange = std::min(std::max(time, times_.front()), times_.back());
+    const size_t index = getSegmentIndex(timeInRange, cursor_.get());
+    cursor_.set(index);
+    evaluateSegment(index, timeInRange, value, firstDerivative, secondDerivative);
+  }
+
+  ValueType evaluate(const double time) const
+  {
+    return evaluateDerivative(time, 0);
+  }
+
+  /*!
+   * Evaluates only one derivative of the spline at a given time (see evaluate()).
+   * @param time the time.
+   * @param order the order of the derivative (0 for the value, up to 2).
+   * @return the derivative.
+   */
+  ValueType evaluateDerivative(const double time, const unsigned int order) const
+  {
+    if (order > 2) throw std::invalid_argument("HermiteSpline: Derivatives are supported up to second order.");
+    if (times_.empty()) return ValueType::Zero();
+    const double timeInRange = std::min(std::max(time, times_.front()), times_.back());
+    const size_t index = getSegmentIndex(timeInRange, cursor_.get());
+    cursor_.set(index);
+    const Coefficients& c = coefficients_[index];
+    const double t = timeInRange - times_[index];
+    switch (order) {
+      case 0:
+        return c.col(0) + t * (c.col(1) + t * (c.col(2) + t * (c.col(3) + t * (c.col(4) + t * c.col(5)))));
+      case 1:
+        return c.col(1) + t * (2.0 * c.col(2) + t * (3.0 * c.col(3) + t * (4.0 * c.col(4) + t * 5.0 * c.col(5))));
+      default:
+        return 2.0 * c.col(2) + t * (6.0 * c.col(3) + t * (12.0 * c.col(4) + t * 20.0 * c.col(5)));
+    }
+  }
+
+ protected:
+  typedef Eigen::Matrix<double, Dimension, 6> Coefficients;
+
+  /*!
+   * Segment of the last evaluation. The segment is only a hint for the next
+   * search, hence concurrent evaluations are safe (relaxed atomic).
+   */
+  class Cursor
+  {
+   public:
+    Cursor()
+        : segment_(0)
+    {
+    }
+
+    Cursor(const Cursor& other)
+        : segment_(other.get())
+    {
+    }
+
+    Cursor& operator=(const Cursor& other)
+    {
+      set(other.get());
+      return *this;
+    }
+
+    size_t get() const
+    {
+      return segment_.load(std::memory_order_relaxed);
+    }
+
+    void set(const size_t segment)
+    {
+      segment_.store(segment, std::memory_order_relaxed);
+    }
+
+   private:
+    std::atomic<size_t> segment_;
+  };
+
+  //! Maximum number of segments advanced incrementally before a binary search.
+  static constexpr size_t maxIncrementalSteps = 4;
+
+  void evaluateSegment(const size_t index, const double time, ValueType& value, ValueType& firstDerivative,
+                       ValueType& secondDerivative) const
+  {
+    const Coefficients& c = coefficients_[index];
+    const double t = time - times_[index];
+    value = c.col(0) + t * (c.col(1) + t * (c.col(2) + t * (c.col(3) + t * (c.col(4) + t * c.col(5)))));
+    firstDerivative = c.col(1) + t * (2.0 * c.col(2) + t * (3.0 * c.col(3) + t * (4.0 * c.col(4) + t * 5.0 * c.col(5))));
+    secondDerivative = 2.0 * c.col(2) + t * (6.0 * c.col(3) + t * (12.0 * c.col(4) + t * 20.0 * c.col(5)));
+  }
+
+  //! Knot times.
+  std::vector<double> times_;
+
+  //! Polynomial coefficients of the segments in the local time of the
+  //! segment (column i for t^i). The last entry is the constant value of
+  //! the last knot, which is only used for splines with a single knot.
+  //! Segments of zero duration are constant and never evaluated.
+  std::vector<Coefficients, Eigen::aligned_allocator<Coefficients>> coefficients_;
+
+  //! Evaluation cursor.
+  mutable Cursor cursor_;
+
+ private:
+  static void checkKnots(const std::vector<double>& times, const Values& values, const Values& firstDerivatives)
+  {
+    if (times.empty() || values.size() != times.size() || firstDerivatives.size() != times.size()) {
+      throw std::invalid_argument("HermiteSpline: Inconsistent knots.");
+    }
+    for (size_t i = 0; i + 1 < times.size(); ++i) {
+      if (times[i + 1] < times[i]) throw std::invalid_argument("HermiteSpline: Knot times must not decrease.");
+    }
+  }
+
+  void setConstant(const size_t index, const ValueType& value)
+  {
+    Coefficients& c = coefficients_[index];
+    c.setZero();
+    c.col(0) = value;
+  }
+};
+
+} /* namespace free_gait */
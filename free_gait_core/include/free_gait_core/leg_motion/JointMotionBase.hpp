@@ -71,6 +71,17 @@ class JointMotionBase : public LegMotionBase
   virtual const JointAccelerationsLeg evaluateAcceleration(const double time) const;
   virtual const JointEffortsLeg evaluateEffort(const double time) const;
 
+  /*!
+   * Evaluate the joint positions, velocities, and accelerations together,
+   * such that motions can share the trajectory lookup.
+   * @param time the time to evaluate the motion at.
+   * @param position the joint positions.
+   * @param velocity the joint velocities.
+   * @param acceleration the joint accelerations.
+   */
+  virtual void evaluate(const double time, JointPositionsLeg& position, JointVelocitiesLeg& velocity,
+                        JointAccelerationsLeg& acceleration) const;
+
   bool isIgnoreForPoseAdaptation() const;
 
   /*!
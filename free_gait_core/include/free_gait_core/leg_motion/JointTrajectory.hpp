@@ -10,6 +10,8 @@
 
 // Free Gait
 #include "free_gait_core/leg_motion/JointMotionBase.hpp"
+#include "free_gait_core/leg_motion/HermiteSpline.hpp"
+#include "free_gait_core/leg_motion/SampledTrajectory.hpp"
 #include <free_gait_core/TypeDefs.hpp>
 
 // Curves
@@ -17,7 +19,7 @@
 
 namespace free_gait {
 
-class JointTrajectory : public JointMotionBase
+class JointTrajectory final : public JointMotionBase
 {
  public:
   typedef typename curves::PolynomialSplineQuinticScalarCurve::ValueType ValueType;
@@ -46,7 +48,7 @@ class JointTrajectory : public JointMotionBase
 
   const std::vector<JointNodeEnum> getJointNodeEnums() const;
 
-  const ControlSetup getControlSetup() const;
+  const ControlSetup& getControlSetup() const;
 
   /*!
    * Update the trajectory with the foot start position.
@@ -70,6 +72,8 @@ class JointTrajectory : public JointMotionBase
    * @return the duration.
    */
   double getDuration() const;
+  void setSampling(const double timeStep, const SampleInterpolation interpolation);
+  double getSamplingTimeStep() const;
 
   /*!
    * Evaluate the swing foot position at a given swing phase value.
@@ -80,6 +84,8 @@ class JointTrajectory : public JointMotionBase
   const JointVelocitiesLeg evaluateVelocity(const double time) const;
   const JointAccelerationsLeg evaluateAcceleration(const double time) const;
   const JointEffortsLeg evaluateEffort(const double time) const;
+  void evaluate(const double time, JointPositionsLeg& position, JointVelocitiesLeg& velocity,
+                JointAccelerationsLeg& acceleration) const;
 
   bool isIgnoreContact() const;
 
@@ -94,7 +100,21 @@ class JointTrajectory : public JointMotionBase
   friend class StepRosConverter;
 
  private:
+  //! Number of joints of a leg.
+  static constexpr int nJoints = JointPositionsLeg::Implementation::RowsAtCompileTime;
+  typedef Eigen::Matrix<double, nJoints, 1> JointVector;
+
   bool fitTrajectories();
+  bool computeSpline();
+  void sampleTrajectory();
+
+  /*!
+   * Evaluates one derivative of the joint positions from the samples or the spline.
+   * @param time the time.
+   * @param order the order of the derivative (0 for the positions, up to 2).
+   * @return the derivative.
+   */
+  JointVector evaluateDerivative(const double time, const unsigned int order) const;
 
   bool isComputed_;
   bool ignoreContact_;
@@ -107,8 +127,16 @@ class JointTrajectory : public JointMotionBase
 
   double duration_;
 
-  //! Joint trajectories, updated based on knots.
+  //! Joint trajectories of the control levels other than position, updated based on knots.
   std::unordered_map<ControlLevel, std::vector<curves::PolynomialSplineQuinticScalarCurve>, EnumClassHash> trajectories_;
+
+  //! Joint position trajectories as spline, for evaluation of all derivatives at once.
+  HermiteSpline<nJoints> spline_;
+
+  //! Uniformly sampled trajectory, evaluated instead of the spline if sampled.
+  double samplingTimeStep_;
+  SampleInterpolation samplingInterpolation_;
+  SampledTrajectory<nJoints> samples_;
 };
 
 } /* namespace */
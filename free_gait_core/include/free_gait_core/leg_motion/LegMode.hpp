@@ -14,7 +14,7 @@
 
 namespace free_gait {
 
-class LegMode : public EndEffectorMotionBase
+class LegMode final : public EndEffectorMotionBase
 {
  public:
   LegMode(LimbEnum limb);
@@ -34,7 +34,7 @@ class LegMode : public EndEffectorMotionBase
    */
   void updateStartPosition(const Position& startPosition);
 
-  const ControlSetup getControlSetup() const;
+  const ControlSetup& getControlSetup() const;
 
   bool prepareComputation(const State& state, const Step& step, const AdapterBase& adapter);
   bool needsComputation() const;
@@ -48,6 +48,9 @@ class LegMode : public EndEffectorMotionBase
    */
   const Position evaluatePosition(const double time) const;
 
+  void evaluate(const double time, Position& position, LinearVelocity& velocity,
+                LinearAcceleration& acceleration) const;
+
   /*!
    * Returns the total duration of the trajectory.
    * @return the duration.
@@ -60,7 +63,7 @@ class LegMode : public EndEffectorMotionBase
    */
   const Position getTargetPosition() const;
 
-  const std::string& getFrameId() const;
+  FrameId getFrameHandle(const ControlLevel& controlLevel) const;
 
   bool isIgnoreContact() const;
 
@@ -72,7 +75,7 @@ class LegMode : public EndEffectorMotionBase
 
  private:
   Position position_;
-  std::string frameId_;
+  FrameId frameId_;
   double duration_;
   bool ignoreContact_;
   bool ignoreForPoseAdaptation_;
@@ -14,6 +14,7 @@
 #include <free_gait_core/step/Step.hpp>
 #include <free_gait_core/executor/State.hpp>
 #include <free_gait_core/executor/AdapterBase.hpp>
+#include <free_gait_core/leg_motion/SampledTrajectory.hpp>
 
 // STD
 #include <string>
@@ -76,7 +77,7 @@ class LegMotionBase
   LegMotionBase::Type getType() const;
   virtual LegMotionBase::TrajectoryType getTrajectoryType() const;
 
-  virtual const ControlSetup getControlSetup() const;
+  virtual const ControlSetup& getControlSetup() const;
 
   virtual bool prepareComputation(const State& state, const Step& step, const AdapterBase& adapter);
   virtual bool needsComputation() const;
@@ -90,6 +91,16 @@ class LegMotionBase
    */
   virtual double getDuration() const;
 
+  /*!
+   * Sets the motion to be sampled uniformly once computed, afterwards it is
+   * evaluated by table lookup and interpolation (see SampledTrajectory for
+   * the error bounds). An already computed motion is sampled immediately.
+   * @param timeStep the maximum time between two samples, 0 for no sampling.
+   * @param interpolation the interpolation between the samples.
+   */
+  virtual void setSampling(const double timeStep, const SampleInterpolation interpolation);
+  virtual double getSamplingTimeStep() const;
+
   bool hasSurfaceNormal() const;
   const Vector& getSurfaceNormal() const;
   void setSurfaceNormal(const Vector& surfaceNormal);
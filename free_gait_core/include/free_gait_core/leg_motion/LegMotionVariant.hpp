@@ -0,0 +1,240 @@
+/*
+ * LegMotionVariant.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#pragma once
+
+// Free Gait
+#include "free_gait_core/TypeDefs.hpp"
+#include "free_gait_core/executor/FrameRegistry.hpp"
+#include "free_gait_core/leg_motion/LegMotionBase.hpp"
+#include "free_gait_core/leg_motion/Footstep.hpp"
+#include "free_gait_core/leg_motion/EndEffectorTarget.hpp"
+#include "free_gait_core/leg_motion/EndEffectorTrajectory.hpp"
+#include "free_gait_core/leg_motion/LegMode.hpp"
+#include "free_gait_core/leg_motion/JointTrajectory.hpp"
+
+// STD
+#include <stdexcept>
+
+namespace free_gait {
+
+/*!
+ * Type-tagged reference to a leg motion of a concrete type. The type is
+ * resolved once (e.g. when switching to a step), afterwards the motion is
+ * evaluated without dynamic casts. As the concrete motion types are final,
+ * the evaluation calls are direct instead of virtual calls.
+ * Note: The variant does not own the motion, it is invalidated when the
+ * motion is destroyed.
+ */
+class LegMotionVariant
+{
+ public:
+  enum class Type
+  {
+    None,
+    Footstep,
+    EndEffectorTarget,
+    EndEffectorTrajectory,
+    LegMode,
+    JointTrajectory
+  };
+
+  LegMotionVariant()
+      : type_(Type::None),
+        legMotion_(nullptr)
+  {
+  }
+
+  /*!
+   * Constructor.
+   * @param legMotion the leg motion, throws std::invalid_argument for
+   *        motion types which are not supported.
+   */
+  explicit LegMotionVariant(const LegMotionBase& legMotion)
+      : type_(getType(legMotion.getType())),
+        legMotion_(&legMotion)
+  {
+  }
+
+  Type getType() const
+  {
+    return type_;
+  }
+
+  bool empty() const
+  {
+    return type_ == Type::None;
+  }
+
+  bool isEndEffectorMotion() const
+  {
+    return type_ != Type::None && type_ != Type::JointTrajectory;
+  }
+
+  bool isJointMotion() const
+  {
+    return type_ == Type::JointTrajectory;
+  }
+
+  const LegMotionBase& get() const
+  {
+    return *legMotion_;
+  }
+
+  const ControlSetup& getControlSetup() const
+  {
+    switch (type_) {
+      case Type::Footstep: return getFootstep().getControlSetup();
+      case Type::EndEffectorTarget: return getEndEffectorTarget().getControlSetup();
+      case Type::EndEffectorTrajectory: return getEndEffectorTrajectory().getControlSetup();
+      case Type::LegMode: return getLegMode().getControlSetup();
+      case Type::JointTrajectory: return getJointTrajectory().getControlSetup();
+      default: throw std::runtime_error("LegMotionVariant::getControlSetup() called on empty variant.");
+    }
+  }
+
+  /*!
+   * End effector motions: Returns the frame id handle (see FrameRegistry).
+   */
+  FrameId getFrameHandle(const ControlLevel& controlLevel) const
+  {
+    switch (type_) {
+      case Type::Footstep: return getFootstep().getFrameHandle(controlLevel);
+      case Type::EndEffectorTarget: return getEndEffectorTarget().getFrameHandle(controlLevel);
+      case Type::EndEffectorTrajectory: return getEndEffectorTrajectory().getFrameHandle(controlLevel);
+      case Type::LegMode: return getLegMode().getFrameHandle(controlLevel);
+      default: throw std::runtime_error("LegMotionVariant::getFrameHandle() is only valid for end effector motions.");
+    }
+  }
+
+  /*!
+   * End effector motions: Evaluates the end effector at a given time.
+   */
+  Position evaluatePosition(const double time) const
+  {
+    switch (type_) {
+      case Type::Footstep: return getFootstep().evaluatePosition(time);
+      case Type::EndEffectorTarget: return getEndEffectorTarget().evaluatePosition(time);
+      case Type::EndEffectorTrajectory: return getEndEffectorTrajectory().evaluatePosition(time);
+      case Type::LegMode: return getLegMode().evaluatePosition(time);
+      default: throw std::runtime_error("LegMotionVariant::evaluatePosition() is only valid for end effector motions.");
+    }
+  }
+
+  LinearVelocity evaluateVelocity(const double time) const
+  {
+    switch (type_) {
+      case Type::Footstep: return getFootstep().evaluateVelocity(time);
+      case Type::EndEffectorTarget: return getEndEffectorTarget().evaluateVelocity(time);
+      case Type::EndEffectorTrajectory: return getEndEffectorTrajectory().evaluateVelocity(time);
+      case Type::LegMode: return getLegMode().evaluateVelocity(time);
+      default: throw std::runtime_error("LegMotionVariant::evaluateVelocity() is only valid for end effector motions.");
+    }
+  }
+
+  LinearAcceleration evaluateAcceleration(const double time) const
+  {
+    switch (type_) {
+      case Type::Footstep: return getFootstep().evaluateAcceleration(time);
+      case Type::EndEffectorTarget: return getEndEffectorTarget().evaluateAcceleration(time);
+      case Type::EndEffectorTrajectory: return getEndEffectorTrajectory().evaluateAcceleration(time);
+      case Type::LegMode: return getLegMode().evaluateAcceleration(time);
+      default: throw std::runtime_error("LegMotionVariant::evaluateAcceleration() is only valid for end effector motions.");
+    }
+  }
+
+  /*!
+   * End effector motions: Evaluates the position, velocity, and acceleration
+   * of the end effector together at a given time.
+   */
+  void evaluate(const double time, Position& position, LinearVelocity& velocity,
+                LinearAcceleration& acceleration) const
+  {
+    switch (type_) {
+      case Type::Footstep: return getFootstep().evaluate(time, position, velocity, acceleration);
+      case Type::EndEffectorTarget: return getEndEffectorTarget().evaluate(time, position, velocity, acceleration);
+      case Type::EndEffectorTrajectory: return getEndEffectorTrajectory().evaluate(time, position, velocity, acceleration);
+      case Type::LegMode: return getLegMode().evaluate(time, position, velocity, acceleration);
+      default: throw std::runtime_error("LegMotionVariant::evaluate() is only valid for end effector motions.");
+    }
+  }
+
+  /*!
+   * Joint motions: Evaluates the joints at a given time.
+   */
+  JointPositionsLeg evaluateJointPositions(const double time) const
+  {
+    return getJointTrajectory().evaluatePosition(time);
+  }
+
+  JointVelocitiesLeg evaluateJointVelocities(const double time) const
+  {
+    return getJointTrajectory().evaluateVelocity(time);
+  }
+
+  JointAccelerationsLeg evaluateJointAccelerations(const double time) const
+  {
+    return getJointTrajectory().evaluateAcceleration(time);
+  }
+
+  JointEffortsLeg evaluateJointEfforts(const double time) const
+  {
+    return getJointTrajectory().evaluateEffort(time);
+  }
+
+  void evaluateJoints(const double time, JointPositionsLeg& position, JointVelocitiesLeg& velocity,
+                      JointAccelerationsLeg& acceleration) const
+  {
+    getJointTrajectory().evaluate(time, position, velocity, acceleration);
+  }
+
+ private:
+  static Type getType(const LegMotionBase::Type& type)
+  {
+    switch (type) {
+      case LegMotionBase::Type::Footstep: return Type::Footstep;
+      case LegMotionBase::Type::EndEffectorTarget: return Type::EndEffectorTarget;
+      case LegMotionBase::Type::EndEffectorTrajectory: return Type::EndEffectorTrajectory;
+      case LegMotionBase::Type::LegMode: return Type::LegMode;
+      case LegMotionBase::Type::JointTrajectory: return Type::JointTrajectory;
+      default: throw std::invalid_argument("LegMotionVariant: Leg motion type is not supported.");
+    }
+  }
+
+  const Footstep& getFootstep() const
+  {
+    return static_cast<const Footstep&>(*legMotion_);
+  }
+
+  const EndEffectorTarget& getEndEffectorTarget() const
+  {
+    return static_cast<const EndEffectorTarget&>(*legMotion_);
+  }
+
+  const EndEffectorTrajectory& getEndEffectorTrajectory() const
+  {
+    return static_cast<const EndEffectorTrajectory&>(*legMotion_);
+  }
+
+  const LegMode& getLegMode() const
+  {
+    return static_cast<const LegMode&>(*legMotion_);
+  }
+
+  const JointTrajectory& getJointTrajectory() const
+  {
+    if (type_ != Type::JointTrajectory) {
+      throw std::runtime_error("LegMotionVariant: Joint evaluation is only valid for joint motions.");
+    }
+    return static_cast<const JointTrajectory&>(*legMotion_);
+  }
+
+  Type type_;
+  const LegMotionBase* legMotion_;
+};
+
+} /* namespace free_gait */
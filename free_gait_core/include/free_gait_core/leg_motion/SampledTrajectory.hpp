@@ -0,0 +1,210 @@
+/*
+ * SampledTrajectory.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#pragma once
+
+// Eigen
+#include <Eigen/Core>
+#include <Eigen/StdVector>
+
+// STD
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace free_gait {
+
+//! Interpolation between the samples of a sampled trajectory.
+enum class SampleInterpolation
+{
+  Linear,
+  Cubic
+};
+
+/*!
+ * Trajectory sampled at uniform times, evaluated by table lookup and
+ * interpolation between the two neighboring samples. The value and its first
+ * and second derivative are sampled.
+ *
+ * Error bounds for a sample interval of length h, per component of an
+ * interpolated quantity f (value, first, or second derivative):
+ * - Linear: The value, first, and second derivative are interpolated
+ *   linearly, the error is at most h^2 / 8 * max|f''| on the interval.
+ * - Cubic: The value is interpolated from the values and first derivatives,
+ *   the first derivative from the first and second derivatives (cubic Hermite
+ *   interpolation), the error is at most h^4 / 384 * max|f''''| on the
+ *   interval. The second derivative is interpolated linearly (see above).
+ * The bounds hold on intervals on which the trajectory is smooth. Cubic
+ * Hermite curves (e.g. footsteps) are cubic between their knots, hence cubic
+ * interpolation reproduces them exactly except for the intervals containing
+ * a knot, where their second derivative is discontinuous.
+ */
+template<int Dimension>
+class SampledTrajectory
+{
+ public:
+  typedef Eigen::Matrix<double, Dimension, 1> ValueType;
+
+  SampledTrajectory()
+      : timeStep_(0.0),
+        interpolation_(SampleInterpolation::Cubic)
+  {
+  }
+
+  void clear()
+  {
+    timeStep_ = 0.0;
+    values_.clear();
+    firstDerivatives_.clear();
+    secondDerivatives_.clear();
+  }
+
+  bool empty() const
+  {
+    return values_.empty();
+  }
+
+  size_t size() const
+  {
+    return values_.size();
+  }
+
+  /*!
+   * Samples a trajectory.
+   * @param duration the duration of the trajectory.
+   * @param maxTimeStep the maximum time between two samples. The time step is
+   *        chosen such that the duration is divided in uniform intervals.
+   * @param interpolation the interpolation between the samples.
+   * @param evaluator the function evaluating the trajectory, with the
+   *        signature void(double time, ValueType& value, ValueType& firstDerivative,
+   *        ValueType& secondDerivative).
+   */
+  template<typename Evaluator>
+  void sample(const double duration, const double maxTimeStep, const SampleInterpolation interpolation,
+              Evaluator evaluator)
+  {
+    if (maxTimeStep <= 0.0) throw std::invalid_argument("SampledTrajectory: Time step must be positive.");
+    const size_t nIntervals = duration > 0.0 ? static_cast<size_t>(std::ceil(duration / maxTimeStep)) : 0;
+    timeStep_ = nIntervals > 0 ? duration / nIntervals : maxTimeStep;
+    interpolation_ = interpolation;
+    values_.resize(nIntervals + 1);
+    firstDerivatives_.resize(nIntervals + 1);
+    secondDerivatives_.resize(nIntervals + 1);
+    for (size_t i = 0; i <= nIntervals; ++i) {
+      const double time = i < nIntervals ? i * timeStep_ : duration;
+      evaluator(time, values_[i], firstDerivatives_[i], secondDerivatives_[i]);
+    }
+  }
+
+  double getTimeStep() const
+  {
+    return timeStep_;
+  }
+
+  SampleInterpolation getInterpolation() const
+  {
+    return interpolation_;
+  }
+
+  const ValueType& getValue(const size_t index) const
+  {
+    return values_[index];
+  }
+
+  /*!
+   * Returns the sample interval containing a time.
+   * @param time the time, clamped to the sampled duration.
+   * @param phase the phase of the time in the interval in [0, 1].
+   * @return the index of the first sample of the interval.
+   */
+  size_t getInterval(const double time, double& phase) const
+  {
+    if (values_.size() < 2 || time <= 0.0) {
+      phase = 0.0;
+      return 0;
+    }
+    const double position = time / timeStep_;
+    const size_t lastIndex = values_.size() - 2;
+    const size_t index = std::min(static_cast<size_t>(position), lastIndex);
+    phase = std::min(position - index, 1.0);
+    return index;
+  }
+
+  /*!
+   * Evaluates the sampled trajectory and its derivatives at a given time.
+   * @param time the time, clamped to the sampled duration.
+   * @param value the value.
+   * @param firstDerivative the first derivative.
+   * @param secondDerivative the second derivative.
+   */
+  void evaluate(const double time, ValueType& value, ValueType& firstDerivative, ValueType& secondDerivative) const
+  {
+    if (values_.empty()) throw std::runtime_error("SampledTrajectory::evaluate() cannot be called if not sampled.");
+    if (values_.size() == 1) {
+      value = values_.front();
+      firstDerivative = firstDerivatives_.front();
+      secondDerivative = secondDerivatives_.front();
+      return;
+    }
+    double s;
+    const size_t i = getInterval(time, s);
+    secondDerivative = (1.0 - s) * secondDerivatives_[i] + s * secondDerivatives_[i + 1];
+    if (interpolation_ == SampleInterpolation::Linear) {
+      value = (1.0 - s) * values_[i] + s * values_[i + 1];
+      firstDerivative = (1.0 - s) * firstDerivatives_[i] + s * firstDerivatives_[i + 1];
+      return;
+    }
+    interpolateCubic(s, values_[i], firstDerivatives_[i], values_[i + 1], firstDerivatives_[i + 1], value);
+    interpolateCubic(s, firstDerivatives_[i], secondDerivatives_[i], firstDerivatives_[i + 1],
+                     secondDerivatives_[i + 1], firstDerivative);
+  }
+
+  /*!
+   * Evaluates only one derivative of the sampled trajectory (see evaluate()).
+   * @param time the time, clamped to the sampled duration.
+   * @param order the order of the derivative (0 for the value, up to 2).
+   * @return the derivative.
+   */
+  ValueType evaluateDerivative(const double time, const unsigned int order) const
+  {
+    if (values_.empty()) throw std::runtime_error("SampledTrajectory::evaluate() cannot be called if not sampled.");
+    if (order > 2) throw std::invalid_argument("SampledTrajectory: Derivatives are supported up to second order.");
+    const Values& derivatives = order == 0 ? values_ : (order == 1 ? firstDerivatives_ : secondDerivatives_);
+    if (values_.size() == 1) return derivatives.front();
+    double s;
+    const size_t i = getInterval(time, s);
+    if (order == 2 || interpolation_ == SampleInterpolation::Linear) {
+      return (1.0 - s) * derivatives[i] + s * derivatives[i + 1];
+    }
+    const Values& nextDerivatives = order == 0 ? firstDerivatives_ : secondDerivatives_;
+    ValueType value;
+    interpolateCubic(s, derivatives[i], nextDerivatives[i], derivatives[i + 1], nextDerivatives[i + 1], value);
+    return value;
+  }
+
+ private:
+  //! Cubic Hermite interpolation at phase s in [0, 1].
+  void interpolateCubic(const double s, const ValueType& value0, const ValueType& derivative0,
+                        const ValueType& value1, const ValueType& derivative1, ValueType& value) const
+  {
+    const double s2 = s * s;
+    const double s3 = s2 * s;
+    value = (2.0 * s3 - 3.0 * s2 + 1.0) * value0 + (s3 - 2.0 * s2 + s) * timeStep_ * derivative0
+        + (-2.0 * s3 + 3.0 * s2) * value1 + (s3 - s2) * timeStep_ * derivative1;
+  }
+
+  typedef std::vector<ValueType, Eigen::aligned_allocator<ValueType>> Values;
+
+  double timeStep_;
+  SampleInterpolation interpolation_;
+  Values values_;
+  Values firstDerivatives_;
+  Values secondDerivatives_;
+};
+
+} /* namespace free_gait */
@@ -16,3 +16,6 @@
 #include "free_gait_core/leg_motion/EndEffectorTarget.hpp"
 #include "free_gait_core/leg_motion/LegMode.hpp"
 #include "free_gait_core/leg_motion/JointTrajectory.hpp"
+#include "free_gait_core/leg_motion/LegMotionVariant.hpp"
+#include "free_gait_core/leg_motion/HermiteSpline.hpp"
+#include "free_gait_core/leg_motion/SampledTrajectory.hpp"
@@ -34,10 +34,53 @@ class PoseOptimizationQP : public PoseOptimizationBase
    */
   bool optimize(Pose& pose);
 
+  /*!
+   * Use the generic active set QP solver instead of the closed-form solution
+   * (default: false). Both yield the same result up to numerical precision.
+   * @param useGenericSolver true if the generic solver should be used.
+   */
+  void setUseGenericSolver(const bool useGenericSolver);
+  bool usesGenericSolver() const;
+
+  /*!
+   * Solves the position QP in closed form without heap allocations.
+   * The cost is the sum of squared distances between the feet and the nominal
+   * stance (Hessian 2nI), hence the unconstrained optimum is the mean offset
+   * and the constrained optimum is its Euclidean projection onto the support
+   * region. The active sets are enumerated analytically: none (inside), one
+   * (closest point on an edge) or two (vertex).
+   * @param stance the feet positions in world frame.
+   * @param nominalStanceInBaseFrame the nominal feet positions in base frame.
+   * @param orientation the orientation of the base.
+   * @param centerOfMassInBaseFrame the center of mass in base frame.
+   * @param supportRegion the (convex) support region for the center of mass.
+   * @param[out] position the optimal position of the base.
+   * @return true if successful, false if the stance is empty.
+   */
+  static bool optimizePosition(const Stance& stance, const Stance& nominalStanceInBaseFrame,
+                               const RotationMatrix& orientation, const Position& centerOfMassInBaseFrame,
+                               const grid_map::Polygon& supportRegion, Position& position);
+
+  /*!
+   * Solves the position QP with the generic active set solver.
+   * See optimizePosition() for the parameters.
+   */
+  bool optimizePositionWithGenericSolver(const Stance& stance, const Stance& nominalStanceInBaseFrame,
+                                         const RotationMatrix& orientation, const Position& centerOfMassInBaseFrame,
+                                         const grid_map::Polygon& supportRegion, Position& position);
+
  private:
+  /*!
+   * Projects a point onto a convex polygon (vertices in either order).
+   * @param[in] polygon the polygon.
+   * @param[in/out] point the point to project.
+   */
+  static void projectOntoPolygon(const grid_map::Polygon& polygon, Eigen::Vector2d& point);
+
   std::unique_ptr<numopt_common::QuadraticProblemSolver> solver_;
   unsigned int nStates_;
   unsigned int nDimensions_;
+  bool useGenericSolver_;
 };
 
 } /* namespace loco */
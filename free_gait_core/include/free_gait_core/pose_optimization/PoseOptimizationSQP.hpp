@@ -20,9 +20,17 @@
 #include <std_utils/timers/ChronoTimer.hpp>
 
 #include <limits>
+#include <memory>
+#include <vector>
+
+namespace numopt_sqp {
+class SQPFunctionMinimizer;
+}
 
 namespace free_gait {
 
+class PoseOptimizationProblem;
+
 class PoseOptimizationSQP : public PoseOptimizationBase
 {
  public:
@@ -45,12 +53,57 @@ class PoseOptimizationSQP : public PoseOptimizationBase
   void registerOptimizationStepCallback(OptimizationStepCallbackFunction callback);
 
   /*!
-   * Computes the optimized pose with SQP.
+   * Computes the optimized pose with SQP. The solver is kept between calls. If
+   * warm starting is enabled and the solution of the previous call (shifted
+   * with the stance) is a better start than the provided pose, the minimizer
+   * starts from the previous solution.
    * @param[in/out] pose the optimized pose from the provided initial pose.
    * @return true if successful, false otherwise.
    */
   bool optimize(Pose& pose);
 
+  /*!
+   * Sets the max. number of SQP iterations per optimization.
+   * @param maxIterations the max. number of iterations.
+   */
+  void setMaxIterations(const size_t maxIterations);
+  size_t getMaxIterations() const;
+
+  /*!
+   * Sets the time budget for an optimization. The number of iterations is
+   * limited based on the measured duration of the iterations of the previous
+   * optimizations.
+   * @param maxDuration the max. duration in micro seconds, 0 for no limit.
+   */
+  void setMaxDuration(const double maxDuration);
+  double getMaxDuration() const;
+
+  /*!
+   * Returns the max. number of iterations for the next optimization
+   * considering the time budget.
+   * @return the number of iterations.
+   */
+  size_t getIterationBudget() const;
+
+  /*!
+   * Enables/disables warm starting from the solution of the previous optimization.
+   * @param useWarmStart true if warm starting should be used.
+   */
+  void setWarmStart(const bool useWarmStart);
+  bool usesWarmStart() const;
+
+  /*!
+   * Discards the solution of the previous optimization.
+   */
+  void resetWarmStart();
+
+  /*!
+   * Returns whether the last optimization was started from the solution of
+   * the previous optimization.
+   * @return true if the last optimization was warm started.
+   */
+  bool isWarmStarted() const;
+
   void optimizationStepCallback(const size_t iterationStep, const numopt_common::Parameterization& parameters,
                                 const double functionValue, const bool finalIteration);
 
@@ -70,6 +123,23 @@ class PoseOptimizationSQP : public PoseOptimizationBase
                                                 std::numeric_limits<double>::max(),
                                             const bool finalIteration = false);
 
+  /*!
+   * Returns the solver for an iteration budget. The iteration limit of the
+   * SQP minimizer is fixed at construction, hence a solver is built once per
+   * budget and kept for later optimizations.
+   */
+  numopt_sqp::SQPFunctionMinimizer& getSolver(const size_t maxIterations);
+
+  /*!
+   * Updates the initial pose with the solution of the previous optimization if
+   * it satisfies the constraints at least as well and has a lower cost.
+   * @param[in/out] pose the initial pose.
+   * @return true if the initial pose was replaced, false otherwise.
+   */
+  bool applyWarmStart(Pose& pose);
+  bool evaluate(const Pose& pose, double& value, double& constraintViolation);
+  Position getStanceCenter() const;
+
   State originalState_;
 
   //! State being optimized.
@@ -77,10 +147,26 @@ class PoseOptimizationSQP : public PoseOptimizationBase
 
   std::shared_ptr<PoseOptimizationObjectiveFunction> objective_;
   std::shared_ptr<PoseOptimizationFunctionConstraints> constraints_;
+  std::unique_ptr<PoseOptimizationProblem> problem_;
+  std::shared_ptr<numopt_common::QuadraticProblemSolver> qpSolver_;
+  //! Solvers by iteration budget (index: budget - 1).
+  std::vector<std::unique_ptr<numopt_sqp::SQPFunctionMinimizer>> solvers_;
   OptimizationStepCallbackFunction optimizationStepCallback_;
   std_utils::HighResolutionClockTimer timer_;
   double durationInCallback_;
   size_t nIterations_;
+
+  //! Budget.
+  size_t maxIterations_;
+  double maxDuration_;
+  double iterationDuration_;
+
+  //! Warm start.
+  bool useWarmStart_;
+  bool hasWarmStart_;
+  bool isWarmStarted_;
+  Position warmStartPositionInStanceFrame_;
+  RotationQuaternion warmStartOrientation_;
 };
 
 } /* namespace loco */
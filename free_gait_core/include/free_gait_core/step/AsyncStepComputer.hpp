@@ -0,0 +1,120 @@
+/*
+ * AsyncStepComputer.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#pragma once
+
+#include "free_gait_core/step/StepComputer.hpp"
+
+// STD
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace free_gait {
+
+/*!
+ * Step computer which computes the steps on a pool of worker threads.
+ * compute() only queues the step and returns immediately, the executor
+ * collects the result once isDone() returns true. Additionally, copies of
+ * upcoming steps can be precomputed in the background (see getLookahead()).
+ */
+class AsyncStepComputer : public StepComputer
+{
+ public:
+  /*!
+   * Constructor.
+   * @param nThreads the number of worker threads.
+   * @param lookahead the number of upcoming steps to precompute.
+   */
+  AsyncStepComputer(const size_t nThreads = 1, const size_t lookahead = 1);
+
+  /*!
+   * Destructor, stops the worker threads.
+   */
+  virtual ~AsyncStepComputer();
+
+  /*!
+   * Starts the worker threads.
+   * @return true if successful, false otherwise.
+   */
+  bool initialize();
+
+  /*!
+   * Queues the step set with setStep() for computation. Does not block.
+   * @return true if the computation was queued, false otherwise.
+   */
+  bool compute();
+  bool isBusy();
+  bool isDone();
+  void resetIsDone();
+  void setStep(const Step& step);
+  void getStep(Step& step);
+
+  size_t getLookahead() const;
+  void setLookahead(const size_t lookahead);
+  size_t getNumberOfThreads() const;
+
+  bool precompute(const Step& step);
+  bool hasPrecomputation(const std::string& stepId);
+
+  /*!
+   * Takes the result of a precomputation. The precomputation is removed,
+   * also if it is not done yet.
+   * @param stepId the id of the step.
+   * @param step the precomputed step.
+   * @return true if the precomputation was done and successful, false otherwise.
+   */
+  bool getPrecomputedStep(const std::string& stepId, Step& step);
+  void clearPrecomputations();
+
+  /*!
+   * Blocks until all queued computations (including precomputations) are
+   * finished.
+   * @param timeout the max. duration to wait [s].
+   * @return true if all computations are finished, false if timed out.
+   */
+  bool waitUntilIdle(const double timeout);
+
+ private:
+  struct Job
+  {
+    Job(const Step& step);
+    Step step_;
+    std::atomic<bool> isDone_;
+    bool isSuccessful_;
+  };
+
+  void work();
+
+  const size_t nThreads_;
+  size_t lookahead_;
+  std::vector<std::thread> workers_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  bool isStopping_;
+
+  //! Number of jobs being computed by the workers.
+  size_t nRunningJobs_;
+  std::condition_variable idleCondition_;
+
+  //! Queued jobs, the job of the current step is queued in front.
+  std::deque<std::shared_ptr<Job>> queuedJobs_;
+
+  //! Job of the step set with setStep().
+  std::shared_ptr<Job> currentJob_;
+
+  //! Precomputation jobs by step id.
+  std::unordered_map<std::string, std::shared_ptr<Job>> precomputations_;
+};
+
+} /* namespace */
@@ -9,6 +9,7 @@
 #pragma once
 
 // STL
+#include <cstdint>
 #include <string>
 #include <unordered_map>
 #include <iostream>
@@ -58,6 +59,7 @@ class Step
 
   bool needsComputation() const;
   bool compute();
+  bool isComputed() const;
 
   bool update();
   bool isUpdated() const;
@@ -103,9 +105,18 @@ class Step
   const std::string& getId() const;
   void setId(const std::string& id);
 
+  /*!
+   * Returns the number which is assigned when the step is first added to a
+   * step queue. Unlike the id, which is set by the user, it identifies the
+   * queued step. Copies keep the number.
+   * @return the sequence number, 0 if the step has not been queued.
+   */
+  uint64_t getSequenceNumber() const;
+
   friend std::ostream& operator << (std::ostream& out, const Step& step);
 
   friend class StepCompleter;
+  friend class StepQueue;
 
  protected:
   LegMotions legMotions_;
@@ -119,6 +130,7 @@ class Step
   bool isUpdated_;
   bool isComputed_;
   std::string id_;
+  uint64_t sequenceNumber_;
 };
 
 } /* namespace */
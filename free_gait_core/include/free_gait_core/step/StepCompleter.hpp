@@ -17,6 +17,10 @@
 #include "free_gait_core/base_motion/base_motion.hpp"
 #include "free_gait_core/leg_motion/leg_motion.hpp"
 
+// STD
+#include <memory>
+#include <mutex>
+
 namespace free_gait {
 
 class StepCompleter
@@ -25,20 +29,57 @@ class StepCompleter
   StepCompleter(const StepParameters& parameters, const AdapterBase& adapter);
   virtual ~StepCompleter();
   bool complete(const State& state, const StepQueue& queue, Step& step);
+
+  /*!
+   * Completes the step and takes over the computed motions from a precomputed
+   * copy of the step. The precomputed copy has to be completed from the same
+   * start state, otherwise the step is left to be computed.
+   * @param state the state at the start of the step.
+   * @param queue the step queue.
+   * @param precomputedStep the computed copy of the step.
+   * @param step the step to complete.
+   * @return true if successful, false otherwise.
+   */
+  bool complete(const State& state, const StepQueue& queue, const Step& precomputedStep, Step& step);
+
+  /*!
+   * Completes only the joint motions of a step. Used to prepare the
+   * precomputation of upcoming steps from a predicted start state.
+   * @param state the (predicted) state at the start of the step.
+   * @param step the step to complete.
+   * @return true if successful, false otherwise.
+   */
+  bool completeJointMotions(const State& state, Step& step) const;
   bool complete(const State& state, const Step& step, EndEffectorMotionBase& endEffectorMotion) const;
   bool complete(const State& state, const Step& step, JointMotionBase& jointMotion) const;
   bool complete(const State& state, const Step& step, const StepQueue& queue, BaseMotionBase& baseMotion) const;
   void setParameters(LegMotionBase& legMotion) const;
   void setParameters(Footstep& footstep) const;
   void setParameters(EndEffectorTarget& endEffectorMotion) const;
+  void setParameters(EndEffectorTrajectory& endEffectorTrajectory) const;
+  void setParameters(JointTrajectory& jointTrajectory) const;
   void setParameters(LegMode& legMode) const;
   void setParameters(BaseAuto& baseAuto) const;
   void setParameters(BaseTarget& baseTarget) const;
   void setParameters(BaseTrajectory& baseTrajectory) const;
+  const StepParameters& getParameters() const;
 
  private:
+  /*!
+   * Returns the optimization which is kept across the steps completed by this
+   * completer, such that the SQP pose optimization is warm started from the
+   * previous step. Created once on first use (safe to call concurrently).
+   * Completers which are created per simulation (speculative completion,
+   * segments of the parallel batch executor, candidate evaluation) start
+   * without warm start.
+   * @return the optimization, nullptr if the adapter does not support copies.
+   */
+  std::shared_ptr<BaseAuto::PersistentOptimization> getPersistentOptimization() const;
+
   const StepParameters& parameters_;
   const AdapterBase& adapter_;
+  mutable std::once_flag persistentOptimizationFlag_;
+  mutable std::shared_ptr<BaseAuto::PersistentOptimization> persistentOptimization_;
 };
 
 } /* namespace */
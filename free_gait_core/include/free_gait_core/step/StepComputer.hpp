@@ -10,6 +10,8 @@
 
 #include "free_gait_core/step/Step.hpp"
 
+#include <string>
+
 namespace free_gait {
 
 class StepComputer
@@ -22,8 +24,38 @@ class StepComputer
   virtual bool isBusy();
   virtual bool isDone();
   virtual void resetIsDone();
-  void setStep(const Step& step);
-  void getStep(Step& step);
+  virtual void setStep(const Step& step);
+  virtual void getStep(Step& step);
+
+  /*!
+   * Returns the number of upcoming steps the computer wants to precompute.
+   * The default computer does not support precomputation.
+   * @return the number of steps to look ahead.
+   */
+  virtual size_t getLookahead() const;
+
+  /*!
+   * Starts the precomputation of an (already completed) copy of an upcoming step.
+   * @param step the step to precompute.
+   * @return true if the precomputation was started, false otherwise.
+   */
+  virtual bool precompute(const Step& step);
+
+  /*!
+   * Checks if a precomputation was started for a step.
+   * @param stepId the id of the step.
+   * @return true if a precomputation is running or done, false otherwise.
+   */
+  virtual bool hasPrecomputation(const std::string& stepId);
+
+  /*!
+   * Takes the result of a finished precomputation.
+   * @param stepId the id of the step.
+   * @param step the precomputed step.
+   * @return true if the precomputation is done and was successful, false otherwise.
+   */
+  virtual bool getPrecomputedStep(const std::string& stepId, Step& step);
+  virtual void clearPrecomputations();
 
  protected:
   Step step_;
@@ -10,6 +10,7 @@
 
 #include "free_gait_core/TypeDefs.hpp"
 #include "free_gait_core/step/StepCompleter.hpp"
+#include "free_gait_core/leg_motion/SampledTrajectory.hpp"
 
 namespace free_gait {
 
@@ -49,6 +50,8 @@ class StepParameters
     double averageAngularVelocity = 0.28;
     double supportMargin = 0.04;
     double minimumDuration = 0.1;
+    size_t maxOptimizationIterations = 30;
+    double maxOptimizationDuration = 0.0; // In micro seconds, 0 for no limit.
     PlanarStance nominalPlanarStanceInBaseFrame;
 
     BaseAutoParameters()
@@ -77,6 +80,13 @@ class StepParameters
     }
 
   } baseTrajectoryParameters;
+
+  //! Sampling of the trajectories of footsteps, end effector and joint trajectories, and auto base motions.
+  struct SamplingParameters
+  {
+    double timeStep = 0.0; // 0 for no sampling.
+    SampleInterpolation interpolation = SampleInterpolation::Cubic;
+  } samplingParameters;
 };
 
 } /* namespace */
@@ -96,6 +96,13 @@ class StepQueue
   bool previousStepExists() const;
   const Step& getPreviousStep() const;
 
+  /*!
+   * Sets the previous step, e.g. when continuing a step sequence
+   * in a new queue.
+   * @param step the previous step.
+   */
+  void setPreviousStep(const Step& step);
+
   /*!
    * Returns the number of steps in the queue.
    * @return the number of steps.
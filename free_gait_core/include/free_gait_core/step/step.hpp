@@ -12,5 +12,6 @@
 #include "free_gait_core/step/StepQueue.hpp"
 #include "free_gait_core/step/StepCompleter.hpp"
 #include "free_gait_core/step/StepComputer.hpp"
+#include "free_gait_core/step/AsyncStepComputer.hpp"
 #include "free_gait_core/step/StepParameters.hpp"
 #include "free_gait_core/step/CustomCommand.hpp"
@@ -16,16 +16,21 @@ namespace free_gait {
 
 BaseAuto::BaseAuto()
     : BaseMotionBase(BaseMotionBase::Type::Auto),
+      frameId_(FrameRegistry::invalidFrameId),
       ignoreTimingOfLegMotion_(false),
       averageLinearVelocity_(0.0),
       averageAngularVelocity_(0.0),
       duration_(0.0),
       supportMargin_(0.0),
       minimumDuration_(0.0),
+      maxOptimizationIterations_(30),
+      maxOptimizationDuration_(0.0),
       isComputed_(false),
       tolerateFailingOptimization_(false),
       controlSetup_ { {ControlLevel::Position, true}, {ControlLevel::Velocity, true},
-                      {ControlLevel::Acceleration, false}, {ControlLevel::Effort, false} }
+                      {ControlLevel::Acceleration, false}, {ControlLevel::Effort, false} },
+      samplingTimeStep_(0.0),
+      samplingInterpolation_(SampleInterpolation::Cubic)
 {
 }
 
@@ -35,17 +40,25 @@ BaseAuto::~BaseAuto()
 
 BaseAuto::BaseAuto(const BaseAuto& other) :
     BaseMotionBase(other),
+    frameId_(other.frameId_),
     ignoreTimingOfLegMotion_(other.ignoreTimingOfLegMotion_),
     averageLinearVelocity_(other.averageLinearVelocity_),
     averageAngularVelocity_(other.averageAngularVelocity_),
     supportMargin_(other.supportMargin_),
     minimumDuration_(other.minimumDuration_),
+    maxOptimizationIterations_(other.maxOptimizationIterations_),
+    maxOptimizationDuration_(other.maxOptimizationDuration_),
     start_(other.start_),
     target_(other.target_),
     duration_(other.duration_),
     nominalPlanarStanceInBaseFrame_(other.nominalPlanarStanceInBaseFrame_),
     controlSetup_(other.controlSetup_),
     trajectory_(other.trajectory_),
+    samplingTimeStep_(other.samplingTimeStep_),
+    samplingInterpolation_(other.samplingInterpolation_),
+    sampledPositions_(other.sampledPositions_),
+    sampledOrientations_(other.sampledOrientations_),
+    sampledAngularVelocities_(other.sampledAngularVelocities_),
     footholdsToReach_(other.footholdsToReach_),
     footholdsInSupport_(other.footholdsInSupport_),
     footholdsOfNextLegMotion_(other.footholdsOfNextLegMotion_),
@@ -62,7 +75,7 @@ std::unique_ptr<BaseMotionBase> BaseAuto::clone() const
   return pointer;
 }
 
-const ControlSetup BaseAuto::getControlSetup() const
+const ControlSetup& BaseAuto::getControlSetup() const
 {
   return controlSetup_;
 }
@@ -75,9 +88,28 @@ void BaseAuto::updateStartPose(const Pose& startPose)
 
 bool BaseAuto::prepareComputation(const State& state, const Step& step, const StepQueue& queue, const AdapterBase& adapter)
 {
-  // TODO This shouldn't be necessary if we could create copies of the adapter.
+  std::unique_lock<std::mutex> lock;
+  if (persistentOptimization_) lock = std::unique_lock<std::mutex>(persistentOptimization_->mutex);
+
+  // The optimizers modify the adapter. Work on an independent copy if possible,
+  // otherwise restore the state of the adapter afterwards. The copy kept
+  // across steps is updated instead of creating a new one.
+  if (persistentOptimization_ && adapter.updateClone(*persistentOptimization_->adapter)) {
+    persistentOptimization_->adapter->resetFrameTransformCache();
+    return prepareComputationWithAdapter(state, step, queue, *persistentOptimization_->adapter);
+  }
+  adapterCopy_ = adapter.clone();
+  if (adapterCopy_) return prepareComputationWithAdapter(state, step, queue, *adapterCopy_);
+
   adapter.createCopyOfState();
+  const bool success = prepareComputationWithAdapter(state, step, queue, adapter);
+  adapter.resetToCopyOfState();
+  return success;
+}
 
+bool BaseAuto::prepareComputationWithAdapter(const State& state, const Step& step, const StepQueue& queue,
+                                             const AdapterBase& adapter)
+{
   if (!height_) {
     if (!computeHeight(state, queue, adapter)) {
       std::cerr << "BaseAuto::compute: Could not compute height." << std::endl;
@@ -135,7 +167,13 @@ bool BaseAuto::prepareComputation(const State& state, const Step& step, const St
   constraintsChecker_->setLimbLengthConstraints(minLimbLenghts_, maxLimbLenghts_);
   constraintsChecker_->setTolerances(0.02, 0.0); // TODO Make parameter.
 
-  poseOptimizationSQP_.reset(new PoseOptimizationSQP(adapter));
+  if (persistentOptimization_) {
+    poseOptimizationSQP_ = persistentOptimization_->poseOptimizationSQP;
+  } else {
+    poseOptimizationSQP_.reset(new PoseOptimizationSQP(adapter));
+  }
+  poseOptimizationSQP_->setMaxIterations(maxOptimizationIterations_);
+  poseOptimizationSQP_->setMaxDuration(maxOptimizationDuration_);
   poseOptimizationSQP_->setCurrentState(state);
   poseOptimizationSQP_->setStance(footholdsToReach_);
   poseOptimizationSQP_->setSupportStance(footholdsInSupport_);
@@ -159,10 +197,6 @@ bool BaseAuto::prepareComputation(const State& state, const Step& step, const St
 
   computeDuration(state, step, adapter);
   computeTrajectory();
-
-  // TODO This shouldn't be necessary if we could create copies of the adapter.
-  adapter.resetToCopyOfState();
-
   return isComputed_ = true;
 }
 
@@ -181,6 +215,9 @@ void BaseAuto::reset()
   start_.setIdentity();
   target_.setIdentity();
   duration_ = 0.0;
+  sampledPositions_.clear();
+  sampledOrientations_.clear();
+  sampledAngularVelocities_.clear();
   isComputed_ = false;
 }
 
@@ -188,6 +225,11 @@ Pose BaseAuto::evaluatePose(const double time) const
 {
   double timeInRange = time <= duration_ ? time : duration_;
   Pose pose;
+  if (!sampledPositions_.empty()) {
+    Twist twist;
+    evaluate(timeInRange, pose, twist);
+    return pose;
+  }
   trajectory_.evaluate(pose, timeInRange);
   return pose;
 }
@@ -195,6 +237,12 @@ Pose BaseAuto::evaluatePose(const double time) const
 Twist BaseAuto::evaluateTwist(const double time) const
 {
   double timeInRange = time <= duration_ ? time : duration_;
+  if (!sampledPositions_.empty()) {
+    Pose pose;
+    Twist twist;
+    evaluate(timeInRange, pose, twist);
+    return twist;
+  }
   curves::CubicHermiteSE3Curve::DerivativeType derivative;
   trajectory_.evaluateDerivative(derivative, timeInRange, 1);
   Twist twist(derivative.getTranslationalVelocity().vector(),
@@ -202,12 +250,43 @@ Twist BaseAuto::evaluateTwist(const double time) const
   return twist;
 }
 
+void BaseAuto::evaluate(const double time, Pose& pose, Twist& twist) const
+{
+  if (sampledPositions_.empty()) return BaseMotionBase::evaluate(time, pose, twist);
+  double timeInRange = time <= duration_ ? time : duration_;
+  Eigen::Vector3d position, linearVelocity, linearAcceleration;
+  sampledPositions_.evaluate(timeInRange, position, linearVelocity, linearAcceleration);
+  double phase;
+  const size_t index = sampledOrientations_.getInterval(timeInRange, phase);
+  const Eigen::Vector4d& start = sampledOrientations_.getValue(index);
+  const Eigen::Vector4d& end = sampledOrientations_.getValue(std::min(index + 1, sampledOrientations_.size() - 1));
+  const Eigen::Quaterniond orientation = Eigen::Quaterniond(start(0), start(1), start(2), start(3)).slerp(
+      phase, Eigen::Quaterniond(end(0), end(1), end(2), end(3)));
+  Eigen::Vector3d angularVelocity, angularVelocityDerivative, angularVelocitySecondDerivative;
+  sampledAngularVelocities_.evaluate(timeInRange, angularVelocity, angularVelocityDerivative,
+                                     angularVelocitySecondDerivative);
+  pose = Pose(Position(position), RotationQuaternion(orientation));
+  twist = Twist(linearVelocity, angularVelocity);
+}
+
 double BaseAuto::getDuration() const
 {
   return duration_;
 }
 
-const std::string& BaseAuto::getFrameId(const ControlLevel& controlLevel) const
+void BaseAuto::setSampling(const double timeStep, const SampleInterpolation interpolation)
+{
+  samplingTimeStep_ = timeStep;
+  samplingInterpolation_ = interpolation;
+  if (isComputed_) sampleTrajectory();
+}
+
+double BaseAuto::getSamplingTimeStep() const
+{
+  return samplingTimeStep_;
+}
+
+FrameId BaseAuto::getFrameHandle(const ControlLevel& controlLevel) const
 {
   return frameId_;
 }
@@ -408,12 +487,51 @@ bool BaseAuto::computeTrajectory()
   values.push_back(target_);
 
   trajectory_.fitCurve(times, values);
+  sampleTrajectory();
   return true;
 }
 
+void BaseAuto::sampleTrajectory()
+{
+  sampledPositions_.clear();
+  sampledOrientations_.clear();
+  sampledAngularVelocities_.clear();
+  if (samplingTimeStep_ <= 0.0) return;
+  sampledPositions_.sample(duration_, samplingTimeStep_, samplingInterpolation_,
+                           [this](const double time, Eigen::Vector3d& position, Eigen::Vector3d& velocity,
+                                  Eigen::Vector3d& acceleration) {
+    Pose pose;
+    trajectory_.evaluate(pose, time);
+    curves::CubicHermiteSE3Curve::DerivativeType derivative;
+    trajectory_.evaluateDerivative(derivative, time, 1);
+    position = pose.getPosition().vector();
+    velocity = derivative.getTranslationalVelocity().vector();
+    acceleration = trajectory_.evaluateLinearAcceleration(time);
+  });
+  sampledOrientations_.sample(duration_, samplingTimeStep_, SampleInterpolation::Linear,
+                              [this](const double time, Eigen::Vector4d& orientation, Eigen::Vector4d& unused,
+                                     Eigen::Vector4d& unusedDerivative) {
+    Pose pose;
+    trajectory_.evaluate(pose, time);
+    const Eigen::Quaterniond& quaternion = pose.getRotation().toImplementation();
+    orientation << quaternion.w(), quaternion.x(), quaternion.y(), quaternion.z();
+    unused.setZero();
+    unusedDerivative.setZero();
+  });
+  sampledAngularVelocities_.sample(duration_, samplingTimeStep_, SampleInterpolation::Linear,
+                                   [this](const double time, Eigen::Vector3d& angularVelocity, Eigen::Vector3d& unused,
+                                          Eigen::Vector3d& unusedDerivative) {
+    curves::CubicHermiteSE3Curve::DerivativeType derivative;
+    trajectory_.evaluateDerivative(derivative, time, 1);
+    angularVelocity = derivative.getRotationalVelocity().vector();
+    unused.setZero();
+    unusedDerivative.setZero();
+  });
+}
+
 std::ostream& operator<<(std::ostream& out, const BaseAuto& baseAuto)
 {
-  out << "Frame: " << baseAuto.frameId_ << std::endl;
+  out << "Frame: " << baseAuto.getFrameId(ControlLevel::Position) << std::endl;
   out << "Height: " << *(baseAuto.height_) << std::endl;
   out << "Ignore timing of leg motion: " << (baseAuto.ignoreTimingOfLegMotion_ ? "True" : "False") << std::endl;
   out << "Average Linear Velocity: " << baseAuto.averageLinearVelocity_ << std::endl;
@@ -32,7 +32,7 @@ BaseMotionBase::Type BaseMotionBase::getType() const
   return type_;
 }
 
-const ControlSetup BaseMotionBase::getControlSetup() const
+const ControlSetup& BaseMotionBase::getControlSetup() const
 {
   throw std::runtime_error("BaseMotionBase::getControlSetup() not implemented.");
 }
@@ -87,9 +87,24 @@ double BaseMotionBase::getDuration() const
   throw std::runtime_error("BaseMotionBase::getDuration() not implemented.");
 }
 
+void BaseMotionBase::setSampling(const double timeStep, const SampleInterpolation interpolation)
+{
+  throw std::runtime_error("BaseMotionBase::setSampling() not implemented.");
+}
+
+double BaseMotionBase::getSamplingTimeStep() const
+{
+  return 0.0;
+}
+
 const std::string& BaseMotionBase::getFrameId(const ControlLevel& controlLevel) const
 {
-  throw std::runtime_error("BaseMotionBase::getFrameId() not implemented.");
+  return FrameRegistry::getInstance().getName(getFrameHandle(controlLevel));
+}
+
+FrameId BaseMotionBase::getFrameHandle(const ControlLevel& controlLevel) const
+{
+  throw std::runtime_error("BaseMotionBase::getFrameHandle() not implemented.");
 }
 
 Pose BaseMotionBase::evaluatePose(const double time) const
@@ -117,6 +132,12 @@ Torque BaseMotionBase::evaluateTorque(const double time) const
   throw std::runtime_error("BaseMotionBase::evaluateTorque() not implemented.");
 }
 
+void BaseMotionBase::evaluate(const double time, Pose& pose, Twist& twist) const
+{
+  pose = evaluatePose(time);
+  twist = evaluateTwist(time);
+}
+
 std::ostream& operator<< (std::ostream& out, const BaseMotionBase& baseMotion)
 {
   out << "Type: " << baseMotion.getType() << std::endl;
@@ -15,6 +15,7 @@ namespace free_gait {
 
 BaseTarget::BaseTarget()
     : BaseMotionBase(BaseMotionBase::Type::Target),
+      frameId_(FrameRegistry::invalidFrameId),
       ignoreTimingOfLegMotion_(false),
       averageLinearVelocity_(0.0),
       averageAngularVelocity_(0.0),
@@ -36,7 +37,7 @@ std::unique_ptr<BaseMotionBase> BaseTarget::clone() const
   return pointer;
 }
 
-const ControlSetup BaseTarget::getControlSetup() const
+const ControlSetup& BaseTarget::getControlSetup() const
 {
   return controlSetup_;
 }
@@ -75,7 +76,7 @@ double BaseTarget::getDuration() const
   return duration_;
 }
 
-const std::string& BaseTarget::getFrameId(const ControlLevel& controlLevel) const
+FrameId BaseTarget::getFrameHandle(const ControlLevel& controlLevel) const
 {
   return frameId_;
 }
@@ -140,7 +141,7 @@ bool BaseTarget::computeTrajectory()
 
 std::ostream& operator<<(std::ostream& out, const BaseTarget& baseTarget)
 {
-  out << "Frame: " << baseTarget.frameId_ << std::endl;
+  out << "Frame: " << baseTarget.getFrameId(ControlLevel::Position) << std::endl;
   out << "Start Position: " << baseTarget.start_.getPosition() << std::endl;
   out << "Start Orientation: " << baseTarget.start_.getRotation() << std::endl;
   out << "Start Orientation (yaw, pitch, roll) [deg]: " << 180.0 / M_PI * EulerAnglesZyx(baseTarget.start_.getRotation()).getUnique().vector().transpose() << std::endl;
@@ -34,13 +34,14 @@ void BaseTrajectory::setTrajectory(
     const std::unordered_map<ControlLevel, std::vector<Time>, EnumClassHash>& times,
     const std::unordered_map<ControlLevel, std::vector<ValueType>, EnumClassHash>& values)
 {
-  frameIds_ = frameIds;
+  frameIds_ = ControlLevelFrameIds();
+  for (const auto& frameId : frameIds) frameIds_[frameId.first] = FrameRegistry::getInstance().internOrThrow(frameId.second);
   times_ = times;
   values_ = values;
   for (const auto& value : values) controlSetup_[value.first] = true;
 }
 
-const ControlSetup BaseTrajectory::getControlSetup() const
+const ControlSetup& BaseTrajectory::getControlSetup() const
 {
   return controlSetup_;
 }
@@ -98,9 +99,9 @@ double BaseTrajectory::getDuration() const
   return duration_;
 }
 
-const std::string& BaseTrajectory::getFrameId(const ControlLevel& controlLevel) const
+FrameId BaseTrajectory::getFrameHandle(const ControlLevel& controlLevel) const
 {
-  return frameIds_.at(controlLevel);
+  return frameIds_[controlLevel];
 }
 
 Pose BaseTrajectory::evaluatePose(const double time) const
@@ -122,7 +123,7 @@ Twist BaseTrajectory::evaluateTwist(const double time) const
 
 std::ostream& operator<<(std::ostream& out, const BaseTrajectory& baseTrajectory)
 {
-  out << "Frame [Position]: " << baseTrajectory.frameIds_.at(ControlLevel::Position) << std::endl;
+  out << "Frame [Position]: " << baseTrajectory.getFrameId(ControlLevel::Position) << std::endl;
   out << "Duration: " << baseTrajectory.duration_ << std::endl;
   out << "Times: ";
   for (const auto& time : baseTrajectory.times_.at(ControlLevel::Position)) out << time << ", ";
@@ -11,13 +11,28 @@
 namespace free_gait {
 
 AdapterBase::AdapterBase()
+    : frameTransformCache_(FrameRegistry::blockSize),
+      frameTransformCacheTick_(1),
+      worldFrameId_(FrameRegistry::invalidFrameId),
+      baseFrameId_(FrameRegistry::invalidFrameId)
 {
+  for (auto& cachedFrameTransform : frameTransformCache_) cachedFrameTransform.tick = 0;
 }
 
 AdapterBase::~AdapterBase()
 {
 }
 
+std::unique_ptr<AdapterBase> AdapterBase::clone() const
+{
+  return std::unique_ptr<AdapterBase>();
+}
+
+bool AdapterBase::updateClone(AdapterBase& clone) const
+{
+  return false;
+}
+
 bool AdapterBase::frameIdExists(const std::string& frameId) const
 {
   if (frameId == getBaseFrameId()) return true;
@@ -191,7 +206,7 @@ Vector AdapterBase::transformVector(const std::string& inputFrameId,
     } else if (outputFrameId == getWorldFrameId()) {
       transformedVector = vector;
     } else if (outputFrameId == "map") {
-      transformedVector = getFrameTransform(outputFrameId).getRotation().rotate(vector);
+      transformedVector = getFrameTransform(outputFrameId).getRotation().inverseRotate(vector);
     } else {
       frameError = true;
     }
@@ -218,4 +233,115 @@ Vector AdapterBase::transformVector(const std::string& inputFrameId,
   return transformedVector;
 }
 
+FrameRegistry& AdapterBase::getFrameRegistry() const
+{
+  return FrameRegistry::getInstance();
+}
+
+void AdapterBase::resetFrameTransformCache() const
+{
+  ++frameTransformCacheTick_;
+}
+
+bool AdapterBase::frameIdExists(const FrameId frameId) const
+{
+  if (!getFrameRegistry().isValid(frameId)) return false;
+  return getCachedFrameTransform(frameId).exists;
+}
+
+Position AdapterBase::transformPosition(const FrameId inputFrameId, const FrameId outputFrameId,
+                                        const Position& position) const
+{
+  const CachedFrameTransform& input = getValidCachedFrameTransform(inputFrameId);
+  if (outputFrameId == baseFrameId_) return input.transformToBase.transform(position);
+  const Position positionInWorldFrame = input.transformToWorld.transform(position);
+  if (outputFrameId == worldFrameId_) return positionInWorldFrame;
+  return getValidCachedFrameTransform(outputFrameId).transformToWorld.inverseTransform(positionInWorldFrame);
+}
+
+Pose AdapterBase::transformPose(const FrameId inputFrameId, const FrameId outputFrameId, const Pose& pose) const
+{
+  const CachedFrameTransform& input = getValidCachedFrameTransform(inputFrameId);
+  if (outputFrameId == baseFrameId_) return input.transformToBase * pose;
+  const Pose poseInWorldFrame = input.transformToWorld * pose;
+  if (outputFrameId == worldFrameId_) return poseInWorldFrame;
+  return getValidCachedFrameTransform(outputFrameId).transformToWorld.inverted() * poseInWorldFrame;
+}
+
+Vector AdapterBase::transformVector(const FrameId inputFrameId, const FrameId outputFrameId,
+                                    const Vector& vector) const
+{
+  const CachedFrameTransform& input = getValidCachedFrameTransform(inputFrameId);
+  if (outputFrameId == baseFrameId_) return input.transformToBase.getRotation().rotate(vector);
+  const Vector vectorInWorldFrame = input.transformToWorld.getRotation().rotate(vector);
+  if (outputFrameId == worldFrameId_) return vectorInWorldFrame;
+  return getValidCachedFrameTransform(outputFrameId).transformToWorld.getRotation().inverseRotate(vectorInWorldFrame);
+}
+
+LinearVelocity AdapterBase::transformLinearVelocity(const FrameId inputFrameId, const FrameId outputFrameId,
+                                                    const LinearVelocity& linearVelocity) const
+{
+  return LinearVelocity(transformVector(inputFrameId, outputFrameId, Vector(linearVelocity)));
+}
+
+LocalAngularVelocity AdapterBase::transformAngularVelocity(const FrameId inputFrameId, const FrameId outputFrameId,
+                                                           const LocalAngularVelocity& angularVelocity) const
+{
+  const Vector transformedVector = transformVector(inputFrameId, outputFrameId, Vector(angularVelocity.vector()));
+  return LocalAngularVelocity(transformedVector.toImplementation());
+}
+
+LinearAcceleration AdapterBase::transformLinearAcceleration(const FrameId inputFrameId, const FrameId outputFrameId,
+                                                            const LinearAcceleration& linearAcceleration) const
+{
+  return LinearAcceleration(transformVector(inputFrameId, outputFrameId, Vector(linearAcceleration)));
+}
+
+const AdapterBase::CachedFrameTransform& AdapterBase::getCachedFrameTransform(const FrameId frameId) const
+{
+  // The base pose changes with setInternalDataFromState().
+  const Position basePosition(getPositionWorldToBaseInWorldFrame());
+  const RotationQuaternion baseOrientation(getOrientationBaseToWorld());
+  if (basePosition != cachedBasePosition_ || baseOrientation.vector() != cachedBaseOrientation_.vector()) {
+    ++frameTransformCacheTick_;
+    cachedBasePosition_ = basePosition;
+    cachedBaseOrientation_ = baseOrientation;
+  }
+
+  if (frameId >= frameTransformCache_.size()) {
+    CachedFrameTransform outdatedFrameTransform;
+    outdatedFrameTransform.tick = 0;
+    frameTransformCache_.resize((frameId / FrameRegistry::blockSize + 1) * FrameRegistry::blockSize,
+                                outdatedFrameTransform);
+  }
+  CachedFrameTransform& cachedFrameTransform = frameTransformCache_[frameId];
+  if (cachedFrameTransform.tick == frameTransformCacheTick_) return cachedFrameTransform;
+
+  cachedFrameTransform.tick = frameTransformCacheTick_;
+  if (worldFrameId_ == FrameRegistry::invalidFrameId) worldFrameId_ = getFrameRegistry().intern(getWorldFrameId());
+  if (baseFrameId_ == FrameRegistry::invalidFrameId) baseFrameId_ = getFrameRegistry().intern(getBaseFrameId());
+  const std::string& frameName = getFrameRegistry().getName(frameId);
+  cachedFrameTransform.exists = frameIdExists(frameName);
+  if (!cachedFrameTransform.exists) return cachedFrameTransform;
+  const Pose transformBaseToWorld(basePosition, baseOrientation);
+  if (frameId == worldFrameId_) {
+    cachedFrameTransform.transformToWorld.setIdentity();
+  } else if (frameId == baseFrameId_) {
+    cachedFrameTransform.transformToWorld = transformBaseToWorld;
+  } else {
+    cachedFrameTransform.transformToWorld = transformPose(frameName, getWorldFrameId(), Pose());
+  }
+  cachedFrameTransform.transformToBase = transformBaseToWorld.inverted() * cachedFrameTransform.transformToWorld;
+  return cachedFrameTransform;
+}
+
+const AdapterBase::CachedFrameTransform& AdapterBase::getValidCachedFrameTransform(const FrameId frameId) const
+{
+  if (!frameIdExists(frameId)) {
+    const std::string message = "Invalid frame for transformation (frame: " + getFrameRegistry().getName(frameId) + ").";
+    throw std::invalid_argument(message);
+  }
+  return frameTransformCache_[frameId];
+}
+
 } /* namespace free_gait */
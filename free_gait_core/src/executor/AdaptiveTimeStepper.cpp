@@ -0,0 +1,111 @@
+/*
+ * AdaptiveTimeStepper.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#include "free_gait_core/executor/AdaptiveTimeStepper.hpp"
+
+// STD
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace free_gait {
+
+AdaptiveTimeStepper::AdaptiveTimeStepper(const Parameters& parameters)
+    : parameters_(parameters)
+{
+  if (parameters_.minTimeStep <= 0.0 || parameters_.maxTimeStep < parameters_.minTimeStep) {
+    throw std::invalid_argument("AdaptiveTimeStepper: Invalid time step bounds.");
+  }
+  if (parameters_.tolerance <= 0.0 || parameters_.maxGrowthFactor < 1.0) {
+    throw std::invalid_argument("AdaptiveTimeStepper: Invalid tolerance or growth factor.");
+  }
+  reset();
+}
+
+AdaptiveTimeStepper::~AdaptiveTimeStepper()
+{
+}
+
+const AdaptiveTimeStepper::Parameters& AdaptiveTimeStepper::getParameters() const
+{
+  return parameters_;
+}
+
+void AdaptiveTimeStepper::reset()
+{
+  timeStep_ = parameters_.minTimeStep;
+  nSamples_ = 0;
+  previousTimeStep_ = 0.0;
+  supportLegs_.reset();
+  stepId_.clear();
+}
+
+double AdaptiveTimeStepper::getTimeStep(const StepQueue& queue) const
+{
+  // Refine until the step is started.
+  if (!queue.active() || !queue.getCurrentStep().isUpdated()) return parameters_.minTimeStep;
+
+  // Next event of the current step.
+  const Step& step = queue.getCurrentStep();
+  const double time = step.getTime();
+  double eventTime = step.getTotalDuration();
+  auto addEvent = [&](const double duration) {
+    if (duration > time && duration < eventTime) eventTime = duration;
+  };
+  for (size_t i = 0; i < nLimbs; ++i) {
+    const LimbEnum limb = static_cast<LimbEnum>(i);
+    if (step.hasLegMotion(limb)) addEvent(step.getLegMotionDuration(limb));
+  }
+  if (step.hasBaseMotion()) addEvent(step.getBaseMotionDuration());
+
+  // At the end of the step, the next advance switches the step.
+  if (eventTime <= time) return parameters_.minTimeStep;
+
+  // Sample the event exactly, without leaving an interval shorter than the
+  // minimum time step before it.
+  double timeToEvent = eventTime - time;
+  if (timeToEvent >= timeStep_ + parameters_.minTimeStep) return timeStep_;
+  while (timeToEvent > 0.0 && time + timeToEvent > eventTime) {
+    timeToEvent = std::nextafter(timeToEvent, 0.0);
+  }
+  return timeToEvent > 0.0 ? timeToEvent : parameters_.minTimeStep;
+}
+
+void AdaptiveTimeStepper::update(const double timeStep, const State& state)
+{
+  const auto& jointPositions = state.getJointPositions().vector();
+  Eigen::VectorXd values(3 + jointPositions.size());
+  values << state.getPositionWorldToBaseInWorldFrame().vector(), jointPositions;
+  std::bitset<nLimbs> supportLegs;
+  for (size_t i = 0; i < nLimbs; ++i) supportLegs[i] = state.isSupportLeg(static_cast<LimbEnum>(i));
+
+  // Restart after events, the motion is not smooth across them.
+  if (nSamples_ > 0 && (supportLegs != supportLegs_ || state.getStepId() != stepId_)) {
+    nSamples_ = 0;
+    timeStep_ = parameters_.minTimeStep;
+  }
+  supportLegs_ = supportLegs;
+  stepId_ = state.getStepId();
+
+  if (nSamples_ >= 2) {
+    const double h = timeStep;
+    const double previousH = previousTimeStep_;
+    const double curvature = (2.0 * ((values - values_) / h - (values_ - previousValues_) / previousH) / (h + previousH))
+        .cwiseAbs().maxCoeff();
+    double curvatureTimeStep = parameters_.maxTimeStep;
+    if (curvature > 0.0) curvatureTimeStep = std::sqrt(8.0 * parameters_.tolerance / curvature);
+    timeStep_ = std::min(curvatureTimeStep, parameters_.maxGrowthFactor * std::max(timeStep_, h));
+    timeStep_ = std::min(std::max(timeStep_, parameters_.minTimeStep), parameters_.maxTimeStep);
+  }
+
+  previousValues_.swap(values_);
+  values_.swap(values);
+  previousTimeStep_ = timeStep;
+  if (nSamples_ < 2) ++nSamples_;
+}
+
+} /* namespace free_gait */
@@ -9,22 +9,48 @@
 #include "free_gait_core/executor/BatchExecutor.hpp"
 #include "free_gait_core/executor/State.hpp"
 
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <utility>
+
 namespace free_gait {
 
 BatchExecutor::BatchExecutor(free_gait::Executor& executor)
     : executor_(executor),
+      nThreads_(1),
+      computeDerivedData_(false),
+      isStreaming_(false),
+      chunkDuration_(0.0),
+      stream_(new StateBatchStream()),
+      nPublishedStates_(0),
+      chunkSearchIndex_(0),
       timeStep_(0.001),
+      isAdaptiveTimeStep_(false),
+      isShuttingDown_(false),
+      isRunningJob_(false),
       isProcessing_(false),
       requestForCancelling_(false)
 {
+  worker_ = std::thread(&BatchExecutor::runWorker, this);
 }
 
 BatchExecutor::~BatchExecutor()
 {
+  {
+    std::lock_guard<std::mutex> lock(jobMutex_);
+    isShuttingDown_ = true;
+    requestForCancelling_ = true;
+    if (waitingJob_) waitingJob_->result.set_value(false);
+    waitingJob_.reset();
+  }
+  jobCondition_.notify_all();
+  worker_.join();
 }
 
 void BatchExecutor::addProcessingCallback(std::function<void(bool)> callback)
 {
+  std::lock_guard<std::mutex> lock(jobMutex_);
   callback_ = callback;
 }
 
@@ -39,15 +65,78 @@ double BatchExecutor::getTimeStep() const
   return timeStep_;
 }
 
+void BatchExecutor::setAdaptiveTimeStep(const bool isAdaptive, const AdaptiveTimeStepper::Parameters& parameters)
+{
+  if (isProcessing_) throw std::runtime_error("Batch executor error: Cannot change time step during processing.");
+  AdaptiveTimeStepper timeStepper(parameters); // Checks the parameters.
+  isAdaptiveTimeStep_ = isAdaptive;
+  adaptiveTimeStepParameters_ = parameters;
+}
+
+bool BatchExecutor::isAdaptiveTimeStep() const
+{
+  return isAdaptiveTimeStep_;
+}
+
+void BatchExecutor::setAdapterFactory(AdapterFactory adapterFactory)
+{
+  if (isProcessing_) throw std::runtime_error("Batch executor error: Cannot change adapter factory during processing.");
+  adapterFactory_ = adapterFactory;
+  derivedDataAdapter_.reset();
+  segmentAdapters_.clear();
+}
+
+void BatchExecutor::setNumberOfThreads(const size_t nThreads)
+{
+  if (isProcessing_) throw std::runtime_error("Batch executor error: Cannot change number of threads during processing.");
+  nThreads_ = std::max(size_t(1), nThreads);
+}
+
+size_t BatchExecutor::getNumberOfThreads() const
+{
+  return nThreads_;
+}
+
+void BatchExecutor::setComputeDerivedData(const bool computeDerivedData)
+{
+  if (isProcessing_) throw std::runtime_error("Batch executor error: Cannot change derived data computation during processing.");
+  computeDerivedData_ = computeDerivedData;
+}
+
+void BatchExecutor::setStreaming(const bool isStreaming, const double chunkDuration)
+{
+  if (isProcessing_) throw std::runtime_error("Batch executor error: Cannot change streaming during processing.");
+  if (chunkDuration < 0.0) throw std::invalid_argument("Batch executor error: Chunk duration must not be negative.");
+  isStreaming_ = isStreaming;
+  chunkDuration_ = chunkDuration;
+}
+
+void BatchExecutor::addChunkCallback(std::function<void(const StateBatchStream::Chunk&)> callback)
+{
+  std::lock_guard<std::mutex> lock(jobMutex_);
+  chunkCallback_ = callback;
+}
+
+std::shared_ptr<const StateBatchStream> BatchExecutor::getStream() const
+{
+  std::lock_guard<std::mutex> lock(streamMutex_);
+  return stream_;
+}
+
+std::future<bool> BatchExecutor::submit(const std::vector<free_gait::Step>& steps)
+{
+  std::unique_ptr<Job> job(new Job());
+  job->steps = steps;
+  std::future<bool> result = job->result.get_future();
+  addJob(std::move(job));
+  return result;
+}
+
 bool BatchExecutor::process(const std::vector<free_gait::Step>& steps)
 {
-  if (isProcessing_) return false;
-  isProcessing_ = true;
-  executor_.reset();
-  executor_.getQueue().add(steps);
-  std::thread thread(std::bind(&BatchExecutor::processInThread, this));
-  thread.detach();
-  return true;
+  std::unique_ptr<Job> job(new Job());
+  job->steps = steps;
+  return addJob(std::move(job));
 }
 
 bool BatchExecutor::isProcessing()
@@ -57,27 +146,319 @@ bool BatchExecutor::isProcessing()
 
 void BatchExecutor::cancelProcessing()
 {
-  requestForCancelling_ = true;
+  std::lock_guard<std::mutex> lock(jobMutex_);
+  if (waitingJob_) waitingJob_->result.set_value(false);
+  waitingJob_.reset();
+  if (isRunningJob_) requestForCancelling_ = true;
+  isProcessing_ = isRunningJob_.load();
 }
 
 const StateBatch& BatchExecutor::getStateBatch() const
 {
-  if (isProcessing_) throw std::runtime_error("Batch executor error: Cannot access state during processing.");
+  // The worker starts a request only under the job mutex.
+  std::lock_guard<std::mutex> lock(jobMutex_);
+  if (isRunningJob_) throw std::runtime_error("Batch executor error: Cannot access state during processing.");
   return stateBatch_;
 }
 
-void BatchExecutor::processInThread()
+StateBatch BatchExecutor::takeStateBatch()
 {
+  std::lock_guard<std::mutex> lock(jobMutex_);
+  if (isRunningJob_) throw std::runtime_error("Batch executor error: Cannot access state during processing.");
+  StateBatch stateBatch(std::move(stateBatch_));
   stateBatch_.clear();
+  return stateBatch;
+}
+
+bool BatchExecutor::addJob(std::unique_ptr<Job> job)
+{
+  {
+    std::lock_guard<std::mutex> lock(jobMutex_);
+    if (isShuttingDown_) {
+      job->result.set_value(false);
+      return false;
+    }
+    // The latest request wins.
+    if (waitingJob_) waitingJob_->result.set_value(false);
+    if (isRunningJob_) requestForCancelling_ = true;
+    waitingJob_ = std::move(job);
+    isProcessing_ = true;
+  }
+  jobCondition_.notify_one();
+  return true;
+}
+
+void BatchExecutor::runWorker()
+{
+  while (true) {
+    std::unique_ptr<Job> job;
+    std::function<void(bool)> callback;
+    {
+      std::unique_lock<std::mutex> lock(jobMutex_);
+      jobCondition_.wait(lock, [this]() {return isShuttingDown_ || waitingJob_;});
+      if (isShuttingDown_) return;
+      job = std::move(waitingJob_);
+      callback = callback_;
+      processingChunkCallback_ = chunkCallback_;
+      requestForCancelling_ = false;
+      isRunningJob_ = true;
+    }
+
+    const bool success = processJob(job->steps);
+    {
+      std::lock_guard<std::mutex> lock(jobMutex_);
+      isRunningJob_ = false;
+      isProcessing_ = static_cast<bool>(waitingJob_);
+    }
+    if (callback) callback(success);
+    job->result.set_value(success);
+  }
+}
+
+bool BatchExecutor::processJob(const std::vector<Step>& steps)
+{
+  executor_.reset();
+  executor_.getQueue().add(steps);
+  steps_ = steps;
+  {
+    std::lock_guard<std::mutex> lock(streamMutex_);
+    stream_.reset(new StateBatchStream());
+  }
+  stateBatch_.clear();
+  nPublishedStates_ = 0;
+  chunkSearchIndex_ = 0;
+  stateBatchComputer_.reset();
+  if (computeDerivedData_) {
+    // Separate adapter, the executor's adapter is used by the simulation.
+    if (!derivedDataAdapter_) derivedDataAdapter_ = createAdapter();
+    if (derivedDataAdapter_) stateBatchComputer_.reset(new StateBatchComputer(*derivedDataAdapter_));
+  }
+
+  if (nThreads_ > 1 && createSegmentAdapters()) {
+    processInParallel();
+  } else {
+    processSerially();
+  }
+
+  if (computeDerivedData_ && !stateBatchComputer_ && !requestForCancelling_) {
+    StateBatchComputer stateBatchComputer(executor_.getAdapter());
+    stateBatchComputer.update(stateBatch_);
+  }
+  publishStates(true);
+  const bool success = !requestForCancelling_;
+  stream_->close(success);
+  return success;
+}
+
+void BatchExecutor::processSerially()
+{
+  AdaptiveTimeStepper timeStepper(adaptiveTimeStepParameters_);
   double time = 0.0;
   while (!executor_.getQueue().empty() && !requestForCancelling_) {
-    executor_.advance(timeStep_);
-    time += timeStep_;
+    const double timeStep = isAdaptiveTimeStep_ ? timeStepper.getTimeStep(executor_.getQueue()) : timeStep_;
+    executor_.advance(timeStep);
+    time += timeStep;
     stateBatch_.addState(time, executor_.getState());
+    if (isAdaptiveTimeStep_) timeStepper.update(timeStep, executor_.getState());
+    processAddedStates();
+  }
+}
+
+void BatchExecutor::processInParallel()
+{
+  std::vector<std::unique_ptr<Segment>> segments;
+  if (!computeSegments(segments)) return;
+
+  // Simulate segments on worker threads and stitch them in order as soon
+  // as all previous segments are simulated.
+  std::atomic<size_t> nextSegment(0);
+  std::mutex stitchMutex;
+  std::vector<bool> isSimulated(segments.size(), false);
+  size_t nStitchedSegments = 0;
+  double timeOffset = 0.0;
+  auto worker = [&](AdapterBase& adapter) {
+    size_t i;
+    while ((i = nextSegment++) < segments.size() && !requestForCancelling_) {
+      processSegment(*segments[i], adapter, i + 1 == segments.size());
+      std::lock_guard<std::mutex> lock(stitchMutex);
+      isSimulated[i] = true;
+      while (nStitchedSegments < segments.size() && isSimulated[nStitchedSegments] && !requestForCancelling_) {
+        const Segment& segment = *segments[nStitchedSegments++];
+        stateBatch_.append(segment.stateBatch, timeOffset);
+        timeOffset += segment.duration;
+        processAddedStates();
+      }
+    }
+  };
+  std::vector<std::thread> threads;
+  const size_t nThreads = std::min(nThreads_, segments.size());
+  for (size_t i = 1; i < nThreads; ++i) threads.emplace_back(worker, std::ref(*segmentAdapters_[i]));
+  worker(*segmentAdapters_[0]);
+  for (auto& thread : threads) thread.join();
+}
+
+bool BatchExecutor::createSegmentAdapters()
+{
+  while (segmentAdapters_.size() < nThreads_) {
+    std::unique_ptr<AdapterBase> adapter = createAdapter();
+    if (!adapter) {
+      segmentAdapters_.clear();
+      return false;
+    }
+    segmentAdapters_.push_back(std::move(adapter));
+  }
+  return true;
+}
+
+void BatchExecutor::processAddedStates()
+{
+  if (stateBatchComputer_) stateBatchComputer_->update(stateBatch_);
+  publishStates(false);
+}
+
+void BatchExecutor::publishStates(const bool isFinal)
+{
+  if (!isStreaming_) return;
+  while (nPublishedStates_ < stateBatch_.size()) {
+    size_t end = findChunkEnd();
+    if (end == nPublishedStates_) {
+      if (!isFinal) return;
+      end = stateBatch_.size();
+    }
+    std::shared_ptr<StateBatch> chunk(new StateBatch());
+    chunk->append(stateBatch_, nPublishedStates_, end);
+    nPublishedStates_ = end;
+    stream_->push(chunk);
+    if (processingChunkCallback_) processingChunkCallback_(chunk);
+  }
+}
+
+size_t BatchExecutor::findChunkEnd()
+{
+  // Returns the index after the next complete chunk, or the index of its
+  // first state if the chunk is not complete yet.
+  const std::vector<double>& times = stateBatch_.getTimes();
+  if (chunkDuration_ > 0.0) {
+    const double endTime = times[nPublishedStates_] + chunkDuration_;
+    if (times.back() < endTime) return nPublishedStates_;
+    return stateBatch_.getIndex(endTime);
+  }
+
+  // One chunk per step, search only the states added since the last search.
+  const std::string& stepId = stateBatch_.getStepIdAtIndex(nPublishedStates_);
+  for (size_t k = std::max(nPublishedStates_ + 1, chunkSearchIndex_); k < times.size(); ++k) {
+    if (stateBatch_.getStepIdAtIndex(k) != stepId) return k;
+  }
+  chunkSearchIndex_ = times.size();
+  return nPublishedStates_;
+}
+
+bool BatchExecutor::computeSegments(std::vector<std::unique_ptr<Segment>>& segments)
+{
+  // Skeleton pass: Switch to each step as the serial processing does, such
+  // that the step is completed from the same state, and jump to the last
+  // time step of the step to find the stance boundaries and their states.
+  const size_t nSteps = steps_.size();
+  StepQueue& queue = executor_.getQueue();
+  completedSteps_.clear();
+  completedSteps_.reserve(nSteps);
+
+  segments.emplace_back(new Segment());
+  segments.back()->firstStep = 0;
+  segments.back()->startState = executor_.getState();
+
+  while (!queue.empty() && !requestForCancelling_) {
+    executor_.advance(timeStep_);
+    // Wait for steps that are computed asynchronously.
+    while (!queue.empty() && !queue.getCurrentStep().isUpdated() && !requestForCancelling_) {
+      executor_.advance(timeStep_);
+    }
+    if (queue.empty() || requestForCancelling_) break;
+    completedSteps_.push_back(queue.getCurrentStep());
+
+    // The step time is accumulated as in the serial processing. The adaptive
+    // time stepping samples the end of the step exactly.
+    const Step& step = queue.getCurrentStep();
+    double lastTime = step.getTime();
+    if (isAdaptiveTimeStep_) {
+      lastTime = step.getTotalDuration();
+    } else {
+      while (lastTime + timeStep_ <= step.getTotalDuration()) lastTime += timeStep_;
+    }
+    if (lastTime > step.getTime()) executor_.advance(lastTime - step.getTime());
+
+    const size_t nextStep = completedSteps_.size();
+    if (nextStep < nSteps && isStanceBoundary(executor_.getState())) {
+      segments.back()->nSteps = nextStep - segments.back()->firstStep;
+      segments.emplace_back(new Segment());
+      segments.back()->firstStep = nextStep;
+      segments.back()->startState = executor_.getState();
+      segments.back()->previousStep.reset(new Step(queue.getCurrentStep()));
+    }
   }
-  requestForCancelling_ = false;
-  isProcessing_ = false;
-  callback_(true);
+  segments.back()->nSteps = nSteps - segments.back()->firstStep;
+  return !requestForCancelling_ && completedSteps_.size() == nSteps;
+}
+
+void BatchExecutor::processSegment(Segment& segment, AdapterBase& adapter, const bool isLastSegment) const
+{
+  adapter.setInternalDataFromState(segment.startState);
+  State state;
+  StepCompleter completer(executor_.getCompleter().getParameters(), adapter);
+  StepComputer computer;
+  Executor executor(completer, computer, adapter, state);
+  executor.initialize();
+  executor.reset();
+  state = segment.startState;
+  adapter.setInternalDataFromState(state);
+
+  StepQueue& queue = executor.getQueue();
+  if (segment.previousStep) queue.setPreviousStep(*segment.previousStep);
+
+  // The steps are added one by one, such that the executor does not complete
+  // them again. Each step is resumed at its first time step.
+  AdaptiveTimeStepper timeStepper(adaptiveTimeStepParameters_);
+  size_t nextStep = segment.firstStep;
+  const size_t endStep = segment.firstStep + segment.nSteps;
+  double time = 0.0;
+  segment.stateBatch.clear();
+  while (!requestForCancelling_) {
+    double timeStep = timeStep_;
+    if (queue.empty()) {
+      if (nextStep == endStep) break;
+      queue.add(completedSteps_[nextStep++]);
+      Step& step = queue.getCurrentStep();
+      if (step.needsComputation() && !step.isComputed() && !step.compute()) {
+        std::cerr << "BatchExecutor::processSegment: Could not compute step." << std::endl;
+        break;
+      }
+      queue.advance(0.0);
+      executor.advance(0.0, true);
+    } else {
+      if (isAdaptiveTimeStep_) timeStep = timeStepper.getTimeStep(queue);
+      executor.advance(timeStep);
+      // The time step that ends a step is the first time step of the next step.
+      if (queue.empty() && (nextStep < endStep || !isLastSegment)) continue;
+    }
+    time += timeStep;
+    segment.stateBatch.addState(time, state);
+    if (isAdaptiveTimeStep_) timeStepper.update(timeStep, state);
+  }
+  segment.duration = time;
+}
+
+bool BatchExecutor::isStanceBoundary(const State& state) const
+{
+  for (const auto& limb : executor_.getAdapter().getLimbs()) {
+    if (!state.isSupportLeg(limb)) return false;
+  }
+  return true;
+}
+
+std::unique_ptr<AdapterBase> BatchExecutor::createAdapter() const
+{
+  if (adapterFactory_) return adapterFactory_();
+  return executor_.getAdapter().clone();
 }
 
 } /* namespace */
@@ -0,0 +1,229 @@
+/*
+ * CandidateEvaluator.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#include "free_gait_core/executor/CandidateEvaluator.hpp"
+#include "free_gait_core/executor/Executor.hpp"
+#include "free_gait_core/step/StepComputer.hpp"
+
+// STD
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+
+namespace free_gait {
+
+namespace {
+
+double cross(const Eigen::Vector2d& origin, const Eigen::Vector2d& a, const Eigen::Vector2d& b)
+{
+  return (a.x() - origin.x()) * (b.y() - origin.y()) - (a.y() - origin.y()) * (b.x() - origin.x());
+}
+
+double getDistanceToSegment(const Eigen::Vector2d& point, const Eigen::Vector2d& start, const Eigen::Vector2d& end)
+{
+  const Eigen::Vector2d segment = end - start;
+  const double squaredLength = segment.squaredNorm();
+  if (squaredLength == 0.0) return (point - start).norm();
+  const double phase = std::min(std::max((point - start).dot(segment) / squaredLength, 0.0), 1.0);
+  return (point - (start + phase * segment)).norm();
+}
+
+}
+
+CandidateEvaluator::Summary::Summary()
+    : isValid(false),
+      duration(0.0),
+      stabilityMargin(std::numeric_limits<double>::infinity()),
+      jointLimitMargin(std::numeric_limits<double>::infinity())
+{
+}
+
+CandidateEvaluator::CandidateEvaluator(const AdapterBase& adapter, const StepParameters& parameters)
+    : adapter_(adapter),
+      parameters_(parameters),
+      nThreads_(std::max(1u, std::thread::hardware_concurrency())),
+      timeStep_(0.001),
+      hasJointLimits_(false)
+{
+}
+
+CandidateEvaluator::~CandidateEvaluator()
+{
+}
+
+void CandidateEvaluator::setTimeStep(const double timeStep)
+{
+  if (timeStep <= 0.0) throw std::invalid_argument("CandidateEvaluator: Time step must be positive.");
+  timeStep_ = timeStep;
+}
+
+double CandidateEvaluator::getTimeStep() const
+{
+  return timeStep_;
+}
+
+void CandidateEvaluator::setAdapterFactory(AdapterFactory adapterFactory)
+{
+  adapterFactory_ = adapterFactory;
+}
+
+void CandidateEvaluator::setNumberOfThreads(const size_t nThreads)
+{
+  nThreads_ = std::max(size_t(1), nThreads);
+}
+
+size_t CandidateEvaluator::getNumberOfThreads() const
+{
+  return nThreads_;
+}
+
+void CandidateEvaluator::setJointLimits(const JointPositions& minJointPositions,
+                                        const JointPositions& maxJointPositions)
+{
+  minJointPositions_ = minJointPositions;
+  maxJointPositions_ = maxJointPositions;
+  hasJointLimits_ = true;
+}
+
+bool CandidateEvaluator::evaluate(const std::vector<std::vector<Step>>& candidates, const State& startState,
+                                  std::vector<Summary>& summaries, std::vector<StateBatch>* stateBatches) const
+{
+  summaries.assign(candidates.size(), Summary());
+  if (stateBatches) stateBatches->assign(candidates.size(), StateBatch());
+
+  // Per thread, an adapter for the simulation and a separate adapter for the
+  // evaluation of the states, as the simulation changes the state of its adapter.
+  const size_t nThreads = std::min(nThreads_, candidates.size());
+  std::vector<std::unique_ptr<AdapterBase>> simulationAdapters, evaluationAdapters;
+  for (size_t i = 0; i < nThreads; ++i) {
+    simulationAdapters.push_back(createAdapter());
+    evaluationAdapters.push_back(createAdapter());
+    if (!simulationAdapters.back() || !evaluationAdapters.back()) {
+      std::cerr << "CandidateEvaluator: Could not create adapter, set an adapter factory "
+                << "if the adapter does not support cloning." << std::endl;
+      return false;
+    }
+  }
+
+  // Candidates are distributed dynamically, as their durations differ.
+  std::atomic<size_t> nextCandidate(0);
+  auto worker = [&](AdapterBase& simulationAdapter, AdapterBase& evaluationAdapter) {
+    size_t i;
+    while ((i = nextCandidate++) < candidates.size()) {
+      evaluateCandidate(candidates[i], startState, simulationAdapter, evaluationAdapter, summaries[i],
+                        stateBatches ? &(*stateBatches)[i] : nullptr);
+    }
+  };
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < nThreads; ++i) {
+    threads.emplace_back(worker, std::ref(*simulationAdapters[i]), std::ref(*evaluationAdapters[i]));
+  }
+  if (nThreads > 0) worker(*simulationAdapters[0], *evaluationAdapters[0]);
+  for (auto& thread : threads) thread.join();
+
+  for (const auto& summary : summaries) {
+    if (!summary.isValid) return false;
+  }
+  return true;
+}
+
+double CandidateEvaluator::computeSupportMargin(const std::vector<Position>& footholds, const Position& point)
+{
+  if (footholds.empty()) return -std::numeric_limits<double>::infinity();
+  std::vector<Eigen::Vector2d> points;
+  points.reserve(footholds.size());
+  for (const auto& foothold : footholds) points.push_back(foothold.vector().head<2>());
+  const Eigen::Vector2d point2d = point.vector().head<2>();
+
+  // Convex hull (monotone chain), counterclockwise.
+  std::sort(points.begin(), points.end(), [](const Eigen::Vector2d& a, const Eigen::Vector2d& b) {
+    return a.x() < b.x() || (a.x() == b.x() && a.y() < b.y());
+  });
+  std::vector<Eigen::Vector2d> hull(2 * points.size());
+  size_t k = 0;
+  for (size_t i = 0; i < points.size(); ++i) {
+    while (k >= 2 && cross(hull[k - 2], hull[k - 1], points[i]) <= 0.0) --k;
+    hull[k++] = points[i];
+  }
+  for (size_t i = points.size() - 1, lowerSize = k + 1; i > 0; --i) {
+    while (k >= lowerSize && cross(hull[k - 2], hull[k - 1], points[i - 1]) <= 0.0) --k;
+    hull[k++] = points[i - 1];
+  }
+  hull.resize(std::max(size_t(1), k - 1));
+
+  // Points and lines do not support the center of mass.
+  if (hull.size() < 3) {
+    return -getDistanceToSegment(point2d, hull.front(), hull.back());
+  }
+
+  bool isInside = true;
+  double distance = std::numeric_limits<double>::max();
+  for (size_t i = 0; i < hull.size(); ++i) {
+    const Eigen::Vector2d& start = hull[i];
+    const Eigen::Vector2d& end = hull[(i + 1) % hull.size()];
+    if (cross(start, end, point2d) < 0.0) isInside = false;
+    distance = std::min(distance, getDistanceToSegment(point2d, start, end));
+  }
+  return isInside ? distance : -distance;
+}
+
+void CandidateEvaluator::evaluateCandidate(const std::vector<Step>& steps, const State& startState,
+                                           AdapterBase& simulationAdapter, AdapterBase& evaluationAdapter,
+                                           Summary& summary, StateBatch* stateBatch) const
+{
+  simulationAdapter.setInternalDataFromState(startState);
+  State state;
+  StepCompleter completer(parameters_, simulationAdapter);
+  StepComputer computer;
+  Executor executor(completer, computer, simulationAdapter, state);
+  executor.initialize();
+  executor.reset();
+  state = startState;
+  simulationAdapter.setInternalDataFromState(state);
+  executor.getQueue().add(steps);
+
+  std::vector<Position> footholds;
+  footholds.reserve(simulationAdapter.getLimbs().size());
+  double time = 0.0;
+  try {
+    while (!executor.getQueue().empty()) {
+      if (!executor.advance(timeStep_)) return;
+      time += timeStep_;
+      if (stateBatch) stateBatch->addState(time, state);
+
+      evaluationAdapter.setInternalDataFromState(state, false, true, false, false);
+      footholds.clear();
+      for (const auto& limb : evaluationAdapter.getLimbs()) {
+        if (state.isSupportLeg(limb)) footholds.push_back(evaluationAdapter.getPositionWorldToFootInWorldFrame(limb));
+      }
+      summary.stabilityMargin = std::min(summary.stabilityMargin,
+          computeSupportMargin(footholds, evaluationAdapter.getCenterOfMassInWorldFrame()));
+      if (hasJointLimits_) {
+        const auto& jointPositions = state.getJointPositions().vector();
+        summary.jointLimitMargin = std::min(summary.jointLimitMargin, std::min(
+            (jointPositions - minJointPositions_.vector()).minCoeff(),
+            (maxJointPositions_.vector() - jointPositions).minCoeff()));
+      }
+      summary.duration = time;
+    }
+  } catch (const std::exception& exception) {
+    std::cerr << "CandidateEvaluator: Could not simulate candidate: " << exception.what() << std::endl;
+    return;
+  }
+  summary.isValid = true;
+}
+
+std::unique_ptr<AdapterBase> CandidateEvaluator::createAdapter() const
+{
+  if (adapterFactory_) return adapterFactory_();
+  return adapter_.clone();
+}
+
+} /* namespace free_gait */
@@ -7,9 +7,13 @@
  */
 
 #include "free_gait_core/executor/Executor.hpp"
+#include "free_gait_core/executor/SpeculativeStepCompleter.hpp"
+#include "free_gait_core/executor/ExecutorCommandQueue.hpp"
 
 namespace free_gait {
 
+constexpr size_t Executor::maxSnapshotReaders_;
+
 Executor::Executor(StepCompleter& completer,
                    StepComputer& computer,
                    AdapterBase& adapter,
@@ -23,8 +27,14 @@ Executor::Executor(StepCompleter& completer,
       isPausing_(false),
       preemptionType_(PreemptionType::PREEMPT_STEP),
       queue_(),
-      firstFeedbackDescription_(true)
+      isComputingStep_(false),
+      areLegMotionsResolved_(false),
+      worldFrameId_(FrameRegistry::invalidFrameId),
+      baseFrameId_(FrameRegistry::invalidFrameId),
+      precomputationTolerance_(1e-3),
+      commandQueue_(new ExecutorCommandQueue())
 {
+  for (auto& channel : snapshotChannelPointers_) channel = nullptr;
 }
 
 Executor::~Executor()
@@ -35,6 +45,8 @@ bool Executor::initialize()
 {
   computer_.initialize();
   state_.initialize(adapter_.getLimbs(), adapter_.getBranches());
+  worldFrameId_ = adapter_.getFrameRegistry().intern(adapter_.getWorldFrameId());
+  baseFrameId_ = adapter_.getFrameRegistry().intern(adapter_.getBaseFrameId());
   isReset_ = false;
   return isInitialized_ = true;
 }
@@ -52,71 +64,94 @@ Executor::Mutex& Executor::getMutex()
 bool Executor::advance(double dt, bool skipStateMeasurmentUpdate)
 {
   if (!isInitialized_) return false;
-  if (!isReset_) {
-    reset();
-    isReset_ = true;
+  if (!isReset_) reset();
+  profiler_.startAdvance();
+  processCommands();
+  profiler_.endPhase(ExecutorProfiler::Phase::ProcessCommands);
+  const bool success = advanceQueue(dt, skipStateMeasurmentUpdate);
+  publishSnapshot();
+  profiler_.endPhase(ExecutorProfiler::Phase::PublishSnapshot);
+  profiler_.endAdvance(queue_.active() ? ExecutorProfiler::getStepType(queue_.getCurrentStep())
+                                       : ExecutorProfiler::StepType::None, success);
+  return success;
+}
+
+bool Executor::advanceQueue(double dt, bool skipStateMeasurmentUpdate)
+{
+  typedef ExecutorProfiler::Phase Phase;
+  if (!skipStateMeasurmentUpdate) {
+    updateStateWithMeasurements();
+    profiler_.endPhase(Phase::UpdateStateWithMeasurements);
   }
-  if (!skipStateMeasurmentUpdate) updateStateWithMeasurements();
   bool executionStatus = adapter_.isExecutionOk() && !isPausing_;
 
   if (executionStatus) {
-    if (!state_.getRobotExecutionStatus()) addToFeedback("Continuing with execution.");
+    if (!state_.getRobotExecutionStatus()) feedback_.push(ExecutorFeedbackEvent::Type::Resumed);
     state_.setRobotExecutionStatus(true);
   } else {
     if (state_.getRobotExecutionStatus()) {
-      if (!adapter_.isExecutionOk()) addToFeedback("Robot status is not OK, paused execution.");
-      if (isPausing_) addToFeedback("Paused execution.");
+      if (!adapter_.isExecutionOk()) feedback_.push(ExecutorFeedbackEvent::Type::RobotNotOk);
+      if (isPausing_) feedback_.push(ExecutorFeedbackEvent::Type::Paused);
     }
     state_.setRobotExecutionStatus(false);
     return true;
   }
 
   // Copying result from computer when done.
-  if (!queue_.empty() && queue_.getCurrentStep().needsComputation() && computer_.isDone()) {
-     computer_.getStep(queue_.getCurrentStep());
-     computer_.resetIsDone();
+  if (!queue_.empty() && queue_.getCurrentStep().getId() == computationStepId_) {
+    if (!updateComputation(queue_.getCurrentStep())) return false;
+    profiler_.endPhase(Phase::UpdateComputation);
   }
 
   // Advance queue.
   if (!queue_.advance(dt)) return false;
+  profiler_.endPhase(Phase::AdvanceQueue);
   if (!adapter_.updateExtrasBefore(queue_, state_)) return false;
+  profiler_.endPhase(Phase::UpdateExtrasBefore);
 
   // For a new switch in step, do some work on step for the transition.
   while (queue_.hasSwitchedStep()) {
     auto& currentStep = queue_.getCurrentStep();
-    if (!completer_.complete(state_, queue_, currentStep)) {
+    if (!completeStep(currentStep)) {
       std::cerr << "Executor::advance: Could not complete step." << std::endl;
+      feedback_.pushError(ExecutorFeedbackEvent::ErrorCode::CompletionFailed, currentStep.getId());
       return false;
     }
-    if (currentStep.needsComputation() && !computer_.isBusy()) {
-      computer_.setStep(currentStep);
-      addToFeedback("Starting computation of step.");
-      if (!computer_.compute()) {
-        std::cerr << "Executor::advance: Could not compute step." << std::endl;
-        return false;
-      }
-      if (computer_.isDone()) {
-        computer_.getStep(queue_.getCurrentStep());
-        computer_.resetIsDone();
-      }
-    }
+    profiler_.endPhase(Phase::CompleteStep);
+    computationStepId_ = currentStep.getId();
+    isComputingStep_ = false;
+    areLegMotionsResolved_ = false;
+    if (!updateComputation(currentStep)) return false;
+    profiler_.endPhase(Phase::UpdateComputation);
     if (!queue_.advance(dt)) return false; // Advance again after completion.
+    profiler_.endPhase(Phase::AdvanceQueue);
   }
 
   if (queue_.hasStartedStep()) {
-    std::ostringstream stream;
-    stream << "Switched step to:" << std::endl << queue_.getCurrentStep();
-    addToFeedback(stream.str());
+    feedback_.push(ExecutorFeedbackEvent::Type::StepStarted, queue_.getCurrentStep().getId());
   }
 
+  // The transforms are computed once for all motions of this advance.
+  adapter_.resetFrameTransformCache();
   if (!writeIgnoreContact()) return false;
+  profiler_.endPhase(Phase::WriteIgnoreContact);
   if (!writeIgnoreForPoseAdaptation()) return false;
+  profiler_.endPhase(Phase::WriteIgnoreForPoseAdaptation);
   if (!writeSupportLegs()) return false;
+  profiler_.endPhase(Phase::WriteSupportLegs);
   if (!writeSurfaceNormals()) return false;
+  profiler_.endPhase(Phase::WriteSurfaceNormals);
   if (!writeLegMotion()) return false;
+  profiler_.endPhase(Phase::WriteLegMotion);
   if (!writeTorsoMotion()) return false;
+  profiler_.endPhase(Phase::WriteTorsoMotion);
   if (!writeStepId()) return false;
+  profiler_.endPhase(Phase::WriteStepId);
   if (!adapter_.updateExtrasAfter(queue_, state_)) return false;
+  profiler_.endPhase(Phase::UpdateExtrasAfter);
+  if (!precomputeNextSteps()) return false;
+  if (speculativeCompleter_) speculativeCompleter_->speculate(state_, queue_, dt);
+  profiler_.endPhase(Phase::PrecomputeNextSteps);
 //  std::cout << state_ << std::endl;
 
   return true;
@@ -127,20 +162,28 @@ void Executor::pause(bool shouldPause)
   isPausing_ = shouldPause;
 }
 
-void Executor::stop()
+bool Executor::stop()
 {
-  addToFeedback("Request received for stopping execution.");
-  Executor::Lock lock(getMutex());
+  if (!commandQueue_->push(ExecutorCommand::stop())) {
+    std::cerr << "Executor::stop: Command queue is full." << std::endl;
+    return false;
+  }
+  return true;
+}
 
+void Executor::preempt()
+{
   switch (preemptionType_) {
     case PreemptionType::PREEMPT_STEP:
       if (getQueue().empty()) return;
       if (getQueue().size() <= 1) return;
       getQueue().clearNextSteps();
+      clearPrecomputations();
       return;
     case PreemptionType::PREEMPT_IMMEDIATE:
       if (getQueue().empty()) return;
       getQueue().clear();
+      clearPrecomputations();
       return;
     case PreemptionType::PREEMPT_NO:
       return;
@@ -149,22 +192,9 @@ void Executor::stop()
   }
 }
 
-void Executor::addToFeedback(const std::string& feedbackDescription)
+const ExecutorFeedbackRing& Executor::getFeedback() const
 {
-  if (!firstFeedbackDescription_) feedbackDescription_ += "\n\n--------\n\n";
-  feedbackDescription_ += feedbackDescription;
-  firstFeedbackDescription_ = false;
-}
-
-const std::string& Executor::getFeedbackDescription() const
-{
-  return feedbackDescription_;
-}
-
-void Executor::clearFeedbackDescription()
-{
-  feedbackDescription_.clear();
-  firstFeedbackDescription_ = true;
+  return feedback_;
 }
 
 void Executor::reset()
@@ -172,7 +202,11 @@ void Executor::reset()
   queue_.clear();
   resetStateWithRobot();
   adapter_.resetExtrasWithRobot(queue_, state_);
-  clearFeedbackDescription();
+  clearPrecomputations();
+  computationStepId_.clear();
+  isComputingStep_ = false;
+  areLegMotionsResolved_ = false;
+  isReset_ = true;
 }
 
 const StepQueue& Executor::getQueue() const
@@ -195,11 +229,315 @@ const AdapterBase& Executor::getAdapter() const
   return adapter_;
 }
 
+AdapterBase& Executor::getAdapter()
+{
+  return adapter_;
+}
+
+const StepCompleter& Executor::getCompleter() const
+{
+  return completer_;
+}
+
 void Executor::setPreemptionType(const PreemptionType& type)
 {
   preemptionType_ = type;
 }
 
+bool Executor::setSpeculativeCompletion(const bool speculativeCompletion)
+{
+  if (!speculativeCompletion) {
+    speculativeCompleter_.reset();
+    return true;
+  }
+  if (speculativeCompleter_) return true;
+  speculativeCompleter_.reset(new SpeculativeStepCompleter(completer_.getParameters(), adapter_));
+  speculativeCompleter_->setTolerance(precomputationTolerance_);
+  if (!speculativeCompleter_->initialize()) {
+    speculativeCompleter_.reset();
+    return false;
+  }
+  return true;
+}
+
+bool Executor::hasSpeculativeCompletion() const
+{
+  return static_cast<bool>(speculativeCompleter_);
+}
+
+bool Executor::waitForSpeculativeCompletion(const double timeout) const
+{
+  if (!speculativeCompleter_) return true;
+  return speculativeCompleter_->waitUntilIdle(timeout);
+}
+
+void Executor::setPrecomputationTolerance(const double tolerance)
+{
+  precomputationTolerance_ = tolerance;
+  if (speculativeCompleter_) speculativeCompleter_->setTolerance(tolerance);
+}
+
+double Executor::getPrecomputationTolerance() const
+{
+  return precomputationTolerance_;
+}
+
+void Executor::setProfiling(const bool profiling)
+{
+  profiler_.setEnabled(profiling);
+}
+
+bool Executor::isProfiling() const
+{
+  return profiler_.isEnabled();
+}
+
+const ExecutorProfiler& Executor::getProfiler() const
+{
+  return profiler_;
+}
+
+ExecutorCommandQueue& Executor::getCommandQueue()
+{
+  return *commandQueue_;
+}
+
+void Executor::getSnapshot(ExecutorSnapshot& snapshot) const
+{
+  std::lock_guard<std::mutex> lock(snapshotReaderMutex_);
+  snapshots_.update();
+  snapshot = snapshots_.getReadBuffer();
+}
+
+std::unique_ptr<ExecutorSnapshotReader> Executor::createSnapshotReader()
+{
+  std::lock_guard<std::mutex> lock(snapshotReaderMutex_);
+  for (size_t i = 0; i < maxSnapshotReaders_; ++i) {
+    if (!snapshotChannels_[i]) {
+      snapshotChannels_[i].reset(new ExecutorSnapshotChannel());
+      snapshotChannels_[i]->isUsed = true;
+      snapshotChannelPointers_[i] = snapshotChannels_[i].get();
+    } else if (snapshotChannels_[i]->isUsed.exchange(true)) {
+      continue;
+    }
+    return std::unique_ptr<ExecutorSnapshotReader>(new ExecutorSnapshotReader(*snapshotChannels_[i]));
+  }
+  std::cerr << "Executor::createSnapshotReader: Maximal number of snapshot readers reached." << std::endl;
+  return nullptr;
+}
+
+void Executor::processCommands()
+{
+  while (const ExecutorCommand* command = commandQueue_->front()) {
+    switch (command->type) {
+      case ExecutorCommand::Type::AddSteps:
+        // Replace a trailing pure BaseAuto step for a smooth motion.
+        if (command->replaceLastBaseAuto && queue_.size() >= 2) {
+          const Step& lastStep = queue_.getQueue().back();
+          if (!lastStep.hasLegMotion() && lastStep.hasBaseMotion()
+              && lastStep.getBaseMotion().getType() == BaseMotionBase::Type::Auto) {
+            queue_.clearLastNSteps(1);
+          }
+        }
+        queue_.add(command->steps);
+        clearPrecomputations();
+        break;
+      case ExecutorCommand::Type::Stop:
+        feedback_.push(ExecutorFeedbackEvent::Type::StopRequested);
+        preempt();
+        break;
+      case ExecutorCommand::Type::Pause:
+        pause(command->shouldPause);
+        break;
+      case ExecutorCommand::Type::SetPreemptionType:
+        setPreemptionType(command->preemptionType);
+        break;
+    }
+    commandQueue_->pop();
+  }
+}
+
+void Executor::publishSnapshot()
+{
+  updateSnapshot(snapshots_.getWriteBuffer());
+  snapshots_.publish();
+  for (auto& channelPointer : snapshotChannelPointers_) {
+    ExecutorSnapshotChannel* channel = channelPointer.load(std::memory_order_acquire);
+    if (channel == nullptr || !channel->isUsed.load(std::memory_order_relaxed)) continue;
+    updateSnapshot(channel->buffer.getWriteBuffer());
+    channel->buffer.publish();
+  }
+}
+
+void Executor::updateSnapshot(ExecutorSnapshot& snapshot) const
+{
+  snapshot.nProcessedCommands = commandQueue_->getNumberOfProcessedCommands();
+  snapshot.queueSize = queue_.size();
+  snapshot.isQueueActive = queue_.active();
+  snapshot.robotExecutionStatus = state_.getRobotExecutionStatus();
+  snapshot.activeLimbs.reset();
+  snapshot.isBaseActive = false;
+  if (queue_.active()) {
+    const Step& step = queue_.getCurrentStep();
+    snapshot.stepId = step.getId();
+    snapshot.stepDuration = step.getTotalDuration();
+    snapshot.stepPhase = step.getTotalPhase();
+    for (const auto& legMotion : step.getLegMotions()) snapshot.activeLimbs.set(getIndex(legMotion.first));
+    snapshot.isBaseActive = step.hasBaseMotion();
+  } else {
+    snapshot.stepId.clear();
+    snapshot.stepDuration = 0.0;
+    snapshot.stepPhase = 0.0;
+  }
+  snapshot.state = state_;
+  snapshot.feedbackSequence = feedback_.getSequence();
+}
+
+bool Executor::completeStep(Step& step)
+{
+  bool isPrecomputed = false;
+  const auto predictedState = predictedStartStates_.find(step.getId());
+  if (predictedState != predictedStartStates_.end()) {
+    // The id does not identify the step, it can be reused by the user.
+    const bool isValid = predictedState->second.sequenceNumber == step.getSequenceNumber()
+        && isValidPrediction(step, predictedState->second.state);
+    predictedStartStates_.erase(predictedState);
+    isPrecomputed = computer_.getPrecomputedStep(step.getId(), precomputedStep_) && isValid
+        && precomputedStep_.getSequenceNumber() == step.getSequenceNumber();
+  }
+
+  if (speculativeCompleter_) {
+    const bool hasSpeculation = speculativeCompleter_->hasSpeculation(step.getId());
+    if (speculativeCompleter_->takeSpeculation(state_, queue_, step)) {
+      feedback_.push(ExecutorFeedbackEvent::Type::UsingSpeculativeStep, step.getId());
+      return true;
+    }
+    if (hasSpeculation) feedback_.push(ExecutorFeedbackEvent::Type::RejectedSpeculativeStep, step.getId());
+  }
+  if (isPrecomputed) {
+    feedback_.push(ExecutorFeedbackEvent::Type::UsingPrecomputedStep, step.getId());
+    return completer_.complete(state_, queue_, precomputedStep_, step);
+  }
+  return completer_.complete(state_, queue_, step);
+}
+
+bool Executor::updateComputation(Step& step)
+{
+  if (!step.needsComputation() || step.isComputed()) return true;
+
+  if (isComputingStep_) {
+    if (!computer_.isDone()) return true;
+    computer_.getStep(step);
+    computer_.resetIsDone();
+    isComputingStep_ = false;
+    areLegMotionsResolved_ = false;
+    if (!step.isComputed()) {
+      std::cerr << "Executor::advance: Could not compute step." << std::endl;
+      feedback_.pushError(ExecutorFeedbackEvent::ErrorCode::ComputationFailed, step.getId());
+      return false;
+    }
+    return true;
+  }
+
+  // Retry at the next advance instead of waiting for the computer.
+  if (computer_.isBusy()) return true;
+  computer_.setStep(step);
+  isComputingStep_ = true;
+  feedback_.push(ExecutorFeedbackEvent::Type::ComputationStarted, step.getId());
+  if (!computer_.compute()) {
+    std::cerr << "Executor::advance: Could not compute step." << std::endl;
+    feedback_.pushError(ExecutorFeedbackEvent::ErrorCode::ComputationFailed, step.getId());
+    isComputingStep_ = false;
+    return false;
+  }
+  return updateComputation(step); // Synchronous computers are done already.
+}
+
+bool Executor::precomputeNextSteps()
+{
+  const size_t lookahead = computer_.getLookahead();
+  if (lookahead == 0 || !queue_.active() || !queue_.getCurrentStep().isUpdated()) return true;
+
+  const auto& steps = queue_.getQueue();
+  for (size_t i = 1; i <= lookahead && i < steps.size(); ++i) {
+    const Step& step = steps[i];
+    if (!step.needsComputation() || predictedStartStates_.count(step.getId()) > 0) continue;
+    if (!isStartStatePredictable(i)) continue;
+    PredictedStartState& prediction = predictedStartStates_[step.getId()];
+    prediction.sequenceNumber = step.getSequenceNumber();
+    prediction.state = state_;
+    predictStartState(i, prediction.state);
+    Step precomputedStep(step);
+    if (!completer_.completeJointMotions(prediction.state, precomputedStep)) {
+      std::cerr << "Executor::advance: Could not complete step for precomputation." << std::endl;
+      feedback_.pushError(ExecutorFeedbackEvent::ErrorCode::PrecomputationFailed, step.getId());
+      return false;
+    }
+    computer_.precompute(precomputedStep);
+  }
+  return true;
+}
+
+void Executor::clearPrecomputations()
+{
+  computer_.clearPrecomputations();
+  predictedStartStates_.clear();
+  if (speculativeCompleter_) speculativeCompleter_->clear();
+}
+
+bool Executor::isStartStatePredictable(const size_t stepIndex) const
+{
+  // Only pure joint position trajectories are predicted. They are fully
+  // determined by the joint positions and control setup at their start.
+  const auto& steps = queue_.getQueue();
+  const Step& step = steps[stepIndex];
+  if (step.hasBaseMotion() && step.getBaseMotion().needsComputation()) return false;
+  for (const auto& legMotion : step.getLegMotions()) {
+    if (!legMotion.second->needsComputation()) continue;
+    if (legMotion.second->getTrajectoryType() != LegMotionBase::TrajectoryType::Joints) return false;
+    const ControlSetup& controlSetup = legMotion.second->getControlSetup();
+    if (!controlSetup.at(ControlLevel::Position) || controlSetup.at(ControlLevel::Effort)) return false;
+
+    // The start state of the limb is given by the last motion of the limb
+    // before this step, which has to be a joint motion of the current step.
+    for (size_t j = stepIndex - 1; j > 0; --j) {
+      if (steps[j].hasLegMotion(legMotion.first)) return false;
+    }
+    if (steps[0].hasLegMotion(legMotion.first)) {
+      const auto& previousLegMotion = steps[0].getLegMotion(legMotion.first);
+      if (previousLegMotion.getTrajectoryType() != LegMotionBase::TrajectoryType::Joints) return false;
+      if (previousLegMotion.getControlSetup().at(ControlLevel::Effort)) return false;
+    }
+  }
+  return true;
+}
+
+void Executor::predictStartState(const size_t stepIndex, State& state) const
+{
+  const Step& currentStep = queue_.getCurrentStep();
+  for (const auto& legMotion : queue_.getQueue()[stepIndex].getLegMotions()) {
+    const LimbEnum& limb = legMotion.first;
+    if (!legMotion.second->needsComputation()) continue;
+    if (!currentStep.hasLegMotion(limb)) continue; // Remains as it is now.
+    const auto& jointMotion = dynamic_cast<const JointMotionBase&>(currentStep.getLegMotion(limb));
+    state.setControlSetup(limb, jointMotion.getControlSetup());
+    state.setJointPositionsForLimb(limb, jointMotion.evaluatePosition(jointMotion.getDuration()));
+  }
+}
+
+bool Executor::isValidPrediction(const Step& step, const State& predictedState) const
+{
+  for (const auto& legMotion : step.getLegMotions()) {
+    if (!legMotion.second->needsComputation()) continue;
+    const LimbEnum& limb = legMotion.first;
+    if (state_.getControlSetup(limb) != predictedState.getControlSetup(limb)) return false;
+    const double error = (state_.getJointPositionsForLimb(limb).vector()
+        - predictedState.getJointPositionsForLimb(limb).vector()).cwiseAbs().maxCoeff();
+    if (error > precomputationTolerance_) return false;
+  }
+  return true;
+}
+
 bool Executor::resetStateWithRobot()
 {
   for (const auto& limb : adapter_.getLimbs()) {
@@ -340,111 +678,140 @@ bool Executor::writeLegMotion()
   if (!queue_.active()) return true;
 
   const auto& step = queue_.getCurrentStep();
+  if (!step.isUpdated()) return true; // Waiting for computation.
   if (!step.hasLegMotion()) return true;
+  if (!areLegMotionsResolved_) resolveLegMotions(step);
 
   double time = queue_.getCurrentStep().getTime();
   for (const auto& limb : adapter_.getLimbs()) {
-    if (!step.hasLegMotion(limb)) continue;
-    auto const& legMotion = step.getLegMotion(limb);
-    ControlSetup controlSetup = legMotion.getControlSetup();
+    const LegMotionVariant& legMotion = legMotions_[getIndex(limb)];
+    if (legMotion.empty()) continue;
+    const ControlSetup& controlSetup = legMotion.getControlSetup();
     state_.setControlSetup(limb, controlSetup);
 
-    switch (legMotion.getTrajectoryType()) {
-
-      case LegMotionBase::TrajectoryType::EndEffector:
-      {
-        const auto& endEffectorMotion = dynamic_cast<const EndEffectorMotionBase&>(legMotion);
-        if (controlSetup[ControlLevel::Position]) {
-          const std::string& frameId = endEffectorMotion.getFrameId(ControlLevel::Position);
-          if (!adapter_.frameIdExists(frameId)) {
-            std::cerr << "Could not find frame '" << frameId << "' for free gait leg motion!" << std::endl;
-            return false;
-          }
-          Position positionInBaseFrame = adapter_.transformPosition(frameId, adapter_.getBaseFrameId(), endEffectorMotion.evaluatePosition(time));
-          JointPositionsLeg jointPositions;
-          if (!adapter_.getLimbJointPositionsFromPositionBaseToFootInBaseFrame(positionInBaseFrame, limb, jointPositions)) {
-            std::cerr << "Failed to compute joint positions from end effector position for " <<limb << "." << std::endl;
-            return false;
-          }
-          state_.setJointPositionsForLimb(limb, jointPositions);
+    if (legMotion.isEndEffectorMotion()) {
+      // All derivatives are evaluated with a single trajectory lookup.
+      Position position;
+      LinearVelocity velocity;
+      LinearAcceleration acceleration;
+      if (controlSetup.at(ControlLevel::Position) || controlSetup.at(ControlLevel::Velocity)
+          || controlSetup.at(ControlLevel::Acceleration)) {
+        legMotion.evaluate(time, position, velocity, acceleration);
+      }
+      if (controlSetup.at(ControlLevel::Position)) {
+        const FrameId frameId = legMotion.getFrameHandle(ControlLevel::Position);
+        if (!adapter_.frameIdExists(frameId)) {
+          std::cerr << "Could not find frame " << adapter_.getFrameRegistry().getDescription(frameId)
+                    << " for free gait leg motion!" << std::endl;
+          feedback_.pushError(ExecutorFeedbackEvent::ErrorCode::FrameNotFound, step.getId(), limb);
+          return false;
         }
-        if (controlSetup[ControlLevel::Velocity]) {
-          const std::string& frameId = endEffectorMotion.getFrameId(ControlLevel::Velocity);
-          if (!adapter_.frameIdExists(frameId)) {
-            std::cerr << "Could not find frame '" << frameId << "' for free gait leg motion!" << std::endl;
-            return false;
-          }
-          // TODO This is dangerous due to difference between relative velocity vs. expression in frames.
-          LinearVelocity velocityInWorldFrame = adapter_.transformLinearVelocity(
-              frameId, adapter_.getWorldFrameId(), endEffectorMotion.evaluateVelocity(time));
-          const JointVelocitiesLeg jointVelocities = adapter_.getJointVelocitiesFromEndEffectorLinearVelocityInWorldFrame(limb, velocityInWorldFrame);
-          state_.setJointVelocitiesForLimb(limb, jointVelocities);
+        Position positionInBaseFrame = adapter_.transformPosition(frameId, baseFrameId_, position);
+        JointPositionsLeg jointPositions;
+        if (!adapter_.getLimbJointPositionsFromPositionBaseToFootInBaseFrame(positionInBaseFrame, limb, jointPositions)) {
+          std::cerr << "Failed to compute joint positions from end effector position for " <<limb << "." << std::endl;
+          feedback_.pushError(ExecutorFeedbackEvent::ErrorCode::InverseKinematicsFailed, step.getId(), limb);
+          return false;
         }
-        if (controlSetup[ControlLevel::Acceleration]) {
-          const std::string& frameId = endEffectorMotion.getFrameId(ControlLevel::Acceleration);
-          if (!adapter_.frameIdExists(frameId)) {
-            std::cerr << "Could not find frame '" << frameId << "' for free gait leg motion!" << std::endl;
-            return false;
-          }
-          LinearAcceleration accelerationInWorldFrame = adapter_.transformLinearAcceleration(
-              frameId, adapter_.getWorldFrameId(), endEffectorMotion.evaluateAcceleration(time));
-          const JointAccelerationsLeg jointAccelerations = adapter_.getJointAccelerationsFromEndEffectorLinearAccelerationInWorldFrame(limb, accelerationInWorldFrame);
-          state_.setJointAccelerationsForLimb(limb, jointAccelerations);
+        state_.setJointPositionsForLimb(limb, jointPositions);
+      }
+      if (controlSetup.at(ControlLevel::Velocity)) {
+        const FrameId frameId = legMotion.getFrameHandle(ControlLevel::Velocity);
+        if (!adapter_.frameIdExists(frameId)) {
+          std::cerr << "Could not find frame " << adapter_.getFrameRegistry().getDescription(frameId)
+                    << " for free gait leg motion!" << std::endl;
+          feedback_.pushError(ExecutorFeedbackEvent::ErrorCode::FrameNotFound, step.getId(), limb);
+          return false;
         }
-        break;
+        // TODO This is dangerous due to difference between relative velocity vs. expression in frames.
+        LinearVelocity velocityInWorldFrame = adapter_.transformLinearVelocity(
+            frameId, worldFrameId_, velocity);
+        const JointVelocitiesLeg jointVelocities = adapter_.getJointVelocitiesFromEndEffectorLinearVelocityInWorldFrame(limb, velocityInWorldFrame);
+        state_.setJointVelocitiesForLimb(limb, jointVelocities);
       }
-
-      case LegMotionBase::TrajectoryType::Joints:
-      {
-        const auto& jointMotion = dynamic_cast<const JointMotionBase&>(legMotion);
-        if (controlSetup[ControlLevel::Position]) state_.setJointPositionsForLimb(limb, jointMotion.evaluatePosition(time));
-        if (controlSetup[ControlLevel::Velocity]) state_.setJointVelocitiesForLimb(limb, jointMotion.evaluateVelocity(time));
-        if (controlSetup[ControlLevel::Acceleration]) state_.setJointAccelerationsForLimb(limb, jointMotion.evaluateAcceleration(time));
-        if (controlSetup[ControlLevel::Effort]) state_.setJointEffortsForLimb(limb, jointMotion.evaluateEffort(time));
-        break;
+      if (controlSetup.at(ControlLevel::Acceleration)) {
+        const FrameId frameId = legMotion.getFrameHandle(ControlLevel::Acceleration);
+        if (!adapter_.frameIdExists(frameId)) {
+          std::cerr << "Could not find frame " << adapter_.getFrameRegistry().getDescription(frameId)
+                    << " for free gait leg motion!" << std::endl;
+          feedback_.pushError(ExecutorFeedbackEvent::ErrorCode::FrameNotFound, step.getId(), limb);
+          return false;
+        }
+        LinearAcceleration accelerationInWorldFrame = adapter_.transformLinearAcceleration(
+            frameId, worldFrameId_, acceleration);
+        const JointAccelerationsLeg jointAccelerations = adapter_.getJointAccelerationsFromEndEffectorLinearAccelerationInWorldFrame(limb, accelerationInWorldFrame);
+        state_.setJointAccelerationsForLimb(limb, jointAccelerations);
       }
-
-      default:
-        throw std::runtime_error("Executor::writeLegMotion() could not write leg motion of this type.");
-        break;
+    } else {
+      JointPositionsLeg jointPositions;
+      JointVelocitiesLeg jointVelocities;
+      JointAccelerationsLeg jointAccelerations;
+      if (controlSetup.at(ControlLevel::Position) || controlSetup.at(ControlLevel::Velocity)
+          || controlSetup.at(ControlLevel::Acceleration)) {
+        legMotion.evaluateJoints(time, jointPositions, jointVelocities, jointAccelerations);
+      }
+      if (controlSetup.at(ControlLevel::Position)) state_.setJointPositionsForLimb(limb, jointPositions);
+      if (controlSetup.at(ControlLevel::Velocity)) state_.setJointVelocitiesForLimb(limb, jointVelocities);
+      if (controlSetup.at(ControlLevel::Acceleration)) state_.setJointAccelerationsForLimb(limb, jointAccelerations);
+      if (controlSetup.at(ControlLevel::Effort)) state_.setJointEffortsForLimb(limb, legMotion.evaluateJointEfforts(time));
     }
   }
 
   return true;
 }
 
+void Executor::resolveLegMotions(const Step& step)
+{
+  for (const auto& limb : adapter_.getLimbs()) {
+    legMotions_[getIndex(limb)] = step.hasLegMotion(limb) ? LegMotionVariant(step.getLegMotion(limb)) : LegMotionVariant();
+  }
+  areLegMotionsResolved_ = true;
+}
+
 bool Executor::writeTorsoMotion()
 {
   if (state_.getNumberOfSupportLegs() == 0) state_.setEmptyControlSetup(BranchEnum::BASE);
   if (!queue_.active()) return true;
 
+  if (!queue_.getCurrentStep().isUpdated()) return true; // Waiting for computation.
   if (!queue_.getCurrentStep().hasBaseMotion()) return true;
   double time = queue_.getCurrentStep().getTime();
   const auto& baseMotion = queue_.getCurrentStep().getBaseMotion();
-  ControlSetup controlSetup = baseMotion.getControlSetup();
+  const ControlSetup& controlSetup = baseMotion.getControlSetup();
   state_.setControlSetup(BranchEnum::BASE, controlSetup);
-  if (controlSetup[ControlLevel::Position]) {
-    const std::string& frameId = baseMotion.getFrameId(ControlLevel::Position);
+  Pose pose;
+  Twist twist;
+  if (controlSetup.at(ControlLevel::Position) && controlSetup.at(ControlLevel::Velocity)) {
+    baseMotion.evaluate(time, pose, twist);
+  } else if (controlSetup.at(ControlLevel::Position)) {
+    pose = baseMotion.evaluatePose(time);
+  } else if (controlSetup.at(ControlLevel::Velocity)) {
+    twist = baseMotion.evaluateTwist(time);
+  }
+  if (controlSetup.at(ControlLevel::Position)) {
+    const FrameId frameId = baseMotion.getFrameHandle(ControlLevel::Position);
     if (!adapter_.frameIdExists(frameId)) {
-      std::cerr << "Could not find frame '" << frameId << "' for free gait base motion!" << std::endl;
+      std::cerr << "Could not find frame " << adapter_.getFrameRegistry().getDescription(frameId)
+                << " for free gait base motion!" << std::endl;
+      feedback_.pushError(ExecutorFeedbackEvent::ErrorCode::FrameNotFound, queue_.getCurrentStep().getId());
       return false;
     }
-    Pose poseInWorldFrame = adapter_.transformPose(frameId, adapter_.getWorldFrameId(),
-                                                    baseMotion.evaluatePose(time));
+    Pose poseInWorldFrame = adapter_.transformPose(frameId, worldFrameId_, pose);
     state_.setPositionWorldToBaseInWorldFrame(poseInWorldFrame.getPosition());
     state_.setOrientationBaseToWorld(poseInWorldFrame.getRotation());
   }
-  if (controlSetup[ControlLevel::Velocity]) {
-    const std::string& frameId = baseMotion.getFrameId(ControlLevel::Velocity);
+  if (controlSetup.at(ControlLevel::Velocity)) {
+    const FrameId frameId = baseMotion.getFrameHandle(ControlLevel::Velocity);
     if (!adapter_.frameIdExists(frameId)) {
-      std::cerr << "Could not find frame '" << frameId << "' for free gait base motion!" << std::endl;
+      std::cerr << "Could not find frame " << adapter_.getFrameRegistry().getDescription(frameId)
+                << " for free gait base motion!" << std::endl;
+      feedback_.pushError(ExecutorFeedbackEvent::ErrorCode::FrameNotFound, queue_.getCurrentStep().getId());
       return false;
     }
-    Twist twist = baseMotion.evaluateTwist(time);
     LinearVelocity linearVelocityInWorldFrame = adapter_.transformLinearVelocity(
-        frameId, adapter_.getWorldFrameId(), twist.getTranslationalVelocity());
+        frameId, worldFrameId_, twist.getTranslationalVelocity());
     LocalAngularVelocity angularVelocityInBaseFrame = adapter_.transformAngularVelocity(
-        frameId, adapter_.getBaseFrameId(), twist.getRotationalVelocity());
+        frameId, baseFrameId_, twist.getRotationalVelocity());
     state_.setLinearVelocityBaseInWorldFrame(linearVelocityInWorldFrame);
     state_.setAngularVelocityBaseInBaseFrame(angularVelocityInBaseFrame);
   }
@@ -0,0 +1,97 @@
+/*
+ * ExecutorCommandQueue.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#include "free_gait_core/executor/ExecutorCommandQueue.hpp"
+
+namespace free_gait {
+
+constexpr size_t ExecutorCommandQueue::capacity;
+
+ExecutorCommand::ExecutorCommand()
+    : type(Type::Stop),
+      replaceLastBaseAuto(false),
+      shouldPause(false),
+      preemptionType(Executor::PreemptionType::PREEMPT_STEP)
+{
+}
+
+ExecutorCommand ExecutorCommand::addSteps(const std::vector<Step>& steps, const bool replaceLastBaseAuto)
+{
+  ExecutorCommand command;
+  command.type = Type::AddSteps;
+  command.steps = steps;
+  command.replaceLastBaseAuto = replaceLastBaseAuto;
+  return command;
+}
+
+ExecutorCommand ExecutorCommand::stop()
+{
+  ExecutorCommand command;
+  command.type = Type::Stop;
+  return command;
+}
+
+ExecutorCommand ExecutorCommand::pause(const bool shouldPause)
+{
+  ExecutorCommand command;
+  command.type = Type::Pause;
+  command.shouldPause = shouldPause;
+  return command;
+}
+
+ExecutorCommand ExecutorCommand::setPreemptionType(const Executor::PreemptionType& preemptionType)
+{
+  ExecutorCommand command;
+  command.type = Type::SetPreemptionType;
+  command.preemptionType = preemptionType;
+  return command;
+}
+
+ExecutorCommandQueue::ExecutorCommandQueue()
+    : head_(0),
+      tail_(0)
+{
+}
+
+ExecutorCommandQueue::~ExecutorCommandQueue()
+{
+}
+
+bool ExecutorCommandQueue::push(const ExecutorCommand& command)
+{
+  std::lock_guard<std::mutex> lock(producerMutex_);
+  const uint64_t tail = tail_.load(std::memory_order_relaxed);
+  if (tail - head_.load(std::memory_order_acquire) >= capacity) return false;
+  // Overwriting the processed command releases its memory here, not in the executor.
+  commands_[tail % capacity] = command;
+  tail_.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+const ExecutorCommand* ExecutorCommandQueue::front() const
+{
+  const uint64_t head = head_.load(std::memory_order_relaxed);
+  if (head == tail_.load(std::memory_order_acquire)) return nullptr;
+  return &commands_[head % capacity];
+}
+
+void ExecutorCommandQueue::pop()
+{
+  head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+uint64_t ExecutorCommandQueue::getNumberOfPushedCommands() const
+{
+  return tail_.load(std::memory_order_acquire);
+}
+
+uint64_t ExecutorCommandQueue::getNumberOfProcessedCommands() const
+{
+  return head_.load(std::memory_order_acquire);
+}
+
+} /* namespace free_gait */
@@ -0,0 +1,186 @@
+/*
+ * ExecutorFeedback.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#include "free_gait_core/executor/ExecutorFeedback.hpp"
+#include "free_gait_core/TypePrints.hpp"
+
+// STD
+#include <algorithm>
+#include <cstring>
+
+namespace free_gait {
+
+constexpr size_t ExecutorFeedbackEvent::maxStepIdLength;
+constexpr size_t ExecutorFeedbackRing::capacity;
+
+ExecutorFeedbackEvent::ExecutorFeedbackEvent()
+    : type(Type::StepStarted),
+      errorCode(ErrorCode::None),
+      hasLimb(false),
+      limb(LimbEnum::LF_LEG)
+{
+  stepId[0] = '\0';
+}
+
+void ExecutorFeedbackEvent::setStepId(const std::string& id)
+{
+  const size_t length = std::min(id.size(), maxStepIdLength);
+  std::memcpy(stepId.data(), id.data(), length);
+  stepId[length] = '\0';
+}
+
+const char* ExecutorFeedbackEvent::getStepId() const
+{
+  return stepId.data();
+}
+
+bool ExecutorFeedbackEvent::hasStepId() const
+{
+  return stepId[0] != '\0';
+}
+
+std::ostream& operator<<(std::ostream& out, const ExecutorFeedbackEvent& event)
+{
+  typedef ExecutorFeedbackEvent::Type Type;
+  switch (event.type) {
+    case Type::StepStarted:
+      return out << "Switched step to: " << event.getStepId();
+    case Type::Paused:
+      return out << "Paused execution.";
+    case Type::RobotNotOk:
+      return out << "Robot status is not OK, paused execution.";
+    case Type::Resumed:
+      return out << "Continuing with execution.";
+    case Type::StopRequested:
+      return out << "Request received for stopping execution.";
+    case Type::ComputationStarted:
+      return out << "Starting computation of step " << event.getStepId() << ".";
+    case Type::UsingPrecomputedStep:
+      return out << "Using precomputed step.";
+    case Type::UsingSpeculativeStep:
+      return out << "Using speculatively completed step.";
+    case Type::RejectedSpeculativeStep:
+      return out << "Rejected speculatively completed step " << event.getStepId() << ".";
+    case Type::Error:
+      out << "Error: " << event.errorCode;
+      if (event.hasStepId()) out << " (step " << event.getStepId();
+      if (event.hasLimb) out << (event.hasStepId() ? ", " : " (") << event.limb;
+      if (event.hasStepId() || event.hasLimb) out << ")";
+      return out << ".";
+  }
+  return out;
+}
+
+std::ostream& operator<<(std::ostream& out, const ExecutorFeedbackEvent::ErrorCode& errorCode)
+{
+  typedef ExecutorFeedbackEvent::ErrorCode ErrorCode;
+  switch (errorCode) {
+    case ErrorCode::None:
+      return out << "None";
+    case ErrorCode::CompletionFailed:
+      return out << "Could not complete step";
+    case ErrorCode::ComputationFailed:
+      return out << "Could not compute step";
+    case ErrorCode::PrecomputationFailed:
+      return out << "Could not complete step for precomputation";
+    case ErrorCode::FrameNotFound:
+      return out << "Could not find frame";
+    case ErrorCode::InverseKinematicsFailed:
+      return out << "Failed to compute joint positions from end effector position";
+  }
+  return out;
+}
+
+ExecutorFeedbackRing::ExecutorFeedbackRing()
+    : sequence_(0)
+{
+  for (auto& slot : slots_) slot.sequence = 0;
+}
+
+ExecutorFeedbackRing::~ExecutorFeedbackRing()
+{
+}
+
+void ExecutorFeedbackRing::push(const ExecutorFeedbackEvent::Type type, const std::string& stepId)
+{
+  ExecutorFeedbackEvent& event = beginPush();
+  event.type = type;
+  event.errorCode = ExecutorFeedbackEvent::ErrorCode::None;
+  event.hasLimb = false;
+  event.setStepId(stepId);
+  endPush();
+}
+
+void ExecutorFeedbackRing::pushError(const ExecutorFeedbackEvent::ErrorCode errorCode, const std::string& stepId)
+{
+  ExecutorFeedbackEvent& event = beginPush();
+  event.type = ExecutorFeedbackEvent::Type::Error;
+  event.errorCode = errorCode;
+  event.hasLimb = false;
+  event.setStepId(stepId);
+  endPush();
+}
+
+void ExecutorFeedbackRing::pushError(const ExecutorFeedbackEvent::ErrorCode errorCode, const std::string& stepId,
+                                     const LimbEnum& limb)
+{
+  ExecutorFeedbackEvent& event = beginPush();
+  event.type = ExecutorFeedbackEvent::Type::Error;
+  event.errorCode = errorCode;
+  event.hasLimb = true;
+  event.limb = limb;
+  event.setStepId(stepId);
+  endPush();
+}
+
+bool ExecutorFeedbackRing::read(uint64_t& sequence, ExecutorFeedbackEvent& event, uint64_t& nDropped) const
+{
+  nDropped = 0;
+  while (true) {
+    const uint64_t latestSequence = sequence_.load(std::memory_order_acquire);
+    if (sequence >= latestSequence) return false;
+    uint64_t nextSequence = sequence + 1;
+    if (latestSequence - nextSequence >= capacity) {
+      // Overwritten already.
+      const uint64_t oldestSequence = latestSequence - capacity + 1;
+      nDropped += oldestSequence - nextSequence;
+      nextSequence = oldestSequence;
+    }
+
+    // Sequence lock: the copy is only valid if the slot has not been
+    // rewritten by the executor in the meantime.
+    const Slot& slot = slots_[nextSequence % capacity];
+    const uint64_t slotSequence = slot.sequence.load(std::memory_order_acquire);
+    event = slot.event;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    sequence = nextSequence;
+    if (slotSequence == nextSequence && slot.sequence.load(std::memory_order_relaxed) == nextSequence) return true;
+    ++nDropped;
+  }
+}
+
+uint64_t ExecutorFeedbackRing::getSequence() const
+{
+  return sequence_.load(std::memory_order_acquire);
+}
+
+ExecutorFeedbackEvent& ExecutorFeedbackRing::beginPush()
+{
+  Slot& slot = slots_[(sequence_.load(std::memory_order_relaxed) + 1) % capacity];
+  slot.sequence.store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  return slot.event;
+}
+
+void ExecutorFeedbackRing::endPush()
+{
+  const uint64_t sequence = sequence_.load(std::memory_order_relaxed) + 1;
+  slots_[sequence % capacity].sequence.store(sequence, std::memory_order_release);
+  sequence_.store(sequence, std::memory_order_release);
+}
+
+} /* namespace free_gait */
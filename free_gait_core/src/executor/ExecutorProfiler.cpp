@@ -0,0 +1,119 @@
+/*
+ * ExecutorProfiler.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#include "free_gait_core/executor/ExecutorProfiler.hpp"
+#include "free_gait_core/step/Step.hpp"
+
+namespace free_gait {
+
+constexpr size_t ExecutorProfiler::nPhases;
+constexpr size_t ExecutorProfiler::nStepTypes;
+
+ExecutorProfiler::ExecutorProfiler()
+    : isEnabled_(false),
+      isMeasuring_(false)
+{
+  durations_.fill(-1);
+}
+
+ExecutorProfiler::~ExecutorProfiler()
+{
+}
+
+void ExecutorProfiler::setEnabled(const bool enabled)
+{
+  isEnabled_ = enabled;
+}
+
+bool ExecutorProfiler::isEnabled() const
+{
+  return isEnabled_;
+}
+
+void ExecutorProfiler::startAdvance()
+{
+  isMeasuring_ = isEnabled_;
+  if (!isMeasuring_) return;
+  durations_.fill(-1);
+  startTime_ = phaseStartTime_ = Clock::now();
+}
+
+void ExecutorProfiler::endPhase(const Phase& phase)
+{
+  if (!isMeasuring_) return;
+  const Clock::time_point endTime = Clock::now();
+  int64_t& duration = durations_[static_cast<size_t>(phase)];
+  if (duration < 0) duration = 0;
+  duration += std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - phaseStartTime_).count();
+  phaseStartTime_ = endTime;
+}
+
+void ExecutorProfiler::endAdvance(const StepType& stepType, const bool isSuccessful)
+{
+  if (!isMeasuring_) return;
+  isMeasuring_ = false;
+  const int64_t duration = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - startTime_).count();
+  durations_[static_cast<size_t>(Phase::Advance)] = duration;
+  if (!isSuccessful) durations_[static_cast<size_t>(Phase::FailedAdvance)] = duration;
+  for (size_t i = 0; i < nPhases; ++i) {
+    if (durations_[i] < 0) continue; // Phase was not run.
+    histograms_[i][static_cast<size_t>(stepType)].add(durations_[i]);
+  }
+}
+
+void ExecutorProfiler::clear()
+{
+  for (auto& phaseHistograms : histograms_) {
+    for (auto& histogram : phaseHistograms) histogram.clear();
+  }
+}
+
+LatencyHistogram::Statistics ExecutorProfiler::getStatistics(const Phase& phase) const
+{
+  LatencyHistogram::Counts counts;
+  for (const auto& histogram : histograms_[static_cast<size_t>(phase)]) histogram.getCounts(counts);
+  return counts.getStatistics();
+}
+
+LatencyHistogram::Statistics ExecutorProfiler::getStatistics(const Phase& phase, const StepType& stepType) const
+{
+  return histograms_[static_cast<size_t>(phase)][static_cast<size_t>(stepType)].getStatistics();
+}
+
+ExecutorProfiler::StepType ExecutorProfiler::getStepType(const Step& step)
+{
+  if (!step.hasBaseMotion()) return StepType::LegMotion;
+  switch (step.getBaseMotion().getType()) {
+    case BaseMotionBase::Type::Auto:
+      return StepType::BaseAuto;
+    case BaseMotionBase::Type::Target:
+      return StepType::BaseTarget;
+    case BaseMotionBase::Type::Trajectory:
+      return StepType::BaseTrajectory;
+    default:
+      return StepType::LegMotion;
+  }
+}
+
+const std::string& ExecutorProfiler::getPhaseName(const Phase& phase)
+{
+  static const std::array<std::string, nPhases> names{{
+    "process_commands", "update_state_with_measurements", "update_computation", "advance_queue", "update_extras_before",
+    "complete_step", "write_ignore_contact", "write_ignore_for_pose_adaptation", "write_support_legs",
+    "write_surface_normals", "write_leg_motion", "write_torso_motion", "write_step_id", "update_extras_after",
+    "precompute_next_steps", "publish_snapshot", "advance", "failed_advance"}};
+  return names[static_cast<size_t>(phase)];
+}
+
+const std::string& ExecutorProfiler::getStepTypeName(const StepType& stepType)
+{
+  static const std::array<std::string, nStepTypes> names{{
+    "none", "leg_motion", "base_auto", "base_target", "base_trajectory"}};
+  return names[static_cast<size_t>(stepType)];
+}
+
+} /* namespace free_gait */
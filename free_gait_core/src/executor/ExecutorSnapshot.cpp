@@ -0,0 +1,52 @@
+/*
+ * ExecutorSnapshot.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#include "free_gait_core/executor/ExecutorSnapshot.hpp"
+
+namespace free_gait {
+
+ExecutorSnapshot::ExecutorSnapshot()
+    : nProcessedCommands(0),
+      queueSize(0),
+      isQueueActive(false),
+      robotExecutionStatus(false),
+      stepDuration(0.0),
+      stepPhase(0.0),
+      isBaseActive(false),
+      feedbackSequence(0)
+{
+  // Such that publishing from the executor does not allocate.
+  stepId.reserve(128);
+  state.reserveStepId(128);
+}
+
+ExecutorSnapshotChannel::ExecutorSnapshotChannel()
+    : isUsed(false)
+{
+}
+
+ExecutorSnapshotReader::ExecutorSnapshotReader(ExecutorSnapshotChannel& channel)
+    : channel_(channel)
+{
+}
+
+ExecutorSnapshotReader::~ExecutorSnapshotReader()
+{
+  channel_.isUsed = false;
+}
+
+bool ExecutorSnapshotReader::update()
+{
+  return channel_.buffer.update();
+}
+
+const ExecutorSnapshot& ExecutorSnapshotReader::getSnapshot() const
+{
+  return channel_.buffer.getReadBuffer();
+}
+
+} /* namespace free_gait */
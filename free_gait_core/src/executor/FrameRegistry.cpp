@@ -0,0 +1,103 @@
+/*
+ * FrameRegistry.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#include "free_gait_core/executor/FrameRegistry.hpp"
+
+// STD
+#include <iostream>
+#include <stdexcept>
+
+namespace free_gait {
+
+constexpr FrameId FrameRegistry::invalidFrameId;
+constexpr size_t FrameRegistry::blockSize;
+constexpr size_t FrameRegistry::maxSize;
+constexpr size_t FrameRegistry::maxNumberOfBlocks;
+
+FrameRegistry::FrameRegistry()
+    : size_(0)
+{
+  for (auto& block : blocks_) block.store(nullptr, std::memory_order_relaxed);
+}
+
+FrameRegistry::~FrameRegistry()
+{
+  for (auto& block : blocks_) delete block.load(std::memory_order_relaxed);
+}
+
+FrameRegistry& FrameRegistry::getInstance()
+{
+  static FrameRegistry registry;
+  return registry;
+}
+
+FrameId FrameRegistry::intern(const std::string& name)
+{
+  const FrameId frameId = find(name);
+  if (frameId != invalidFrameId) return frameId;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  const size_t size = size_.load(std::memory_order_relaxed);
+  for (size_t i = 0; i < size; ++i) {
+    if (getName(static_cast<FrameId>(i)) == name) return static_cast<FrameId>(i); // Registered concurrently.
+  }
+  if (size == maxSize) {
+    std::cerr << "FrameRegistry::intern: Could not register frame '" << name << "', registry is full ("
+        << maxSize << " frames)." << std::endl;
+    return invalidFrameId;
+  }
+  std::atomic<Block*>& block = blocks_[size / blockSize];
+  if (block.load(std::memory_order_relaxed) == nullptr) block.store(new Block(), std::memory_order_relaxed);
+  (*block.load(std::memory_order_relaxed))[size % blockSize] = name;
+  size_.store(size + 1, std::memory_order_release);
+  return static_cast<FrameId>(size);
+}
+
+FrameId FrameRegistry::internOrThrow(const std::string& name)
+{
+  const FrameId frameId = intern(name);
+  if (frameId == invalidFrameId) {
+    throw std::runtime_error("FrameRegistry: Could not register frame '" + name + "', registry is full.");
+  }
+  return frameId;
+}
+
+FrameId FrameRegistry::find(const std::string& name) const
+{
+  const size_t size = size_.load(std::memory_order_acquire);
+  for (size_t i = 0; i < size; ++i) {
+    if ((*blocks_[i / blockSize].load(std::memory_order_relaxed))[i % blockSize] == name) {
+      return static_cast<FrameId>(i);
+    }
+  }
+  return invalidFrameId;
+}
+
+const std::string& FrameRegistry::getName(const FrameId frameId) const
+{
+  static const std::string emptyName;
+  if (!isValid(frameId)) return emptyName;
+  return (*blocks_[frameId / blockSize].load(std::memory_order_relaxed))[frameId % blockSize];
+}
+
+std::string FrameRegistry::getDescription(const FrameId frameId) const
+{
+  if (!isValid(frameId)) return "with handle " + std::to_string(frameId) + " (not registered)";
+  return "'" + getName(frameId) + "'";
+}
+
+bool FrameRegistry::isValid(const FrameId frameId) const
+{
+  return frameId < size_.load(std::memory_order_acquire);
+}
+
+size_t FrameRegistry::size() const
+{
+  return size_.load(std::memory_order_acquire);
+}
+
+} /* namespace free_gait */
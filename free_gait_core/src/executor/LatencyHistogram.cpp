@@ -0,0 +1,137 @@
+/*
+ * LatencyHistogram.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#include "free_gait_core/executor/LatencyHistogram.hpp"
+
+// STD
+#include <algorithm>
+#include <cmath>
+
+namespace free_gait {
+
+constexpr size_t LatencyHistogram::windowSize;
+constexpr size_t LatencyHistogram::nSubBuckets;
+constexpr size_t LatencyHistogram::nBuckets;
+
+LatencyHistogram::Counts::Counts()
+    : nSamples(0),
+      max(0)
+{
+  buckets.fill(0);
+}
+
+void LatencyHistogram::Counts::add(const Counts& other)
+{
+  for (size_t i = 0; i < nBuckets; ++i) buckets[i] += other.buckets[i];
+  nSamples += other.nSamples;
+  max = std::max(max, other.max);
+}
+
+LatencyHistogram::Statistics LatencyHistogram::Counts::getStatistics() const
+{
+  Statistics statistics{0, 0.0, 0.0, 0.0};
+  // The sum of the buckets can differ from nSamples while the writer is adding.
+  size_t nCounted = 0;
+  for (const auto count : buckets) nCounted += count;
+  if (nCounted == 0) return statistics;
+  statistics.nSamples = nCounted;
+  statistics.max = 1e-9 * max;
+
+  // Percentiles are the upper bound of their bucket, but never above the max.
+  const size_t medianRank = static_cast<size_t>(std::ceil(0.5 * nCounted));
+  const size_t percentile99Rank = static_cast<size_t>(std::ceil(0.99 * nCounted));
+  size_t cumulativeCount = 0;
+  for (size_t i = 0; i < nBuckets; ++i) {
+    if (buckets[i] == 0) continue;
+    const size_t previousCount = cumulativeCount;
+    cumulativeCount += buckets[i];
+    const double upperBound = 1e-9 * std::min(getBucketUpperBound(i), max);
+    if (previousCount < medianRank && cumulativeCount >= medianRank) statistics.median = upperBound;
+    if (previousCount < percentile99Rank && cumulativeCount >= percentile99Rank) {
+      statistics.percentile99 = upperBound;
+      break;
+    }
+  }
+  return statistics;
+}
+
+LatencyHistogram::LatencyHistogram()
+    : activeWindow_(0)
+{
+  clear();
+}
+
+LatencyHistogram::~LatencyHistogram()
+{
+}
+
+void LatencyHistogram::add(const uint64_t duration)
+{
+  const size_t active = activeWindow_.load(std::memory_order_relaxed);
+  Window& window = windows_[active];
+  auto& bucket = window.buckets[getBucket(duration)];
+  bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  if (duration > window.max.load(std::memory_order_relaxed)) window.max.store(duration, std::memory_order_relaxed);
+  const uint32_t nSamples = window.nSamples.load(std::memory_order_relaxed) + 1;
+  window.nSamples.store(nSamples, std::memory_order_release);
+
+  // Roll over: Drop the older window and continue counting in it.
+  if (nSamples >= windowSize) {
+    const size_t inactive = 1 - active;
+    clear(windows_[inactive]);
+    activeWindow_.store(inactive, std::memory_order_release);
+  }
+}
+
+void LatencyHistogram::clear()
+{
+  clear(windows_[0]);
+  clear(windows_[1]);
+  activeWindow_.store(0, std::memory_order_release);
+}
+
+void LatencyHistogram::getCounts(Counts& counts) const
+{
+  for (const auto& window : windows_) {
+    for (size_t i = 0; i < nBuckets; ++i) counts.buckets[i] += window.buckets[i].load(std::memory_order_relaxed);
+    counts.nSamples += window.nSamples.load(std::memory_order_acquire);
+    counts.max = std::max(counts.max, window.max.load(std::memory_order_relaxed));
+  }
+}
+
+LatencyHistogram::Statistics LatencyHistogram::getStatistics() const
+{
+  Counts counts;
+  getCounts(counts);
+  return counts.getStatistics();
+}
+
+size_t LatencyHistogram::getBucket(const uint64_t duration)
+{
+  if (duration < nSubBuckets) return duration;
+  // Exponent of the highest bit (>= 3) and the next three bits as sub-bucket.
+  const size_t exponent = 63 - __builtin_clzll(duration);
+  const size_t subBucket = (duration >> (exponent - 3)) & (nSubBuckets - 1);
+  return std::min((exponent - 2) * nSubBuckets + subBucket, nBuckets - 1);
+}
+
+uint64_t LatencyHistogram::getBucketUpperBound(const size_t bucket)
+{
+  if (bucket < nSubBuckets) return bucket;
+  const size_t exponent = bucket / nSubBuckets + 2;
+  const uint64_t subBucket = bucket % nSubBuckets;
+  return ((nSubBuckets + subBucket + 1) << (exponent - 3)) - 1;
+}
+
+void LatencyHistogram::clear(Window& window)
+{
+  for (auto& bucket : window.buckets) bucket.store(0, std::memory_order_relaxed);
+  window.max.store(0, std::memory_order_relaxed);
+  window.nSamples.store(0, std::memory_order_release);
+}
+
+} /* namespace free_gait */
@@ -0,0 +1,240 @@
+/*
+ * SpeculativeStepCompleter.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#include "free_gait_core/executor/SpeculativeStepCompleter.hpp"
+#include "free_gait_core/executor/Executor.hpp"
+#include "free_gait_core/step/StepCompleter.hpp"
+#include "free_gait_core/step/StepComputer.hpp"
+
+#include <chrono>
+#include <cmath>
+
+namespace free_gait {
+
+SpeculativeStepCompleter::SpeculativeStepCompleter(const StepParameters& parameters,
+                                                   const AdapterBase& adapter)
+    : parameters_(parameters),
+      adapter_(adapter),
+      isStopping_(false),
+      isRunning_(false),
+      isQueued_(false),
+      tolerance_(1e-3)
+{
+}
+
+SpeculativeStepCompleter::~SpeculativeStepCompleter()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    isStopping_ = true;
+  }
+  condition_.notify_all();
+  if (worker_.joinable()) worker_.join();
+}
+
+bool SpeculativeStepCompleter::initialize()
+{
+  if (isInitialized()) return true;
+  adapterCopy_ = adapter_.clone();
+  if (!adapterCopy_) {
+    std::cerr << "SpeculativeStepCompleter::initialize: Adapter does not support copies." << std::endl;
+    return false;
+  }
+  worker_ = std::thread(&SpeculativeStepCompleter::work, this);
+  return true;
+}
+
+bool SpeculativeStepCompleter::isInitialized() const
+{
+  return worker_.joinable();
+}
+
+bool SpeculativeStepCompleter::speculate(const State& state, const StepQueue& queue, const double dt)
+{
+  if (!isInitialized()) return false;
+  if (!queue.active() || queue.size() < 2) return false;
+  const Step& currentStep = queue.getCurrentStep();
+  if (currentStep.getTime() + dt > currentStep.getTotalDuration()) return false; // Too late.
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (speculation_ && (isQueued_ || !speculation_->isDone)) return false; // Busy.
+  if (speculation_ && speculation_->sequenceNumber == queue.getNextStep().getSequenceNumber()) return false;
+
+  std::shared_ptr<Speculation> speculation(new Speculation());
+  speculation->stepId = queue.getNextStep().getId();
+  speculation->sequenceNumber = queue.getNextStep().getSequenceNumber();
+  speculation->previousStepId = currentStep.getId();
+  if (queue.size() > 2) speculation->nextStepId = queue.getQueue()[2].getId();
+  speculation->dt = dt;
+  speculation->state = state;
+  if (queue.previousStepExists()) speculation->previousStep.reset(new Step(queue.getPreviousStep()));
+  // The step after the next one is needed for completing the next step (see BaseAuto).
+  const size_t nSteps = std::min(queue.size(), size_t(3));
+  speculation->steps.assign(queue.getQueue().begin(), queue.getQueue().begin() + nSteps);
+  speculation->isDone = false;
+  speculation->isSuccessful = false;
+  speculation_ = speculation;
+  isQueued_ = true;
+  condition_.notify_one();
+  return true;
+}
+
+bool SpeculativeStepCompleter::hasSpeculation(const std::string& stepId) const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return speculation_ && speculation_->stepId == stepId;
+}
+
+bool SpeculativeStepCompleter::takeSpeculation(const State& state, const StepQueue& queue, Step& step)
+{
+  std::shared_ptr<Speculation> speculation;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!speculation_ || speculation_->stepId != step.getId()) return false;
+    speculation = speculation_;
+    speculation_.reset();
+    isQueued_ = false;
+  }
+  // The id does not identify the step, it can be reused by the user.
+  if (speculation->sequenceNumber != step.getSequenceNumber()) return false;
+  if (!speculation->isDone || !speculation->isSuccessful) return false;
+  if (!isValid(state, queue, *speculation)) return false;
+  step = speculation->step;
+  return true;
+}
+
+void SpeculativeStepCompleter::clear()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  speculation_.reset();
+  isQueued_ = false;
+}
+
+bool SpeculativeStepCompleter::waitUntilIdle(const double timeout) const
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  return idleCondition_.wait_for(lock, std::chrono::duration<double>(timeout),
+                                 [this] { return !isQueued_ && !isRunning_; });
+}
+
+void SpeculativeStepCompleter::setTolerance(const double tolerance)
+{
+  tolerance_ = tolerance;
+}
+
+double SpeculativeStepCompleter::getTolerance() const
+{
+  return tolerance_;
+}
+
+void SpeculativeStepCompleter::work()
+{
+  while (true) {
+    std::shared_ptr<Speculation> speculation;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this] { return isStopping_ || isQueued_; });
+      if (isStopping_) return;
+      speculation = speculation_;
+      isQueued_ = false;
+      isRunning_ = true;
+    }
+    speculation->isSuccessful = process(*speculation);
+    speculation->isDone = true;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      isRunning_ = false;
+    }
+    idleCondition_.notify_all();
+  }
+}
+
+bool SpeculativeStepCompleter::process(Speculation& speculation) const
+{
+  State state;
+  StepCompleter completer(parameters_, *adapterCopy_);
+  StepComputer computer;
+  Executor executor(completer, computer, *adapterCopy_, state);
+  executor.initialize();
+  executor.reset();
+  state = speculation.state;
+  adapterCopy_->setInternalDataFromState(state);
+
+  // Resume the current step without completing it again.
+  StepQueue& queue = executor.getQueue();
+  if (speculation.previousStep) queue.setPreviousStep(*speculation.previousStep);
+  queue.add(speculation.steps);
+  queue.advance(0.0);
+
+  // Execute the current step up to the last time step before the switch.
+  const Step& currentStep = queue.getCurrentStep();
+  double time = currentStep.getTime();
+  while (time + speculation.dt <= currentStep.getTotalDuration()) time += speculation.dt;
+  if (!executor.advance(time - currentStep.getTime(), true)) return false;
+  if (queue.getCurrentStep().getId() != speculation.steps.front().getId()) return false;
+
+  // Switch to and complete the next step as the executor would.
+  queue.skipCurrentStep();
+  adapterCopy_->setInternalDataFromState(state);
+  Step& step = queue.getCurrentStep();
+  if (!completer.complete(state, queue, step)) return false;
+  if (step.needsComputation() && !step.compute()) return false;
+  speculation.step = step;
+  speculation.state = state;
+  for (const auto& limb : adapterCopy_->getLimbs()) {
+    speculation.groundedLegs[getIndex(limb)] = adapterCopy_->isLegGrounded(limb);
+  }
+
+  // Foot positions are measured from the robot for the base motion completion.
+  speculation.footPositions.clear();
+  if (step.hasBaseMotion() && step.getBaseMotion().getType() == BaseMotionBase::Type::Auto) {
+    for (const auto& limb : adapterCopy_->getLimbs()) {
+      speculation.footPositions[limb] = adapterCopy_->getPositionWorldToFootInWorldFrame(limb);
+    }
+  }
+  return true;
+}
+
+bool SpeculativeStepCompleter::isValid(const State& state, const StepQueue& queue,
+                                       const Speculation& speculation) const
+{
+  // The completion depends on the previous and next step.
+  if (!queue.previousStepExists() || queue.getPreviousStep().getId() != speculation.previousStepId) return false;
+  if (queue.size() > 1) {
+    if (queue.getNextStep().getId() != speculation.nextStepId) return false;
+  } else if (!speculation.nextStepId.empty()) {
+    return false;
+  }
+
+  const State& predictedState = speculation.state;
+  const double positionError = Vector(state.getPositionWorldToBaseInWorldFrame()
+      - predictedState.getPositionWorldToBaseInWorldFrame()).norm();
+  if (positionError > tolerance_) return false;
+  const double orientationError = std::fabs(state.getOrientationBaseToWorld().getDisparityAngle(
+      predictedState.getOrientationBaseToWorld()));
+  if (orientationError > tolerance_) return false;
+  const double jointPositionError = (state.getJointPositions().vector()
+      - predictedState.getJointPositions().vector()).cwiseAbs().maxCoeff();
+  if (jointPositionError > tolerance_) return false;
+
+  if (state.getControlSetup(BranchEnum::BASE) != predictedState.getControlSetup(BranchEnum::BASE)) return false;
+  for (const auto& limb : adapter_.getLimbs()) {
+    if (state.isSupportLeg(limb) != predictedState.isSupportLeg(limb)) return false;
+    if (state.isIgnoreContact(limb) != predictedState.isIgnoreContact(limb)) return false;
+    if (state.getControlSetup(limb) != predictedState.getControlSetup(limb)) return false;
+    if (adapter_.isLegGrounded(limb) != speculation.groundedLegs[getIndex(limb)]) return false;
+  }
+
+  for (const auto& footPosition : speculation.footPositions) {
+    const double footPositionError = Vector(adapter_.getPositionWorldToFootInWorldFrame(footPosition.first)
+        - footPosition.second).norm();
+    if (footPositionError > tolerance_) return false;
+  }
+  return true;
+}
+
+} /* namespace free_gait */
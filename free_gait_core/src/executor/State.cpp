@@ -25,9 +25,9 @@ State::~State()
 void State::initialize(const std::vector<LimbEnum>& limbs, const std::vector<BranchEnum>& branches)
 {
   for (const auto& limb : limbs) {
-    isSupportLegs_[limb] = false;
-    ignoreContact_[limb] = false;
-    ignoreForPoseAdaptation_[limb] = false;
+    isSupportLegs_[getIndex(limb)] = false;
+    ignoreContact_[getIndex(limb)] = false;
+    ignoreForPoseAdaptation_[getIndex(limb)] = false;
   }
 
   for (const auto& branch : branches) {
@@ -55,63 +55,66 @@ void State::setStepId(const std::string& stepId)
   stepId_ = stepId;
 }
 
+void State::reserveStepId(const size_t length)
+{
+  stepId_.reserve(length);
+}
+
 bool State::isSupportLeg(const LimbEnum& limb) const
 {
-  return isSupportLegs_.at(limb);
+  return isSupportLegs_[getIndex(limb)];
 }
 
 void State::setSupportLeg(const LimbEnum& limb, bool isSupportLeg)
 {
-  isSupportLegs_[limb] = isSupportLeg;
+  isSupportLegs_[getIndex(limb)] = isSupportLeg;
 }
 
 unsigned int State::getNumberOfSupportLegs() const
 {
-  unsigned int nLegs = 0;
-  for (const auto& supportLeg : isSupportLegs_) {
-    if (supportLeg.second) ++nLegs;
-  }
-  return nLegs;
+  return static_cast<unsigned int>(isSupportLegs_.count());
 }
 
 bool State::isIgnoreContact(const LimbEnum& limb) const
 {
-  return ignoreContact_.at(limb);
+  return ignoreContact_[getIndex(limb)];
 }
 
 void State::setIgnoreContact(const LimbEnum& limb, bool ignoreContact)
 {
-  ignoreContact_[limb] = ignoreContact;
+  ignoreContact_[getIndex(limb)] = ignoreContact;
 }
 
 bool State::hasSurfaceNormal(const LimbEnum& limb) const
 {
-  return (surfaceNormals_.count(limb) > 0u);
+  return hasSurfaceNormals_[getIndex(limb)];
 }
 
 const Vector& State::getSurfaceNormal(const LimbEnum& limb) const
 {
-  return surfaceNormals_.at(limb);
+  if (!hasSurfaceNormal(limb)) throw std::out_of_range("State::getSurfaceNormal: No surface normal set for limb.");
+  return surfaceNormals_[getIndex(limb)];
 }
 
 void State::setSurfaceNormal(const LimbEnum& limb, const Vector& surfaceNormal)
 {
-  surfaceNormals_[limb] = surfaceNormal;
+  surfaceNormals_[getIndex(limb)] = surfaceNormal;
+  hasSurfaceNormals_[getIndex(limb)] = true;
 }
 
 void State::removeSurfaceNormal(const LimbEnum& limb)
 {
-  surfaceNormals_.erase(limb);
+  hasSurfaceNormals_[getIndex(limb)] = false;
 }
 
 bool State::isIgnoreForPoseAdaptation(const LimbEnum& limb) const
 {
-  return ignoreForPoseAdaptation_.at(limb);
+  return ignoreForPoseAdaptation_[getIndex(limb)];
 }
 
 void State::setIgnoreForPoseAdaptation(const LimbEnum& limb, bool ignorePoseAdaptation)
 {
-  ignoreForPoseAdaptation_[limb] = ignorePoseAdaptation;
+  ignoreForPoseAdaptation_[getIndex(limb)] = ignorePoseAdaptation;
 }
 
 const JointPositionsLeg State::getJointPositionsForLimb(const LimbEnum& limb) const
@@ -194,20 +197,17 @@ void State::setAllJointEfforts(const JointEfforts& jointEfforts)
 
 const ControlSetup& State::getControlSetup(const BranchEnum& branch) const
 {
-  return controlSetups_.at(branch);
+  return controlSetups_[getIndex(branch)];
 }
 
 const ControlSetup& State::getControlSetup(const LimbEnum& limb) const
 {
-  return controlSetups_.at(QD::mapEnums<QD::BranchEnum>(limb));
+  return getControlSetup(QD::mapEnums<QD::BranchEnum>(limb));
 }
 
 bool State::isControlSetupEmpty(const BranchEnum& branch) const
 {
-  for (const auto& level : controlSetups_.at(branch)) {
-    if (level.second) return false;
-  }
-  return true;
+  return controlSetups_[getIndex(branch)].none();
 }
 
 bool State::isControlSetupEmpty(const LimbEnum& limb) const
@@ -217,22 +217,17 @@ bool State::isControlSetupEmpty(const LimbEnum& limb) const
 
 void State::setControlSetup(const BranchEnum& branch, const ControlSetup& controlSetup)
 {
-  controlSetups_[branch] = controlSetup;
+  controlSetups_[getIndex(branch)] = controlSetup;
 }
 
 void State::setControlSetup(const LimbEnum& limb, const ControlSetup& controlSetup)
 {
-  controlSetups_[QD::mapEnums<QD::BranchEnum>(limb)] = controlSetup;
+  setControlSetup(QD::mapEnums<QD::BranchEnum>(limb), controlSetup);
 }
 
 void State::setEmptyControlSetup(const BranchEnum& branch)
 {
-  ControlSetup emptyControlSetup;
-  emptyControlSetup[ControlLevel::Position] = false;
-  emptyControlSetup[ControlLevel::Velocity] = false;
-  emptyControlSetup[ControlLevel::Acceleration] = false;
-  emptyControlSetup[ControlLevel::Effort] = false;
-  controlSetups_[branch] = emptyControlSetup;
+  controlSetups_[getIndex(branch)].clear();
 }
 
 void State::setEmptyControlSetup(const LimbEnum& limb)
@@ -252,18 +247,24 @@ void State::getAllJointNames(std::vector<std::string>& jointNames) const
 std::ostream& operator<<(std::ostream& out, const State& state)
 {
   out << static_cast<const quadruped_model::QuadrupedState&>(state) << std::endl;
-  out << "Support legs: " << state.isSupportLegs_ << std::endl;
-  out << "Ignore contact: " << state.ignoreContact_ << std::endl;
-  out << "Ignore for pose adaptation: " << state.ignoreForPoseAdaptation_ << std::endl;
+  out << "Support legs: ";
+  for (size_t i = 0; i < nLimbs; ++i) out << static_cast<LimbEnum>(i) << ": " << state.isSupportLegs_[i] << ", ";
+  out << std::endl;
+  out << "Ignore contact: ";
+  for (size_t i = 0; i < nLimbs; ++i) out << static_cast<LimbEnum>(i) << ": " << state.ignoreContact_[i] << ", ";
+  out << std::endl;
+  out << "Ignore for pose adaptation: ";
+  for (size_t i = 0; i < nLimbs; ++i) out << static_cast<LimbEnum>(i) << ": " << state.ignoreForPoseAdaptation_[i] << ", ";
+  out << std::endl;
   out << "Control setup:" << std::endl;
-  for (const auto& controlSetup : state.controlSetups_) {
-    out << controlSetup.first << ": ";
-    for (const auto& controlLevel : controlSetup.second) {
-      if (controlLevel.second) out << controlLevel.first << ", ";
-    }
-    out << std::endl;
+  for (size_t i = 0; i < nBranches; ++i) {
+    out << static_cast<BranchEnum>(i) << ": " << state.controlSetups_[i] << std::endl;
+  }
+  out << "Surface normals: ";
+  for (size_t i = 0; i < nLimbs; ++i) {
+    if (state.hasSurfaceNormals_[i]) out << static_cast<LimbEnum>(i) << ": " << state.surfaceNormals_[i] << ", ";
   }
-  out << "Surface normals: " << state.surfaceNormals_ << std::endl;
+  out << std::endl;
   if (!state.stepId_.empty()) out << "Step ID: " << state.stepId_ << std::endl;
   return out;
 }
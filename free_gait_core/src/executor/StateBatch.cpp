@@ -7,22 +7,51 @@
  */
 #include <free_gait_core/executor/StateBatch.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <functional>
 #include <stdexcept>
 
 namespace free_gait {
 
-StateBatch::StateBatch()
+namespace {
+
+//! Appends the entries with indices in [begin, end) of a column.
+template<typename Column>
+void appendRange(const Column& source, const size_t begin, const size_t end, Column& target)
 {
+  target.insert(target.end(), source.begin() + begin, source.begin() + end);
 }
 
-StateBatch::~StateBatch()
+//! Appends the entries with times in [startTime, endTime] of a time series, shifted by an offset.
+template<typename Value>
+void appendRange(const std::map<double, Value>& source, const double startTime, const double endTime,
+                 const double timeOffset, std::map<double, Value>& target)
+{
+  for (auto it = source.lower_bound(startTime); it != source.end() && it->first <= endTime; ++it) {
+    target.emplace_hint(target.end(), it->first + timeOffset, it->second);
+  }
+}
+
+template<typename Value>
+void appendRange(const std::vector<std::map<double, Value>>& source, const double startTime,
+                 const double endTime, const double timeOffset, std::vector<std::map<double, Value>>& target)
+{
+  if (target.size() < source.size()) target.resize(source.size());
+  for (size_t i = 0; i < source.size(); ++i) appendRange(source[i], startTime, endTime, timeOffset, target[i]);
+}
+
+}
+
+StateBatch::StateBatch()
+    : uniformTimeStep_(0.0),
+      isUniform_(true),
+      nDerivedStates_(0)
 {
 }
 
-const std::map<double, State>& StateBatch::getStates() const
+StateBatch::~StateBatch()
 {
-  return states_;
 }
 
 std::vector<std::map<double, Position>> StateBatch::getEndEffectorPositions() const
@@ -64,38 +93,324 @@ bool StateBatch::getEndTimeOfStep(std::string& stepId, double& endTime) const
 
 void StateBatch::addState(const double time, const State& state)
 {
-  states_[time] = state;
+  if (!times_.empty() && time < times_.back()) {
+    throw std::invalid_argument("State batch error: States have to be added in increasing time order.");
+  }
+  if (!times_.empty() && time == times_.back()) {
+    // Overwrite last state.
+    if (nDerivedStates_ == times_.size()) {
+      removeDerivedData(times_.back());
+      --nDerivedStates_;
+    }
+    times_.pop_back();
+    positionsWorldToBaseInWorldFrame_.pop_back();
+    orientationsBaseToWorld_.pop_back();
+    linearVelocitiesBaseInWorldFrame_.pop_back();
+    angularVelocitiesBaseInBaseFrame_.pop_back();
+    jointPositions_.pop_back();
+    jointVelocities_.pop_back();
+    jointAccelerations_.pop_back();
+    jointEfforts_.pop_back();
+    supportLegs_.pop_back();
+    ignoreContact_.pop_back();
+    ignoreForPoseAdaptation_.pop_back();
+    hasSurfaceNormals_.pop_back();
+    surfaceNormalVectors_.pop_back();
+    controlSetups_.pop_back();
+    robotExecutionStatus_.pop_back();
+    stepIdIndices_.pop_back();
+  }
+
+  updateTimeGrid(time);
+  times_.push_back(time);
+  positionsWorldToBaseInWorldFrame_.push_back(state.getPositionWorldToBaseInWorldFrame());
+  orientationsBaseToWorld_.push_back(state.getOrientationBaseToWorld());
+  linearVelocitiesBaseInWorldFrame_.push_back(state.getLinearVelocityBaseInWorldFrame());
+  angularVelocitiesBaseInBaseFrame_.push_back(state.getAngularVelocityBaseInBaseFrame());
+  jointPositions_.push_back(state.getJointPositions());
+  jointVelocities_.push_back(state.getJointVelocities());
+  jointAccelerations_.push_back(state.getAllJointAccelerations());
+  jointEfforts_.push_back(state.getAllJointEfforts());
+
+  std::bitset<nLimbs> supportLegs, ignoreContact, ignoreForPoseAdaptation, hasSurfaceNormals;
+  std::array<Vector, nLimbs> surfaceNormals;
+  for (size_t i = 0; i < nLimbs; ++i) {
+    const LimbEnum limb = static_cast<LimbEnum>(i);
+    supportLegs[i] = state.isSupportLeg(limb);
+    ignoreContact[i] = state.isIgnoreContact(limb);
+    ignoreForPoseAdaptation[i] = state.isIgnoreForPoseAdaptation(limb);
+    hasSurfaceNormals[i] = state.hasSurfaceNormal(limb);
+    if (hasSurfaceNormals[i]) surfaceNormals[i] = state.getSurfaceNormal(limb);
+  }
+  supportLegs_.push_back(supportLegs);
+  ignoreContact_.push_back(ignoreContact);
+  ignoreForPoseAdaptation_.push_back(ignoreForPoseAdaptation);
+  hasSurfaceNormals_.push_back(hasSurfaceNormals);
+  surfaceNormalVectors_.push_back(surfaceNormals);
+
+  std::array<ControlSetup, nBranches> controlSetups;
+  for (size_t i = 0; i < nBranches; ++i) {
+    controlSetups[i] = state.getControlSetup(static_cast<BranchEnum>(i));
+  }
+  controlSetups_.push_back(controlSetups);
+  robotExecutionStatus_.push_back(state.getRobotExecutionStatus());
+
+  // Step ids change rarely, only store them when they change.
+  if (stepIdTable_.empty() || stepIdTable_.back() != state.getStepId()) {
+    stepIdTable_.push_back(state.getStepId());
+  }
+  stepIdIndices_.push_back(stepIdTable_.size() - 1);
+}
+
+void StateBatch::append(const StateBatch& other, const double timeOffset)
+{
+  append(other, 0, other.size(), timeOffset);
+}
+
+void StateBatch::append(const StateBatch& other, const size_t begin, const size_t end, const double timeOffset)
+{
+  if (end > other.size() || begin > end) throw std::out_of_range("State batch error: Invalid range of states to append.");
+  if (begin == end) return;
+  if (!times_.empty() && other.times_[begin] + timeOffset <= times_.back()) {
+    throw std::invalid_argument("State batch error: Appended states have to start after the end of the batch.");
+  }
+  appendDerivedData(other, begin, end, timeOffset);
+
+  for (size_t k = begin; k < end; ++k) {
+    updateTimeGrid(other.times_[k] + timeOffset);
+    times_.push_back(other.times_[k] + timeOffset);
+  }
+  appendRange(other.positionsWorldToBaseInWorldFrame_, begin, end, positionsWorldToBaseInWorldFrame_);
+  appendRange(other.orientationsBaseToWorld_, begin, end, orientationsBaseToWorld_);
+  appendRange(other.linearVelocitiesBaseInWorldFrame_, begin, end, linearVelocitiesBaseInWorldFrame_);
+  appendRange(other.angularVelocitiesBaseInBaseFrame_, begin, end, angularVelocitiesBaseInBaseFrame_);
+  appendRange(other.jointPositions_, begin, end, jointPositions_);
+  appendRange(other.jointVelocities_, begin, end, jointVelocities_);
+  appendRange(other.jointAccelerations_, begin, end, jointAccelerations_);
+  appendRange(other.jointEfforts_, begin, end, jointEfforts_);
+  appendRange(other.supportLegs_, begin, end, supportLegs_);
+  appendRange(other.ignoreContact_, begin, end, ignoreContact_);
+  appendRange(other.ignoreForPoseAdaptation_, begin, end, ignoreForPoseAdaptation_);
+  appendRange(other.hasSurfaceNormals_, begin, end, hasSurfaceNormals_);
+  appendRange(other.surfaceNormalVectors_, begin, end, surfaceNormalVectors_);
+  appendRange(other.controlSetups_, begin, end, controlSetups_);
+  appendRange(other.robotExecutionStatus_, begin, end, robotExecutionStatus_);
+
+  // Merge step id tables, continuing the last step id if it is the same.
+  const size_t firstTableIndex = other.stepIdIndices_[begin];
+  const size_t lastTableIndex = other.stepIdIndices_[end - 1];
+  size_t indexOffset = stepIdTable_.size();
+  auto otherTableBegin = other.stepIdTable_.begin() + firstTableIndex;
+  if (!stepIdTable_.empty() && stepIdTable_.back() == *otherTableBegin) {
+    --indexOffset;
+    ++otherTableBegin;
+  }
+  stepIdTable_.insert(stepIdTable_.end(), otherTableBegin, other.stepIdTable_.begin() + lastTableIndex + 1);
+  for (size_t k = begin; k < end; ++k) {
+    stepIdIndices_.push_back(other.stepIdIndices_[k] - firstTableIndex + indexOffset);
+  }
+}
+
+void StateBatch::appendDerivedData(const StateBatch& other, const size_t begin, const size_t end,
+                                   const double timeOffset)
+{
+  // Derived data of the other batch is only valid if computed for the range,
+  // and can only be continued if computed for all states of this batch.
+  if (end > other.nDerivedStates_ || nDerivedStates_ != size()) return;
+  const double startTime = other.times_[begin];
+  const double endTime = other.times_[end - 1];
+  appendRange(other.endEffectorPositions_, startTime, endTime, timeOffset, endEffectorPositions_);
+  appendRange(other.endEffectorTargets_, startTime, endTime, timeOffset, endEffectorTargets_);
+  appendRange(other.surfaceNormals_, startTime, endTime, timeOffset, surfaceNormals_);
+  appendRange(other.stances_, startTime, endTime, timeOffset, stances_);
+  appendRange(other.stepIds_, startTime, endTime, timeOffset, stepIds_);
+  nDerivedStates_ += end - begin;
+}
+
+void StateBatch::reserve(const size_t nStates)
+{
+  times_.reserve(nStates);
+  positionsWorldToBaseInWorldFrame_.reserve(nStates);
+  orientationsBaseToWorld_.reserve(nStates);
+  linearVelocitiesBaseInWorldFrame_.reserve(nStates);
+  angularVelocitiesBaseInBaseFrame_.reserve(nStates);
+  jointPositions_.reserve(nStates);
+  jointVelocities_.reserve(nStates);
+  jointAccelerations_.reserve(nStates);
+  jointEfforts_.reserve(nStates);
+  supportLegs_.reserve(nStates);
+  ignoreContact_.reserve(nStates);
+  ignoreForPoseAdaptation_.reserve(nStates);
+  hasSurfaceNormals_.reserve(nStates);
+  surfaceNormalVectors_.reserve(nStates);
+  controlSetups_.reserve(nStates);
+  robotExecutionStatus_.reserve(nStates);
+  stepIdIndices_.reserve(nStates);
+}
+
+size_t StateBatch::size() const
+{
+  return times_.size();
+}
+
+bool StateBatch::empty() const
+{
+  return times_.empty();
 }
 
 bool StateBatch::isValidTime(const double time) const
 {
-  if (states_.empty()) return false;
-  if (time < states_.begin()->first) return false;
+  if (times_.empty()) return false;
+  if (time < times_.front()) return false;
   return true;
 }
 
 double free_gait::StateBatch::getStartTime() const
 {
-  if (states_.empty()) throw std::out_of_range("State batch error: Batch is empty.");
-  return states_.begin()->first;
+  if (times_.empty()) throw std::out_of_range("State batch error: Batch is empty.");
+  return times_.front();
 }
 
 double free_gait::StateBatch::getEndTime() const
 {
-  if (states_.empty()) throw std::out_of_range("State batch error: Batch is empty.");
-  return (--states_.end())->first;
+  if (times_.empty()) throw std::out_of_range("State batch error: Batch is empty.");
+  return times_.back();
 }
 
-const State& StateBatch::getState(const double time) const
+size_t StateBatch::getIndex(const double time) const
 {
   if (!isValidTime(time)) throw std::out_of_range("State batch error: No state available for requested time.");
-  if (time > (--states_.end())->first) return (--states_.end())->second;
-  return states_.lower_bound(time)->second;
+  const size_t lastIndex = times_.size() - 1;
+  if (time >= times_.back()) return lastIndex;
+
+  if (!isUniform_ || times_.size() < 2) {
+    return std::lower_bound(times_.begin(), times_.end(), time) - times_.begin();
+  }
+
+  // Uniform grid, guess index and correct for accumulated rounding errors.
+  size_t index = static_cast<size_t>(std::ceil((time - times_.front()) / uniformTimeStep_));
+  if (index > lastIndex) index = lastIndex;
+  while (index < lastIndex && times_[index] < time) ++index;
+  while (index > 0 && times_[index - 1] >= time) --index;
+  return index;
+}
+
+State StateBatch::getState(const double time) const
+{
+  State state;
+  getStateAtIndex(getIndex(time), state);
+  return state;
+}
+
+void StateBatch::getStateAtIndex(const size_t index, State& state) const
+{
+  if (index >= times_.size()) throw std::out_of_range("State batch error: State index out of range.");
+  state.setPositionWorldToBaseInWorldFrame(positionsWorldToBaseInWorldFrame_[index]);
+  state.setOrientationBaseToWorld(orientationsBaseToWorld_[index]);
+  state.setLinearVelocityBaseInWorldFrame(linearVelocitiesBaseInWorldFrame_[index]);
+  state.setAngularVelocityBaseInBaseFrame(angularVelocitiesBaseInBaseFrame_[index]);
+  state.setAllJointPositions(jointPositions_[index]);
+  state.setAllJointVelocities(jointVelocities_[index]);
+  state.setAllJointAccelerations(jointAccelerations_[index]);
+  state.setAllJointEfforts(jointEfforts_[index]);
+
+  for (size_t i = 0; i < nLimbs; ++i) {
+    const LimbEnum limb = static_cast<LimbEnum>(i);
+    state.setSupportLeg(limb, supportLegs_[index][i]);
+    state.setIgnoreContact(limb, ignoreContact_[index][i]);
+    state.setIgnoreForPoseAdaptation(limb, ignoreForPoseAdaptation_[index][i]);
+    if (hasSurfaceNormals_[index][i]) {
+      state.setSurfaceNormal(limb, surfaceNormalVectors_[index][i]);
+    } else {
+      state.removeSurfaceNormal(limb);
+    }
+  }
+
+  for (size_t i = 0; i < nBranches; ++i) {
+    state.setControlSetup(static_cast<BranchEnum>(i), controlSetups_[index][i]);
+  }
+  state.setRobotExecutionStatus(robotExecutionStatus_[index]);
+  state.setStepId(stepIdTable_[stepIdIndices_[index]]);
+}
+
+const std::vector<double>& StateBatch::getTimes() const
+{
+  return times_;
+}
+
+const StateBatch::AlignedVector<Position>& StateBatch::getPositionsWorldToBaseInWorldFrame() const
+{
+  return positionsWorldToBaseInWorldFrame_;
+}
+
+const StateBatch::AlignedVector<RotationQuaternion>& StateBatch::getOrientationsBaseToWorld() const
+{
+  return orientationsBaseToWorld_;
+}
+
+const StateBatch::AlignedVector<JointPositions>& StateBatch::getJointPositions() const
+{
+  return jointPositions_;
+}
+
+const std::vector<std::bitset<nLimbs>>& StateBatch::getSupportLegs() const
+{
+  return supportLegs_;
+}
+
+const std::string& StateBatch::getStepIdAtIndex(const size_t index) const
+{
+  return stepIdTable_.at(stepIdIndices_.at(index));
+}
+
+void StateBatch::updateTimeGrid(const double time)
+{
+  // Keep track whether the time grid is uniform.
+  if (times_.size() == 1) {
+    uniformTimeStep_ = time - times_.front();
+    isUniform_ = uniformTimeStep_ > 0.0;
+  } else if (times_.size() > 1 && isUniform_) {
+    isUniform_ = std::abs((time - times_.back()) - uniformTimeStep_) <= 1e-6 * uniformTimeStep_;
+  }
+}
+
+void StateBatch::removeDerivedData(const double time)
+{
+  for (auto& positions : endEffectorPositions_) positions.erase(time);
+  for (auto& targets : endEffectorTargets_) targets.erase(time);
+  for (auto& surfaceNormals : surfaceNormals_) surfaceNormals.erase(time);
+  stances_.erase(time);
+  stepIds_.erase(time);
 }
 
 void StateBatch::clear()
 {
-  states_.clear();
+  times_.clear();
+  positionsWorldToBaseInWorldFrame_.clear();
+  orientationsBaseToWorld_.clear();
+  linearVelocitiesBaseInWorldFrame_.clear();
+  angularVelocitiesBaseInBaseFrame_.clear();
+  jointPositions_.clear();
+  jointVelocities_.clear();
+  jointAccelerations_.clear();
+  jointEfforts_.clear();
+  supportLegs_.clear();
+  ignoreContact_.clear();
+  ignoreForPoseAdaptation_.clear();
+  hasSurfaceNormals_.clear();
+  surfaceNormalVectors_.clear();
+  controlSetups_.clear();
+  robotExecutionStatus_.clear();
+  stepIdIndices_.clear();
+  stepIdTable_.clear();
+  uniformTimeStep_ = 0.0;
+  isUniform_ = true;
+  endEffectorPositions_.clear();
+  endEffectorTargets_.clear();
+  surfaceNormals_.clear();
+  stances_.clear();
+  stepIds_.clear();
+  nDerivedStates_ = 0;
 }
 
 } /* namespace free_gait */
@@ -7,6 +7,9 @@
  */
 #include <free_gait_core/executor/StateBatchComputer.hpp>
 
+#include <iterator>
+#include <tuple>
+
 namespace free_gait {
 
 StateBatchComputer::StateBatchComputer(AdapterBase& adapter) :
@@ -18,45 +21,99 @@ StateBatchComputer::~StateBatchComputer()
 {
 }
 
+void StateBatchComputer::compute(StateBatch& stateBatch)
+{
+  stateBatch.nDerivedStates_ = 0;
+  update(stateBatch);
+}
+
+void StateBatchComputer::update(StateBatch& stateBatch)
+{
+  const size_t nLimbsInAdapter = adapter_.getLimbs().size();
+  if (stateBatch.nDerivedStates_ == 0) {
+    stateBatch.endEffectorPositions_.assign(nLimbsInAdapter, std::map<double, Position>());
+    stateBatch.endEffectorTargets_.assign(nLimbsInAdapter, std::map<double, Position>());
+    stateBatch.surfaceNormals_.assign(nLimbsInAdapter, std::map<double, std::tuple<Position, Vector>>());
+    stateBatch.stances_.clear();
+    stateBatch.stepIds_.clear();
+  }
+
+  for (size_t k = stateBatch.nDerivedStates_; k < stateBatch.size(); ++k) {
+    stateBatch.getStateAtIndex(k, state_);
+    adapter_.setInternalDataFromState(state_);
+    const double time = stateBatch.times_[k];
+    const std::bitset<nLimbs>& supportLegs = stateBatch.supportLegs_[k];
+
+    // Surface normals at start and at touchdown, new stance at start and
+    // whenever the support legs change.
+    const bool isStart = k == 0;
+    const std::bitset<nLimbs> touchdowns = isStart ? std::bitset<nLimbs>() : ~stateBatch.supportLegs_[k - 1] & supportLegs;
+    const bool isNewStance = isStart || stateBatch.supportLegs_[k - 1] != supportLegs;
+    Stance stance;
+
+    size_t i = 0;
+    for (const auto& limb : adapter_.getLimbs()) {
+      const size_t limbIndex = getIndex(limb);
+      const Position position = adapter_.getPositionWorldToFootInWorldFrame(limb);
+      auto& positions = stateBatch.endEffectorPositions_[i];
+      positions.emplace_hint(positions.end(), time, position);
+      if (touchdowns[limbIndex]) stateBatch.endEffectorTargets_[i][time] = position;
+      if ((isStart || touchdowns[limbIndex]) && stateBatch.hasSurfaceNormals_[k][limbIndex]) {
+        stateBatch.surfaceNormals_[i][time] = std::make_tuple(position, stateBatch.surfaceNormalVectors_[k][limbIndex]);
+      }
+      if (isNewStance && supportLegs[limbIndex]) stance[limb] = position;
+      i++;
+    }
+
+    if (isNewStance) stateBatch.stances_[time] = stance;
+    updateStepIds(stateBatch, k);
+  }
+  stateBatch.nDerivedStates_ = stateBatch.size();
+}
+
 void StateBatchComputer::computeEndEffectorTargetsAndSurfaceNormals(StateBatch& stateBatch)
 {
   stateBatch.endEffectorTargets_.clear();
   stateBatch.endEffectorTargets_.resize(adapter_.getLimbs().size());
   stateBatch.surfaceNormals_.clear();
   stateBatch.surfaceNormals_.resize(adapter_.getLimbs().size());
+  if (stateBatch.empty()) return;
 
   // Surface normal at start.
+  State state;
+  stateBatch.getStateAtIndex(0, state);
+  adapter_.setInternalDataFromState(state);
+  const double startTime = stateBatch.times_.front();
   size_t i = 0;
   for (const auto& limb : adapter_.getLimbs()) {
-    const double time = stateBatch.getStates().begin()->first;
-    const State& state = stateBatch.getStates().begin()->second;
-    if (state.hasSurfaceNormal(limb)) {
-      adapter_.setInternalDataFromState(state);
+    if (stateBatch.hasSurfaceNormals_.front()[getIndex(limb)]) {
       const Position position = adapter_.getPositionWorldToFootInWorldFrame(limb);
-      std::get<0>(stateBatch.surfaceNormals_[i][time]) = position;
-      std::get<1>(stateBatch.surfaceNormals_[i][time]) = state.getSurfaceNormal(limb);
+      std::get<0>(stateBatch.surfaceNormals_[i][startTime]) = position;
+      std::get<1>(stateBatch.surfaceNormals_[i][startTime]) = stateBatch.surfaceNormalVectors_.front()[getIndex(limb)];
     }
     i++;
   }
 
-  // Iterate trough states.
-  i = 0;
-  for (const auto& limb : adapter_.getLimbs()) {
-    const State* previousState = &(stateBatch.getStates().begin()->second);
-    for (const auto& state : stateBatch.getStates()) {
-      if (!previousState->isSupportLeg(limb) && state.second.isSupportLeg(limb)) {
-        // Switching to support leg.
-        adapter_.setInternalDataFromState(state.second);
+  // Iterate through the support flags, only reconstruct states at touchdown.
+  for (size_t k = 1; k < stateBatch.size(); ++k) {
+    const std::bitset<nLimbs> touchdowns = ~stateBatch.supportLegs_[k - 1] & stateBatch.supportLegs_[k];
+    if (touchdowns.none()) continue;
+    const double time = stateBatch.times_[k];
+    stateBatch.getStateAtIndex(k, state);
+    adapter_.setInternalDataFromState(state);
+    i = 0;
+    for (const auto& limb : adapter_.getLimbs()) {
+      const size_t limbIndex = getIndex(limb);
+      if (touchdowns[limbIndex]) {
         const Position position = adapter_.getPositionWorldToFootInWorldFrame(limb);
-        stateBatch.endEffectorTargets_[i][state.first] = position;
-        if (state.second.hasSurfaceNormal(limb)) {
-          std::get<0>(stateBatch.surfaceNormals_[i][state.first]) = position;
-          std::get<1>(stateBatch.surfaceNormals_[i][state.first]) = state.second.getSurfaceNormal(limb);
+        stateBatch.endEffectorTargets_[i][time] = position;
+        if (stateBatch.hasSurfaceNormals_[k][limbIndex]) {
+          std::get<0>(stateBatch.surfaceNormals_[i][time]) = position;
+          std::get<1>(stateBatch.surfaceNormals_[i][time]) = stateBatch.surfaceNormalVectors_[k][limbIndex];
         }
       }
-      previousState = &state.second;
+      i++;
     }
-    i++;
   }
 }
 
@@ -64,12 +121,15 @@ void StateBatchComputer::computeEndEffectorTrajectories(StateBatch& stateBatch)
 {
   stateBatch.endEffectorPositions_.clear();
   stateBatch.endEffectorPositions_.resize(adapter_.getLimbs().size());
-  for (const auto& state : stateBatch.getStates()) {
-    adapter_.setInternalDataFromState(state.second);
+  State state;
+  for (size_t k = 0; k < stateBatch.size(); ++k) {
+    stateBatch.getStateAtIndex(k, state);
+    adapter_.setInternalDataFromState(state);
+    const double time = stateBatch.times_[k];
     size_t i = 0;
     for (const auto& limb : adapter_.getLimbs()) {
-      const Position position = adapter_.getPositionWorldToFootInWorldFrame(limb);
-      stateBatch.endEffectorPositions_[i++][state.first] = position;
+      auto& positions = stateBatch.endEffectorPositions_[i++];
+      positions.emplace_hint(positions.end(), time, adapter_.getPositionWorldToFootInWorldFrame(limb));
     }
   }
 }
@@ -77,51 +137,38 @@ void StateBatchComputer::computeEndEffectorTrajectories(StateBatch& stateBatch)
 void StateBatchComputer::computeStances(StateBatch& stateBatch)
 {
   stateBatch.stances_.clear();
+  if (stateBatch.empty()) return;
 
-  // Add first stance.
-  const auto firstState = stateBatch.getStates().begin();
-  adapter_.setInternalDataFromState(firstState->second);
-  Stance stance;
-  for (const auto& limb : adapter_.getLimbs()) {
-    if (!firstState->second.isSupportLeg(limb)) continue;
-    stance[limb] = adapter_.getPositionWorldToFootInWorldFrame(limb);
-  }
-  stateBatch.stances_[firstState->first] = stance;
-
-  // Other stances.
-  const State* previousState = &(firstState->second);
-  for (const auto& state : stateBatch.getStates()) {
+  // New stance at start and whenever the support legs change.
+  State state;
+  for (size_t k = 0; k < stateBatch.size(); ++k) {
+    if (k > 0 && stateBatch.supportLegs_[k - 1] == stateBatch.supportLegs_[k]) continue;
+    stateBatch.getStateAtIndex(k, state);
+    adapter_.setInternalDataFromState(state);
+    Stance stance;
     for (const auto& limb : adapter_.getLimbs()) {
-      if (previousState->isSupportLeg(limb) != state.second.isSupportLeg(limb)) {
-        // New stance.
-        adapter_.setInternalDataFromState(state.second);
-        Stance stance;
-        for (const auto& limb : adapter_.getLimbs()) {
-          if (!state.second.isSupportLeg(limb)) continue;
-          stance[limb] = adapter_.getPositionWorldToFootInWorldFrame(limb);
-        }
-        stateBatch.stances_[state.first] = stance;
-      }
+      if (!stateBatch.supportLegs_[k][getIndex(limb)]) continue;
+      stance[limb] = adapter_.getPositionWorldToFootInWorldFrame(limb);
     }
-    previousState = &state.second;
+    stateBatch.stances_[stateBatch.times_[k]] = stance;
   }
 }
 
 void StateBatchComputer::computeStepIds(StateBatch& stateBatch)
 {
   stateBatch.stepIds_.clear();
-  for (const auto& state : stateBatch.getStates()) {
-    const std::string& stepId(state.second.getStepId());
-    if (stepId.empty()) continue;
-    if (stateBatch.stepIds_.size() == 0) {
-      stateBatch.stepIds_[state.first] = stepId;
-      continue;
-    }
-    if (std::prev(stateBatch.stepIds_.end())->second != stepId) {
-      stateBatch.stepIds_[state.first] = stepId;
-      continue;
-    }
-  }
+  for (size_t k = 0; k < stateBatch.size(); ++k) updateStepIds(stateBatch, k);
+}
+
+void StateBatchComputer::updateStepIds(StateBatch& stateBatch, const size_t index) const
+{
+  // Step ids are stored per change, compare indices only.
+  const auto& stepIdIndices = stateBatch.stepIdIndices_;
+  if (index > 0 && stepIdIndices[index - 1] == stepIdIndices[index]) return;
+  const std::string& stepId = stateBatch.stepIdTable_[stepIdIndices[index]];
+  if (stepId.empty()) return;
+  if (!stateBatch.stepIds_.empty() && std::prev(stateBatch.stepIds_.end())->second == stepId) return;
+  stateBatch.stepIds_[stateBatch.times_[index]] = stepId;
 }
 
 } /* namespace free_gait */
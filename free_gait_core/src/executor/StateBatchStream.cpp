@@ -0,0 +1,82 @@
+/*
+ * StateBatchStream.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#include "free_gait_core/executor/StateBatchStream.hpp"
+
+// STD
+#include <chrono>
+#include <stdexcept>
+
+namespace free_gait {
+
+StateBatchStream::StateBatchStream()
+    : isClosed_(false),
+      isComplete_(false)
+{
+}
+
+StateBatchStream::~StateBatchStream()
+{
+}
+
+void StateBatchStream::push(const Chunk& chunk)
+{
+  if (!chunk || chunk->empty()) return;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (isClosed_) throw std::runtime_error("State batch stream error: Cannot add chunks to closed stream.");
+    if (!chunks_.empty() && chunk->getStartTime() <= chunks_.back()->getEndTime()) {
+      throw std::invalid_argument("State batch stream error: Chunks have to be added in increasing time order.");
+    }
+    chunks_.push_back(chunk);
+  }
+  condition_.notify_all();
+}
+
+void StateBatchStream::close(const bool success)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    isClosed_ = true;
+    isComplete_ = success;
+  }
+  condition_.notify_all();
+}
+
+bool StateBatchStream::isClosed() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return isClosed_;
+}
+
+bool StateBatchStream::isComplete() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return isClosed_ && isComplete_;
+}
+
+size_t StateBatchStream::getNumberOfChunks() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return chunks_.size();
+}
+
+std::vector<StateBatchStream::Chunk> StateBatchStream::getChunks(const size_t firstChunk) const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (firstChunk >= chunks_.size()) return std::vector<Chunk>();
+  return std::vector<Chunk>(chunks_.begin() + firstChunk, chunks_.end());
+}
+
+bool StateBatchStream::waitForChunks(const size_t nChunks, const double timeout) const
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  return condition_.wait_for(lock, std::chrono::duration<double>(timeout),
+                             [&]() {return isClosed_ || chunks_.size() > nChunks;});
+}
+
+} /* namespace free_gait */
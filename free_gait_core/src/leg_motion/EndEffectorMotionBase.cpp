@@ -63,6 +63,14 @@ const Force EndEffectorMotionBase::evaluateForce(const double time) const
   throw std::runtime_error("EndEffectorMotionBase::evaluateForce() not implemented.");
 }
 
+void EndEffectorMotionBase::evaluate(const double time, Position& position, LinearVelocity& velocity,
+                                     LinearAcceleration& acceleration) const
+{
+  position = evaluatePosition(time);
+  velocity = evaluateVelocity(time);
+  acceleration = evaluateAcceleration(time);
+}
+
 const Position EndEffectorMotionBase::getTargetPosition() const
 {
   throw std::runtime_error("EndEffectorMotionBase::getTargetPosition() not implemented.");
@@ -75,7 +83,12 @@ const LinearVelocity EndEffectorMotionBase::getTargetVelocity() const
 
 const std::string& EndEffectorMotionBase::getFrameId(const ControlLevel& controlLevel) const
 {
-  throw std::runtime_error("EndEffectorMotionBase::getFrameId() not implemented.");
+  return FrameRegistry::getInstance().getName(getFrameHandle(controlLevel));
+}
+
+FrameId EndEffectorMotionBase::getFrameHandle(const ControlLevel& controlLevel) const
+{
+  throw std::runtime_error("EndEffectorMotionBase::getFrameHandle() not implemented.");
 }
 
 } /* namespace */
@@ -37,7 +37,7 @@ std::unique_ptr<LegMotionBase> EndEffectorTarget::clone() const
   return pointer;
 }
 
-const ControlSetup EndEffectorTarget::getControlSetup() const
+const ControlSetup& EndEffectorTarget::getControlSetup() const
 {
   return controlSetup_;
 }
@@ -75,34 +75,46 @@ void EndEffectorTarget::reset()
   startPosition_.setZero();
   startVelocity_.setZero();
   trajectory_.clear();
+  spline_.clear();
   duration_ = 0.0;
   isComputed_ = false;
 }
 
 const Position EndEffectorTarget::evaluatePosition(const double time) const
 {
-  const double timeInRange = mapTimeWithinDuration(time);
   Position position;
-  trajectory_.evaluate(position.toImplementation(), timeInRange);
+  LinearVelocity velocity;
+  LinearAcceleration acceleration;
+  evaluate(time, position, velocity, acceleration);
   return position;
 }
 
 const LinearVelocity EndEffectorTarget::evaluateVelocity(const double time) const
 {
-  const double timeInRange = mapTimeWithinDuration(time);
+  Position position;
   LinearVelocity velocity;
-  trajectory_.evaluateDerivative(velocity.toImplementation(), timeInRange, 1);
+  LinearAcceleration acceleration;
+  evaluate(time, position, velocity, acceleration);
   return velocity;
 }
 
 const LinearAcceleration EndEffectorTarget::evaluateAcceleration(const double time) const
 {
-  const double timeInRange = mapTimeWithinDuration(time);
+  Position position;
+  LinearVelocity velocity;
   LinearAcceleration acceleration;
-  trajectory_.evaluateDerivative(acceleration.toImplementation(), timeInRange, 2);
+  evaluate(time, position, velocity, acceleration);
   return acceleration;
 }
 
+void EndEffectorTarget::evaluate(const double time, Position& position, LinearVelocity& velocity,
+                                 LinearAcceleration& acceleration) const
+{
+  const double timeInRange = mapTimeWithinDuration(time);
+  spline_.evaluate(timeInRange, position.toImplementation(), velocity.toImplementation(),
+                   acceleration.toImplementation());
+}
+
 double EndEffectorTarget::getDuration() const
 {
   return duration_;
@@ -111,14 +123,14 @@ double EndEffectorTarget::getDuration() const
 void EndEffectorTarget::setTargetPosition(const std::string& frameId, const Position& targetPosition)
 {
   controlSetup_[ControlLevel::Position] = true;
-  frameIds_[ControlLevel::Position] = frameId;
+  frameIds_[ControlLevel::Position] = FrameRegistry::getInstance().internOrThrow(frameId);
   targetPosition_ =  targetPosition;
 }
 
 void EndEffectorTarget::setTargetVelocity(const std::string& frameId, const LinearVelocity& targetVelocity)
 {
   controlSetup_[ControlLevel::Velocity] = true;
-  frameIds_[ControlLevel::Velocity] = frameId;
+  frameIds_[ControlLevel::Velocity] = FrameRegistry::getInstance().internOrThrow(frameId);
   targetVelocity_ = targetVelocity;
 }
 
@@ -132,9 +144,9 @@ const LinearVelocity EndEffectorTarget::getTargetVelocity() const
   return targetVelocity_;
 }
 
-const std::string& EndEffectorTarget::getFrameId(const ControlLevel& controlLevel) const
+FrameId EndEffectorTarget::getFrameHandle(const ControlLevel& controlLevel) const
 {
-  return frameIds_.at(controlLevel);
+  return frameIds_[controlLevel];
 }
 
 bool EndEffectorTarget::isIgnoreContact() const
@@ -179,6 +191,7 @@ bool EndEffectorTarget::computeTrajectory()
   }
 
   trajectory_.fitCurveWithDerivatives(times, values, startVelocity_.vector(), targetVelocity_.vector());
+  spline_.setKnotsFromCubicCurve(trajectory_, times);
   return true;
 }
 
@@ -18,7 +18,9 @@ EndEffectorTrajectory::EndEffectorTrajectory(LimbEnum limb)
       ignoreForPoseAdaptation_(false),
       isComputed_(false),
       controlSetup_ { {ControlLevel::Position, false}, {ControlLevel::Velocity, false},
-                      {ControlLevel::Acceleration, false}, {ControlLevel::Effort, false} }
+                      {ControlLevel::Acceleration, false}, {ControlLevel::Effort, false} },
+      samplingTimeStep_(0.0),
+      samplingInterpolation_(SampleInterpolation::Cubic)
 {
 }
 
@@ -37,7 +39,8 @@ void EndEffectorTrajectory::setTrajectory(
     const std::vector<Time>& times,
     const std::unordered_map<ControlLevel, std::vector<ValueType>, EnumClassHash>& values)
 {
-  frameIds_ = frameIds;
+  frameIds_ = ControlLevelFrameIds();
+  for (const auto& frameId : frameIds) frameIds_[frameId.first] = FrameRegistry::getInstance().internOrThrow(frameId.second);
   times_ = times;
   values_ = values;
   for (const auto& value : values) controlSetup_[value.first] = true;
@@ -45,7 +48,7 @@ void EndEffectorTrajectory::setTrajectory(
 
 void EndEffectorTrajectory::setFrameId(const ControlLevel& controlLevel, const std::string& frameId)
 {
-  frameIds_[controlLevel] = frameId;
+  frameIds_[controlLevel] = FrameRegistry::getInstance().internOrThrow(frameId);
 }
 
 bool EndEffectorTrajectory::addPositionTrajectoryPoint(const Time& time, const Position& position)
@@ -56,7 +59,7 @@ bool EndEffectorTrajectory::addPositionTrajectoryPoint(const Time& time, const P
   return true;
 }
 
-const ControlSetup EndEffectorTrajectory::getControlSetup() const
+const ControlSetup& EndEffectorTrajectory::getControlSetup() const
 {
   return controlSetup_;
 }
@@ -105,6 +108,8 @@ bool EndEffectorTrajectory::prepareComputation(const State& state, const Step& s
                                         values_.at(ControlLevel::Velocity).front(),
                                         values_.at(ControlLevel::Velocity).back());
   } // TODO Extend the options here.
+  if (controlSetup_[ControlLevel::Position]) spline_.setKnotsFromCubicCurve(trajectory_, times_);
+  sampleTrajectory();
 
   // Curves implementation provides velocities and accelerations.
   if (controlSetup_[ControlLevel::Position]) {
@@ -131,47 +136,88 @@ bool EndEffectorTrajectory::isComputed() const
 void EndEffectorTrajectory::reset()
 {
   trajectory_.clear();
+  spline_.clear();
+  samples_.clear();
   duration_ = 0.0;
   isComputed_ = false;
 }
 
 const Position EndEffectorTrajectory::evaluatePosition(const double time) const
 {
-  const double timeInRange = mapTimeWithinDuration(time);
   Position position;
-  trajectory_.evaluate(position.toImplementation(), time);
+  LinearVelocity velocity;
+  LinearAcceleration acceleration;
+  evaluate(time, position, velocity, acceleration);
   return position;
 }
 
 const LinearVelocity EndEffectorTrajectory::evaluateVelocity(const double time) const
 {
-  const double timeInRange = mapTimeWithinDuration(time);
+  Position position;
   LinearVelocity velocity;
-  trajectory_.evaluateDerivative(velocity.toImplementation(), timeInRange, 1);
+  LinearAcceleration acceleration;
+  evaluate(time, position, velocity, acceleration);
   return velocity;
 }
 
 const LinearAcceleration EndEffectorTrajectory::evaluateAcceleration(const double time) const
 {
-  const double timeInRange = mapTimeWithinDuration(time);
+  Position position;
+  LinearVelocity velocity;
   LinearAcceleration acceleration;
-  trajectory_.evaluateDerivative(acceleration.toImplementation(), timeInRange, 2);
+  evaluate(time, position, velocity, acceleration);
   return acceleration;
 }
 
+void EndEffectorTrajectory::evaluate(const double time, Position& position, LinearVelocity& velocity,
+                                     LinearAcceleration& acceleration) const
+{
+  const double timeInRange = mapTimeWithinDuration(time);
+  if (!samples_.empty()) {
+    samples_.evaluate(timeInRange, position.toImplementation(), velocity.toImplementation(),
+                      acceleration.toImplementation());
+    return;
+  }
+  spline_.evaluate(timeInRange, position.toImplementation(), velocity.toImplementation(),
+                   acceleration.toImplementation());
+}
+
 double EndEffectorTrajectory::getDuration() const
 {
   return duration_;
 }
 
+void EndEffectorTrajectory::setSampling(const double timeStep, const SampleInterpolation interpolation)
+{
+  samplingTimeStep_ = timeStep;
+  samplingInterpolation_ = interpolation;
+  if (isComputed_) sampleTrajectory();
+}
+
+double EndEffectorTrajectory::getSamplingTimeStep() const
+{
+  return samplingTimeStep_;
+}
+
+void EndEffectorTrajectory::sampleTrajectory()
+{
+  samples_.clear();
+  if (samplingTimeStep_ <= 0.0 || spline_.empty()) return;
+  samples_.sample(duration_, samplingTimeStep_, samplingInterpolation_,
+                  [this](const double time, Eigen::Vector3d& position, Eigen::Vector3d& velocity,
+                         Eigen::Vector3d& acceleration) {
+    spline_.evaluate(time, position, velocity, acceleration);
+  });
+}
+
 const Position EndEffectorTrajectory::getTargetPosition() const
 {
   return Position(values_.at(ControlLevel::Position).back());
 }
 
-const std::string& EndEffectorTrajectory::getFrameId(const ControlLevel& controlLevel) const
+FrameId EndEffectorTrajectory::getFrameHandle(const ControlLevel& controlLevel) const
 {
-  return frameIds_.at(controlLevel);
+  return frameIds_[controlLevel];
 }
 
 void EndEffectorTrajectory::setIgnoreContact(bool ignoreContact)
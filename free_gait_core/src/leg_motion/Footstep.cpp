@@ -16,6 +16,7 @@ namespace free_gait {
 
 Footstep::Footstep(LimbEnum limb)
     : EndEffectorMotionBase(LegMotionBase::Type::Footstep, limb),
+      frameId_(FrameRegistry::invalidFrameId),
       profileHeight_(0.0),
       averageVelocity_(0.0),
       liftOffSpeed_(0.0),
@@ -26,7 +27,9 @@ Footstep::Footstep(LimbEnum limb)
       ignoreForPoseAdaptation_(false),
       isComputed_(false),
       controlSetup_ { {ControlLevel::Position, true}, {ControlLevel::Velocity, true},
-                      {ControlLevel::Acceleration, true}, {ControlLevel::Effort, false} }
+                      {ControlLevel::Acceleration, true}, {ControlLevel::Effort, false} },
+      samplingTimeStep_(0.0),
+      samplingInterpolation_(SampleInterpolation::Cubic)
 {
 }
 
@@ -40,7 +43,7 @@ std::unique_ptr<LegMotionBase> Footstep::clone() const
   return pointer;
 }
 
-const ControlSetup Footstep::getControlSetup() const
+const ControlSetup& Footstep::getControlSetup() const
 {
   return controlSetup_;
 }
@@ -97,7 +100,9 @@ bool Footstep::compute(bool isSupportLeg)
   touchdownVelocity_ = LinearVelocity(-touchdownSpeed_ * surfaceNormal.vector());
   trajectory_.clear();
   trajectory_.fitCurveWithDerivatives(times_, values_, liftOffVelocity_.vector(), touchdownVelocity_.vector());
+  spline_.setKnotsFromCubicCurve(trajectory_, times_);
   duration_ = trajectory_.getMaxTime() - trajectory_.getMinTime();
+  sampleTrajectory();
   isComputed_ = true;
   return true;
 }
@@ -121,39 +126,80 @@ void Footstep::reset()
 {
   start_.setZero();
   trajectory_.clear();
+  spline_.clear();
+  samples_.clear();
   duration_ = 0.0;
   isComputed_ = false;
 }
 
 const Position Footstep::evaluatePosition(const double time) const
 {
-  const double timeInRange = mapTimeWithinDuration(time);
   Position position;
-  trajectory_.evaluate(position.toImplementation(), timeInRange);
+  LinearVelocity velocity;
+  LinearAcceleration acceleration;
+  evaluate(time, position, velocity, acceleration);
   return position;
 }
 
 const LinearVelocity Footstep::evaluateVelocity(const double time) const
 {
-  const double timeInRange = mapTimeWithinDuration(time);
+  Position position;
   LinearVelocity velocity;
-  trajectory_.evaluateDerivative(velocity.toImplementation(), timeInRange, 1);
+  LinearAcceleration acceleration;
+  evaluate(time, position, velocity, acceleration);
   return velocity;
 }
 
 const LinearAcceleration Footstep::evaluateAcceleration(const double time) const
 {
-  const double timeInRange = mapTimeWithinDuration(time);
+  Position position;
+  LinearVelocity velocity;
   LinearAcceleration acceleration;
-  trajectory_.evaluateDerivative(acceleration.toImplementation(), timeInRange, 2);
+  evaluate(time, position, velocity, acceleration);
   return acceleration;
 }
 
+void Footstep::evaluate(const double time, Position& position, LinearVelocity& velocity,
+                        LinearAcceleration& acceleration) const
+{
+  const double timeInRange = mapTimeWithinDuration(time);
+  if (!samples_.empty()) {
+    samples_.evaluate(timeInRange, position.toImplementation(), velocity.toImplementation(),
+                      acceleration.toImplementation());
+    return;
+  }
+  spline_.evaluate(timeInRange, position.toImplementation(), velocity.toImplementation(),
+                   acceleration.toImplementation());
+}
+
 double Footstep::getDuration() const
 {
   return duration_;
 }
 
+void Footstep::setSampling(const double timeStep, const SampleInterpolation interpolation)
+{
+  samplingTimeStep_ = timeStep;
+  samplingInterpolation_ = interpolation;
+  if (isComputed_) sampleTrajectory();
+}
+
+double Footstep::getSamplingTimeStep() const
+{
+  return samplingTimeStep_;
+}
+
+void Footstep::sampleTrajectory()
+{
+  samples_.clear();
+  if (samplingTimeStep_ <= 0.0 || spline_.empty()) return;
+  samples_.sample(duration_, samplingTimeStep_, samplingInterpolation_,
+                  [this](const double time, Eigen::Vector3d& position, Eigen::Vector3d& velocity,
+                         Eigen::Vector3d& acceleration) {
+    spline_.evaluate(time, position, velocity, acceleration);
+  });
+}
+
 void Footstep::setMinimumDuration(const double minimumDuration)
 {
   minimumDuration_ = minimumDuration;
@@ -167,7 +213,7 @@ double Footstep::getMinimumDuration() const
 
 void Footstep::setTargetPosition(const std::string& frameId, const Position& target)
 {
-  frameId_ = frameId;
+  frameId_ = FrameRegistry::getInstance().internOrThrow(frameId);
   target_ = target;
 }
 
@@ -181,10 +227,10 @@ const LinearVelocity Footstep::getTargetVelocity() const
   return touchdownVelocity_;
 }
 
-const std::string& Footstep::getFrameId(const ControlLevel& controlLevel) const
+FrameId Footstep::getFrameHandle(const ControlLevel& controlLevel) const
 {
   if (controlLevel == ControlLevel::Effort) {
-    throw std::runtime_error("Footstep::getFrameId() is only valid for position or velocity.");
+    throw std::runtime_error("Footstep::getFrameHandle() is only valid for position or velocity.");
   }
   return frameId_;
 }
@@ -74,6 +74,14 @@ const JointEffortsLeg JointMotionBase::evaluateEffort(const double time) const
   throw std::runtime_error("JointMotionBase::evaluateEffort() not implemented.");
 }
 
+void JointMotionBase::evaluate(const double time, JointPositionsLeg& position, JointVelocitiesLeg& velocity,
+                               JointAccelerationsLeg& acceleration) const
+{
+  position = evaluatePosition(time);
+  velocity = evaluateVelocity(time);
+  acceleration = evaluateAcceleration(time);
+}
+
 bool JointMotionBase::isIgnoreForPoseAdaptation() const
 {
   return true;
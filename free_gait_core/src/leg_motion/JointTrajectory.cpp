@@ -7,15 +7,22 @@
  */
 #include <free_gait_core/leg_motion/JointTrajectory.hpp>
 
+// STD
+#include <iostream>
+
 namespace free_gait {
 
+constexpr int JointTrajectory::nJoints;
+
 JointTrajectory::JointTrajectory(LimbEnum limb)
     : JointMotionBase(LegMotionBase::Type::JointTrajectory, limb),
       ignoreContact_(false),
       duration_(0.0),
       isComputed_(false),
       controlSetup_ { {ControlLevel::Position, false}, {ControlLevel::Velocity, false},
-                            {ControlLevel::Acceleration, false}, {ControlLevel::Effort, false} }
+                            {ControlLevel::Acceleration, false}, {ControlLevel::Effort, false} },
+      samplingTimeStep_(0.0),
+      samplingInterpolation_(SampleInterpolation::Cubic)
 {
 }
 
@@ -45,7 +52,7 @@ const std::vector<JointNodeEnum> JointTrajectory::getJointNodeEnums() const
   return jointNodeEnums_;
 }
 
-const ControlSetup JointTrajectory::getControlSetup() const
+const ControlSetup& JointTrajectory::getControlSetup() const
 {
   return controlSetup_;
 }
@@ -111,10 +118,12 @@ bool JointTrajectory::needsComputation() const
 
 bool JointTrajectory::compute()
 {
-  for (auto& trajectories : trajectories_) {
-    trajectories.second.resize(values_.at(trajectories.first).size());
-    for (size_t i = 0; i < values_.at(trajectories.first).size(); ++i) {
-      trajectories.second[i].fitCurve(times_.at(trajectories.first), values_.at(trajectories.first)[i]);
+  for (const auto& values : values_) {
+    if (values.first == ControlLevel::Position) continue; // Represented by the spline.
+    auto& trajectories = trajectories_[values.first];
+    trajectories.resize(values.second.size());
+    for (size_t i = 0; i < values.second.size(); ++i) {
+      trajectories[i].fitCurve(times_.at(values.first), values.second[i]);
     }
   }
 
@@ -122,12 +131,42 @@ bool JointTrajectory::compute()
     // Curves implementation provides velocities and accelerations.
     controlSetup_[ControlLevel::Velocity] = true;
     controlSetup_[ControlLevel::Acceleration] = true;
+    if (!computeSpline()) return false;
+    sampleTrajectory();
   }
 
   isComputed_ = true;
   return true;
 }
 
+bool JointTrajectory::computeSpline()
+{
+  const auto& times = times_.at(ControlLevel::Position);
+  const auto& values = values_.at(ControlLevel::Position);
+  if (values.size() > nJoints) {
+    std::cerr << "JointTrajectory::compute: Trajectory has " << values.size() << " joints, but a leg has "
+              << nJoints << " joints." << std::endl;
+    return false;
+  }
+
+  // The quintic splines are fully defined by the position, velocity, and
+  // acceleration at their knots.
+  HermiteSpline<nJoints>::Values positions(times.size(), JointVector::Zero());
+  HermiteSpline<nJoints>::Values velocities(times.size(), JointVector::Zero());
+  HermiteSpline<nJoints>::Values accelerations(times.size(), JointVector::Zero());
+  curves::PolynomialSplineQuinticScalarCurve trajectory;
+  for (size_t i = 0; i < values.size(); ++i) {
+    trajectory.fitCurve(times, values[i]);
+    for (size_t k = 0; k < times.size(); ++k) {
+      trajectory.evaluate(positions[k](i), times[k]);
+      trajectory.evaluateDerivative(velocities[k](i), times[k], 1);
+      trajectory.evaluateDerivative(accelerations[k](i), times[k], 2);
+    }
+  }
+  spline_.setKnots(times, positions, velocities, accelerations);
+  return true;
+}
+
 bool JointTrajectory::isComputed() const
 {
   return isComputed_;
@@ -138,6 +177,8 @@ void JointTrajectory::reset()
   for (auto& trajectories : trajectories_) {
     trajectories.second.clear();
   }
+  spline_.clear();
+  samples_.clear();
   duration_ = 0.0;
   isComputed_ = false;
 }
@@ -147,40 +188,66 @@ double JointTrajectory::getDuration() const
   return duration_;
 }
 
+void JointTrajectory::setSampling(const double timeStep, const SampleInterpolation interpolation)
+{
+  samplingTimeStep_ = timeStep;
+  samplingInterpolation_ = interpolation;
+  if (isComputed_) sampleTrajectory();
+}
+
+double JointTrajectory::getSamplingTimeStep() const
+{
+  return samplingTimeStep_;
+}
+
+void JointTrajectory::sampleTrajectory()
+{
+  samples_.clear();
+  if (samplingTimeStep_ <= 0.0 || spline_.empty()) return;
+  samples_.sample(duration_, samplingTimeStep_, samplingInterpolation_,
+                  [this](const double time, JointVector& position, JointVector& velocity,
+                         JointVector& acceleration) {
+    spline_.evaluate(time, position, velocity, acceleration);
+  });
+}
+
 const JointPositionsLeg JointTrajectory::evaluatePosition(const double time) const
 {
   if (!isComputed_) throw std::runtime_error("JointTrajectory::evaluatePosition() cannot be called if trajectory is not computed.");
-  const double timeInRange = mapTimeWithinDuration(time);
-  const auto& trajectories = trajectories_.at(ControlLevel::Position);
-  JointPositionsLeg jointPositions;
-  for (size_t i = 0; i < trajectories.size(); ++i) {
-    trajectories[i].evaluate(jointPositions(i), timeInRange);
-  }
-  return jointPositions;
+  return JointPositionsLeg(evaluateDerivative(time, 0));
 }
 
 const JointVelocitiesLeg JointTrajectory::evaluateVelocity(const double time) const
 {
   if (!isComputed_) throw std::runtime_error("JointTrajectory::evaluateVelocity() cannot be called if trajectory is not computed.");
-  const double timeInRange = mapTimeWithinDuration(time);
-  const auto& trajectories = trajectories_.at(ControlLevel::Position);
-  JointVelocitiesLeg jointVelocities;
-  for (size_t i = 0; i < trajectories.size(); ++i) {
-    trajectories[i].evaluateDerivative(jointVelocities(i), timeInRange, 1);
-  }
-  return jointVelocities;
+  return JointVelocitiesLeg(evaluateDerivative(time, 1));
 }
 
 const JointAccelerationsLeg JointTrajectory::evaluateAcceleration(const double time) const
 {
   if (!isComputed_) throw std::runtime_error("JointTrajectory::evaluateAcceleration() cannot be called if trajectory is not computed.");
+  return JointAccelerationsLeg(evaluateDerivative(time, 2));
+}
+
+void JointTrajectory::evaluate(const double time, JointPositionsLeg& position, JointVelocitiesLeg& velocity,
+                               JointAccelerationsLeg& acceleration) const
+{
+  if (!isComputed_) throw std::runtime_error("JointTrajectory::evaluate() cannot be called if trajectory is not computed.");
   const double timeInRange = mapTimeWithinDuration(time);
-  const auto& trajectories = trajectories_.at(ControlLevel::Position);
-  JointAccelerationsLeg jointAccelerations;
-  for (size_t i = 0; i < trajectories.size(); ++i) {
-    trajectories[i].evaluateDerivative(jointAccelerations(i), timeInRange, 2);
+  if (!samples_.empty()) {
+    samples_.evaluate(timeInRange, position.toImplementation(), velocity.toImplementation(),
+                      acceleration.toImplementation());
+    return;
   }
-  return jointAccelerations;
+  spline_.evaluate(timeInRange, position.toImplementation(), velocity.toImplementation(),
+                   acceleration.toImplementation());
+}
+
+JointTrajectory::JointVector JointTrajectory::evaluateDerivative(const double time, const unsigned int order) const
+{
+  const double timeInRange = mapTimeWithinDuration(time);
+  if (!samples_.empty()) return samples_.evaluateDerivative(timeInRange, order);
+  return spline_.evaluateDerivative(timeInRange, order);
 }
 
 const JointEffortsLeg JointTrajectory::evaluateEffort(const double time) const
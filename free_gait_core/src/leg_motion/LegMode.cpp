@@ -13,6 +13,7 @@ namespace free_gait {
 
 LegMode::LegMode(LimbEnum limb)
     : EndEffectorMotionBase(LegMotionBase::Type::LegMode, limb),
+      frameId_(FrameRegistry::invalidFrameId),
       duration_(0.0),
       ignoreContact_(false),
       ignoreForPoseAdaptation_(false),
@@ -34,7 +35,7 @@ std::unique_ptr<LegMotionBase> LegMode::clone() const
   return pointer;
 }
 
-const ControlSetup LegMode::getControlSetup() const
+const ControlSetup& LegMode::getControlSetup() const
 {
   // TODO Generate correct leg mode!
   return controlSetup_;
@@ -74,6 +75,14 @@ const Position LegMode::evaluatePosition(const double time) const
   return position_;
 }
 
+void LegMode::evaluate(const double time, Position& position, LinearVelocity& velocity,
+                       LinearAcceleration& acceleration) const
+{
+  position = position_;
+  velocity.setZero();
+  acceleration.setZero();
+}
+
 double LegMode::getDuration() const
 {
   return duration_;
@@ -84,7 +93,7 @@ const Position LegMode::getTargetPosition() const
   return position_;
 }
 
-const std::string& LegMode::getFrameId() const
+FrameId LegMode::getFrameHandle(const ControlLevel& controlLevel) const
 {
   return frameId_;
 }
@@ -62,7 +62,7 @@ LegMotionBase::TrajectoryType LegMotionBase::getTrajectoryType() const
   throw std::runtime_error("LegMotionBase::getTrajectoryType() not implemented.");
 }
 
-const ControlSetup LegMotionBase::getControlSetup() const
+const ControlSetup& LegMotionBase::getControlSetup() const
 {
   throw std::runtime_error("LegMotionBase::getControlSetup() not implemented.");
 }
@@ -97,6 +97,16 @@ double LegMotionBase::getDuration() const
   throw std::runtime_error("LegMotionBase::getDuration() not implemented.");
 }
 
+void LegMotionBase::setSampling(const double timeStep, const SampleInterpolation interpolation)
+{
+  throw std::runtime_error("LegMotionBase::setSampling() not implemented.");
+}
+
+double LegMotionBase::getSamplingTimeStep() const
+{
+  return 0.0;
+}
+
 bool LegMotionBase::hasSurfaceNormal() const
 {
   return (bool)(surfaceNormal_);
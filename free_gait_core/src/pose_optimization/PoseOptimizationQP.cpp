@@ -14,6 +14,9 @@
 #include <numopt_quadprog/ActiveSetFunctionMinimizer.hpp>
 #include <numopt_common/ParameterizationIdentity.hpp>
 
+#include <algorithm>
+#include <limits>
+
 using namespace Eigen;
 
 namespace free_gait {
@@ -21,7 +24,8 @@ namespace free_gait {
 PoseOptimizationQP::PoseOptimizationQP(const AdapterBase& adapter)
     : PoseOptimizationBase(adapter),
       nStates_(3),
-      nDimensions_(3)
+      nDimensions_(3),
+      useGenericSolver_(false)
 {
   solver_.reset(new numopt_quadprog::ActiveSetFunctionMinimizer());
 }
@@ -33,7 +37,8 @@ PoseOptimizationQP::~PoseOptimizationQP()
 PoseOptimizationQP::PoseOptimizationQP(const PoseOptimizationQP& other)
     : PoseOptimizationBase(other),
       nStates_(other.nStates_),
-      nDimensions_(other.nDimensions_)
+      nDimensions_(other.nDimensions_),
+      useGenericSolver_(other.useGenericSolver_)
 {
   solver_.reset(new numopt_quadprog::ActiveSetFunctionMinimizer());
 }
@@ -52,17 +57,122 @@ bool PoseOptimizationQP::optimize(Pose& pose)
       adapter_.transformPosition(adapter_.getWorldFrameId(), adapter_.getBaseFrameId(),
                                  adapter_.getCenterOfMassInWorldFrame()));
 
+  const RotationMatrix orientation(pose.getRotation());
+  if (useGenericSolver_) {
+    return optimizePositionWithGenericSolver(stance_, nominalStanceInBaseFrame_, orientation, centerOfMassInBaseFrame,
+                                             supportRegion_, pose.getPosition());
+  }
+  return optimizePosition(stance_, nominalStanceInBaseFrame_, orientation, centerOfMassInBaseFrame, supportRegion_,
+                          pose.getPosition());
+}
+
+void PoseOptimizationQP::setUseGenericSolver(const bool useGenericSolver)
+{
+  useGenericSolver_ = useGenericSolver;
+}
+
+bool PoseOptimizationQP::usesGenericSolver() const
+{
+  return useGenericSolver_;
+}
+
+bool PoseOptimizationQP::optimizePosition(const Stance& stance, const Stance& nominalStanceInBaseFrame,
+                                          const RotationMatrix& orientation, const Position& centerOfMassInBaseFrame,
+                                          const grid_map::Polygon& supportRegion, Position& position)
+{
+  if (stance.empty()) return false;
+
+  // Unconstrained optimum of min sum_i ||x - b_i||^2 with b_i = p_i - R * n_i.
+  const Matrix3d& R = orientation.matrix();
+  Vector3d x = Vector3d::Zero();
+  for (const auto& footPosition : stance) {
+    x += footPosition.second.vector();
+    const auto nominalFootPosition = nominalStanceInBaseFrame.find(footPosition.first);
+    if (nominalFootPosition != nominalStanceInBaseFrame.end()) x -= R * nominalFootPosition->second.vector();
+  }
+  x /= static_cast<double>(stance.size());
+
+  // The support region constrains the horizontal position of the center of mass.
+  const Vector2d centerOfMassOffset = (R * centerOfMassInBaseFrame.vector()).head<2>();
+  Vector2d centerOfMass = x.head<2>() + centerOfMassOffset;
+  projectOntoPolygon(supportRegion, centerOfMass);
+  x.head<2>() = centerOfMass - centerOfMassOffset;
+
+  position.vector() = x;
+  return true;
+}
+
+void PoseOptimizationQP::projectOntoPolygon(const grid_map::Polygon& polygon, Eigen::Vector2d& point)
+{
+  const auto& vertices = polygon.getVertices();
+  const size_t nVertices = vertices.size();
+  if (nVertices == 0) return;
+  if (nVertices == 1) {
+    point = vertices.front();
+    return;
+  }
+
+  // No active constraint if the point is inside.
+  if (nVertices > 2) {
+    double doubleArea = 0.0;
+    for (size_t i = 0; i < nVertices; ++i) {
+      const Vector2d& a = vertices[i];
+      const Vector2d& b = vertices[(i + 1) % nVertices];
+      doubleArea += a.x() * b.y() - b.x() * a.y();
+    }
+    if (doubleArea != 0.0) {
+      const double orientation = doubleArea > 0.0 ? 1.0 : -1.0;
+      bool isInside = true;
+      for (size_t i = 0; i < nVertices && isInside; ++i) {
+        const Vector2d& a = vertices[i];
+        const Vector2d edge = vertices[(i + 1) % nVertices] - a;
+        const Vector2d toPoint = point - a;
+        isInside = orientation * (edge.x() * toPoint.y() - edge.y() * toPoint.x()) >= 0.0;
+      }
+      if (isInside) return;
+    }
+  }
+
+  // One (edge) or two (vertex) active constraints: closest point on the boundary.
+  double minSquaredDistance = std::numeric_limits<double>::max();
+  Vector2d closestPoint = point;
+  for (size_t i = 0; i < nVertices; ++i) {
+    const Vector2d& a = vertices[i];
+    const Vector2d edge = vertices[(i + 1) % nVertices] - a;
+    const double squaredLength = edge.squaredNorm();
+    double t = 0.0;
+    if (squaredLength > 0.0) t = std::min(std::max((point - a).dot(edge) / squaredLength, 0.0), 1.0);
+    const Vector2d candidate = a + t * edge;
+    const double squaredDistance = (point - candidate).squaredNorm();
+    if (squaredDistance < minSquaredDistance) {
+      minSquaredDistance = squaredDistance;
+      closestPoint = candidate;
+    }
+  }
+  point = closestPoint;
+}
+
+bool PoseOptimizationQP::optimizePositionWithGenericSolver(const Stance& stance,
+                                                           const Stance& nominalStanceInBaseFrame,
+                                                           const RotationMatrix& orientation,
+                                                           const Position& centerOfMassInBaseFrame,
+                                                           const grid_map::Polygon& supportRegion,
+                                                           Position& position)
+{
   // Problem definition:
   // min Ax - b, Gx <= h
-  unsigned int nFeet = stance_.size();
+  unsigned int nFeet = stance.size();
   MatrixXd A = MatrixXd::Zero(nDimensions_ * nFeet, nStates_);
   VectorXd b = VectorXd::Zero(nDimensions_ * nFeet);
-  Matrix3d R = RotationMatrix(pose.getRotation()).matrix();
+  Matrix3d R = orientation.matrix();
 
   unsigned int i = 0;
-  for (const auto& footPosition : stance_) {
+  for (const auto& footPosition : stance) {
+    const auto nominalFootPosition = nominalStanceInBaseFrame.find(footPosition.first);
+    const Vector3d nominalPosition = nominalFootPosition == nominalStanceInBaseFrame.end() ?
+        Vector3d::Zero() : nominalFootPosition->second.vector();
     A.block(nDimensions_ * i, 0, nStates_, A.cols()) << Matrix3d::Identity();
-    b.segment(nDimensions_ * i, nDimensions_) << footPosition.second.vector() - R * nominalStanceInBaseFrame_[footPosition.first].vector();
+    b.segment(nDimensions_ * i, nDimensions_) << footPosition.second.vector() - R * nominalPosition;
     ++i;
   }
 
@@ -73,7 +183,7 @@ bool PoseOptimizationQP::optimize(Pose& pose)
   // Inequality constraints.
   Eigen::MatrixXd G;
   Eigen::VectorXd hp;
-  supportRegion_.convertToInequalityConstraints(G, hp);
+  supportRegion.convertToInequalityConstraints(G, hp);
   Eigen::VectorXd h = hp - G * (R * centerOfMassInBaseFrame.vector()).head(2);
   G.conservativeResize(Eigen::NoChange,3); // Add column corresponding to Z position
   G.col(2).setZero(); // No constraints in Z position
@@ -112,8 +222,8 @@ bool PoseOptimizationQP::optimize(Pose& pose)
   x = params.getParams();
 //  std::cout << "x: " << std::endl << x << std::endl;
 
-  // Return optimized pose.
-  pose.getPosition().vector() = x;
+  // Return optimized position.
+  position.vector() = x;
   return true;
 }
 
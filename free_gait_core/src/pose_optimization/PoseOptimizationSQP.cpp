@@ -17,6 +17,7 @@
 #include <numopt_quadprog/ActiveSetFunctionMinimizer.hpp>
 #include <numopt_sqp/SQPFunctionMinimizer.hpp>
 
+#include <algorithm>
 #include <functional>
 
 namespace free_gait {
@@ -25,7 +26,13 @@ PoseOptimizationSQP::PoseOptimizationSQP(const AdapterBase& adapter)
     : PoseOptimizationBase(adapter),
       timer_("PoseOptimizationSQP"),
       durationInCallback_(0.0),
-      nIterations_(0)
+      nIterations_(0),
+      maxIterations_(30),
+      maxDuration_(0.0),
+      iterationDuration_(0.0),
+      useWarmStart_(true),
+      hasWarmStart_(false),
+      isWarmStarted_(false)
 {
   objective_.reset(new PoseOptimizationObjectiveFunction());
 
@@ -36,6 +43,9 @@ PoseOptimizationSQP::PoseOptimizationSQP(const AdapterBase& adapter)
   }
   constraints_->setPositionsBaseToHip(positionsBaseToHipInBaseFrame);
 
+  problem_.reset(new PoseOptimizationProblem(objective_, constraints_));
+  qpSolver_.reset(new numopt_quadprog::ActiveSetFunctionMinimizer);
+
   timer_.setAlpha(1.0);
 }
 
@@ -80,26 +90,77 @@ bool PoseOptimizationSQP::optimize(Pose& pose)
   callExternalOptimizationStepCallback(0);
 
   // Optimize.
-  PoseOptimizationProblem problem(objective_, constraints_);
-  std::shared_ptr<numopt_common::QuadraticProblemSolver> qpSolver(
-      new numopt_quadprog::ActiveSetFunctionMinimizer);
-  numopt_sqp::SQPFunctionMinimizer solver(qpSolver, 30, 0.01, 3, -DBL_MAX);
-  solver.registerOptimizationStepCallback(
-      std::bind(&PoseOptimizationSQP::optimizationStepCallback, this, std::placeholders::_1, std::placeholders::_2,
-                std::placeholders::_3, std::placeholders::_4));
-  solver.setCheckConstraints(false);
-  solver.setPrintOutput(false);
+  numopt_sqp::SQPFunctionMinimizer& solver = getSolver(getIterationBudget());
+  isWarmStarted_ = useWarmStart_ && hasWarmStart_ && applyWarmStart(pose);
   PoseParameterization params;
   params.setPose(pose);
   double functionValue;
-  if (!solver.minimize(&problem, params, functionValue)) return false;
+  nIterations_ = 0;
+  const double durationInCallbackBeforeSolver = durationInCallback_;
+  timer_.pinTime("solver");
+  const bool success = solver.minimize(problem_.get(), params, functionValue);
+  timer_.splitTime("solver");
+  if (!success) {
+    hasWarmStart_ = false;
+    return false;
+  }
   pose = params.getPose();
   // TODO Fix unit quaternion?
 
+  const double solverDuration = timer_.getAverageElapsedTimeUSec("solver")
+      - (durationInCallback_ - durationInCallbackBeforeSolver);
+  const double iterationDuration = solverDuration / std::max(nIterations_, size_t(1));
+  iterationDuration_ = iterationDuration_ > 0.0 ? 0.5 * (iterationDuration_ + iterationDuration) : iterationDuration;
+
+  warmStartPositionInStanceFrame_ = pose.getPosition() - getStanceCenter();
+  warmStartOrientation_ = pose.getRotation();
+  hasWarmStart_ = true;
+
   timer_.splitTime("total");
   return true;
 }
 
+void PoseOptimizationSQP::setMaxIterations(const size_t maxIterations)
+{
+  maxIterations_ = std::max(maxIterations, size_t(1));
+}
+
+size_t PoseOptimizationSQP::getMaxIterations() const
+{
+  return maxIterations_;
+}
+
+void PoseOptimizationSQP::setMaxDuration(const double maxDuration)
+{
+  maxDuration_ = maxDuration;
+}
+
+double PoseOptimizationSQP::getMaxDuration() const
+{
+  return maxDuration_;
+}
+
+void PoseOptimizationSQP::setWarmStart(const bool useWarmStart)
+{
+  useWarmStart_ = useWarmStart;
+}
+
+bool PoseOptimizationSQP::usesWarmStart() const
+{
+  return useWarmStart_;
+}
+
+void PoseOptimizationSQP::resetWarmStart()
+{
+  hasWarmStart_ = false;
+  isWarmStarted_ = false;
+}
+
+bool PoseOptimizationSQP::isWarmStarted() const
+{
+  return isWarmStarted_;
+}
+
 void PoseOptimizationSQP::optimizationStepCallback(const size_t iterationStep,
                                                    const numopt_common::Parameterization& parameters,
                                                    const double functionValue,
@@ -149,6 +210,65 @@ size_t PoseOptimizationSQP::getNumberOfIterations() const
   return nIterations_;
 }
 
+size_t PoseOptimizationSQP::getIterationBudget() const
+{
+  if (maxDuration_ <= 0.0 || iterationDuration_ <= 0.0) return maxIterations_;
+  const size_t budget = static_cast<size_t>(maxDuration_ / iterationDuration_);
+  return std::max(size_t(1), std::min(maxIterations_, budget));
+}
+
+numopt_sqp::SQPFunctionMinimizer& PoseOptimizationSQP::getSolver(const size_t maxIterations)
+{
+  if (solvers_.size() < maxIterations) solvers_.resize(maxIterations);
+  std::unique_ptr<numopt_sqp::SQPFunctionMinimizer>& solver = solvers_[maxIterations - 1];
+  if (!solver) {
+    solver.reset(new numopt_sqp::SQPFunctionMinimizer(qpSolver_, maxIterations, 0.01, 3, -DBL_MAX));
+    solver->registerOptimizationStepCallback(
+        std::bind(&PoseOptimizationSQP::optimizationStepCallback, this, std::placeholders::_1, std::placeholders::_2,
+                  std::placeholders::_3, std::placeholders::_4));
+    solver->setCheckConstraints(false);
+    solver->setPrintOutput(false);
+  }
+  return *solver;
+}
+
+bool PoseOptimizationSQP::applyWarmStart(Pose& pose)
+{
+  // In steady walking, the base keeps its pose relative to the stance.
+  const Pose warmStartPose(getStanceCenter() + warmStartPositionInStanceFrame_, warmStartOrientation_);
+  double value, constraintViolation, warmStartValue, warmStartConstraintViolation;
+  if (!evaluate(pose, value, constraintViolation)) return false;
+  if (!evaluate(warmStartPose, warmStartValue, warmStartConstraintViolation)) return false;
+  if (warmStartConstraintViolation > constraintViolation || warmStartValue >= value) return false;
+  pose = warmStartPose;
+  return true;
+}
+
+bool PoseOptimizationSQP::evaluate(const Pose& pose, double& value, double& constraintViolation)
+{
+  PoseParameterization params;
+  params.setPose(pose);
+  if (!objective_->computeValue(value, params)) return false;
+  numopt_common::Vector values, minValues, maxValues;
+  if (!constraints_->getInequalityConstraintValues(values, params)) return false;
+  if (!constraints_->getInequalityConstraintMinValues(minValues)) return false;
+  if (!constraints_->getInequalityConstraintMaxValues(maxValues)) return false;
+  constraintViolation = 0.0;
+  if (values.size() == 0) return true;
+  if (values.size() != minValues.size() || values.size() != maxValues.size()) return false;
+  constraintViolation = std::max((minValues - values).maxCoeff(), (values - maxValues).maxCoeff());
+  constraintViolation = std::max(constraintViolation, 0.0);
+  return true;
+}
+
+Position PoseOptimizationSQP::getStanceCenter() const
+{
+  Position center;
+  if (stance_.empty()) return center;
+  for (const auto& foot : stance_) center += foot.second;
+  return Position(center.vector() / stance_.size());
+}
+
 void PoseOptimizationSQP::callExternalOptimizationStepCallback(const size_t iterationStep, const double functionValue,
                                                                const bool finalIteration)
 {
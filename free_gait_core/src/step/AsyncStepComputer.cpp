@@ -0,0 +1,197 @@
+/*
+ * AsyncStepComputer.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#include "free_gait_core/step/AsyncStepComputer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+
+namespace free_gait {
+
+AsyncStepComputer::Job::Job(const Step& step)
+    : step_(step),
+      isDone_(false),
+      isSuccessful_(false)
+{
+}
+
+AsyncStepComputer::AsyncStepComputer(const size_t nThreads, const size_t lookahead)
+    : StepComputer(),
+      nThreads_(std::max(nThreads, size_t(1))),
+      lookahead_(lookahead),
+      isStopping_(false),
+      nRunningJobs_(0)
+{
+}
+
+AsyncStepComputer::~AsyncStepComputer()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    isStopping_ = true;
+  }
+  condition_.notify_all();
+  for (auto& worker : workers_) worker.join();
+}
+
+bool AsyncStepComputer::initialize()
+{
+  if (!workers_.empty()) return true;
+  for (size_t i = 0; i < nThreads_; ++i) {
+    workers_.emplace_back(&AsyncStepComputer::work, this);
+  }
+  return true;
+}
+
+bool AsyncStepComputer::compute()
+{
+  if (workers_.empty()) {
+    std::cerr << "AsyncStepComputer::compute: Computer is not initialized." << std::endl;
+    return false;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    currentJob_ = std::make_shared<Job>(step_);
+    queuedJobs_.push_front(currentJob_);
+  }
+  condition_.notify_one();
+  return true;
+}
+
+bool AsyncStepComputer::isBusy()
+{
+  return currentJob_ && !currentJob_->isDone_;
+}
+
+bool AsyncStepComputer::isDone()
+{
+  return currentJob_ && currentJob_->isDone_;
+}
+
+void AsyncStepComputer::resetIsDone()
+{
+  if (isDone()) currentJob_.reset();
+}
+
+void AsyncStepComputer::setStep(const Step& step)
+{
+  if (isBusy()) throw std::runtime_error("AsyncStepComputer::setStep: Cannot set step while computing.");
+  step_ = step;
+}
+
+void AsyncStepComputer::getStep(Step& step)
+{
+  if (!isDone()) throw std::runtime_error("AsyncStepComputer::getStep: Computation is not done.");
+  step = currentJob_->step_;
+}
+
+size_t AsyncStepComputer::getLookahead() const
+{
+  return lookahead_;
+}
+
+void AsyncStepComputer::setLookahead(const size_t lookahead)
+{
+  lookahead_ = lookahead;
+}
+
+size_t AsyncStepComputer::getNumberOfThreads() const
+{
+  return nThreads_;
+}
+
+bool AsyncStepComputer::precompute(const Step& step)
+{
+  if (workers_.empty()) return false;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (precomputations_.count(step.getId()) > 0) return false;
+    auto job = std::make_shared<Job>(step);
+    precomputations_[step.getId()] = job;
+    queuedJobs_.push_back(job);
+  }
+  condition_.notify_one();
+  return true;
+}
+
+bool AsyncStepComputer::hasPrecomputation(const std::string& stepId)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return precomputations_.count(stepId) > 0;
+}
+
+bool AsyncStepComputer::getPrecomputedStep(const std::string& stepId, Step& step)
+{
+  std::shared_ptr<Job> job;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto iterator = precomputations_.find(stepId);
+    if (iterator == precomputations_.end()) return false;
+    job = iterator->second;
+    precomputations_.erase(iterator);
+    // Skip the computation if it has not been started yet.
+    const auto queuedJob = std::find(queuedJobs_.begin(), queuedJobs_.end(), job);
+    if (queuedJob != queuedJobs_.end()) queuedJobs_.erase(queuedJob);
+  }
+  idleCondition_.notify_all();
+  if (!job->isDone_ || !job->isSuccessful_) return false;
+  step = job->step_;
+  return true;
+}
+
+void AsyncStepComputer::clearPrecomputations()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& precomputation : precomputations_) {
+      const auto queuedJob = std::find(queuedJobs_.begin(), queuedJobs_.end(), precomputation.second);
+      if (queuedJob != queuedJobs_.end()) queuedJobs_.erase(queuedJob);
+    }
+    precomputations_.clear();
+  }
+  idleCondition_.notify_all();
+}
+
+bool AsyncStepComputer::waitUntilIdle(const double timeout)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  return idleCondition_.wait_for(lock, std::chrono::duration<double>(timeout),
+                                 [this] { return queuedJobs_.empty() && nRunningJobs_ == 0; });
+}
+
+void AsyncStepComputer::work()
+{
+  while (true) {
+    std::shared_ptr<Job> job;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this] { return isStopping_ || !queuedJobs_.empty(); });
+      if (isStopping_) return;
+      job = queuedJobs_.front();
+      queuedJobs_.pop_front();
+      ++nRunningJobs_;
+    }
+    // Exceptions must not leave the worker thread, the step is reported as failed.
+    try {
+      job->isSuccessful_ = job->step_.compute();
+    } catch (const std::exception& exception) {
+      std::cerr << "AsyncStepComputer: Could not compute step " << job->step_.getId() << ": "
+                << exception.what() << std::endl;
+      job->isSuccessful_ = false;
+    }
+    job->isDone_ = true;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --nRunningJobs_;
+    }
+    idleCondition_.notify_all();
+  }
+}
+
+} /* namespace */
@@ -30,7 +30,8 @@ Step::Step()
     : time_(0.0),
       totalDuration_(0.0),
       isUpdated_(false),
-      isComputed_(false)
+      isComputed_(false),
+      sequenceNumber_(0)
 {
   legMotions_.clear();
   baseMotion_.reset();
@@ -55,6 +56,7 @@ Step::Step(const Step& other)
       isUpdated_(other.isUpdated_),
       isComputed_(other.isComputed_),
       id_(other.id_),
+      sequenceNumber_(other.sequenceNumber_),
       customCommands_(other.customCommands_)
 {
   if (other.baseMotion_) baseMotion_ = std::move(other.baseMotion_->clone());
@@ -71,6 +73,7 @@ Step& Step::operator=(const Step& other)
   isUpdated_ = other.isUpdated_;
   isComputed_ = other.isComputed_;
   id_ = other.id_;
+  sequenceNumber_ = other.sequenceNumber_;
   customCommands_ = other.customCommands_;
   if (other.baseMotion_) baseMotion_ = std::move(other.baseMotion_->clone());
   legMotions_.clear();
@@ -142,6 +145,11 @@ bool Step::compute()
   return true;
 }
 
+bool Step::isComputed() const
+{
+  return isComputed_;
+}
+
 bool Step::isUpdated() const
 {
   return isUpdated_;
@@ -352,6 +360,11 @@ void Step::setId(const std::string& id)
   id_ = id;
 }
 
+uint64_t Step::getSequenceNumber() const
+{
+  return sequenceNumber_;
+}
+
 std::ostream& operator<<(std::ostream& out, const Step& step)
 {
   out << "------" << std::endl;
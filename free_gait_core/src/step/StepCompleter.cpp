@@ -21,30 +21,42 @@ StepCompleter::~StepCompleter()
 {
 }
 
+const StepParameters& StepCompleter::getParameters() const
+{
+  return parameters_;
+}
+
 bool StepCompleter::complete(const State& state, const StepQueue& queue, Step& step)
 {
+  // The motions are cast by their type tags, which avoids run-time type checks.
   for (auto& legMotion : step.legMotions_) {
     setParameters(*legMotion.second);
     legMotion.second->hasContactAtStart_ = adapter_.isLegGrounded(legMotion.first);
     switch (legMotion.second->getType()) {
       case LegMotionBase::Type::Footstep:
-        setParameters(dynamic_cast<Footstep&>(*legMotion.second));
+        setParameters(static_cast<Footstep&>(*legMotion.second));
         break;
       case LegMotionBase::Type::EndEffectorTarget:
-        setParameters(dynamic_cast<EndEffectorTarget&>(*legMotion.second));
+        setParameters(static_cast<EndEffectorTarget&>(*legMotion.second));
+        break;
+      case LegMotionBase::Type::EndEffectorTrajectory:
+        setParameters(static_cast<EndEffectorTrajectory&>(*legMotion.second));
+        break;
+      case LegMotionBase::Type::JointTrajectory:
+        setParameters(static_cast<JointTrajectory&>(*legMotion.second));
         break;
       case LegMotionBase::Type::LegMode:
-        setParameters(dynamic_cast<LegMode&>(*legMotion.second));
+        setParameters(static_cast<LegMode&>(*legMotion.second));
         break;
       default:
         break;
     }
     switch (legMotion.second->getTrajectoryType()) {
       case LegMotionBase::TrajectoryType::EndEffector:
-        if (!complete(state, step, dynamic_cast<EndEffectorMotionBase&>(*legMotion.second))) return false;
+        if (!complete(state, step, static_cast<EndEffectorMotionBase&>(*legMotion.second))) return false;
         break;
       case LegMotionBase::TrajectoryType::Joints:
-        if (!complete(state, step, dynamic_cast<JointMotionBase&>(*legMotion.second))) return false;
+        if (!complete(state, step, static_cast<JointMotionBase&>(*legMotion.second))) return false;
         break;
       default:
         throw std::runtime_error("StepCompleter::complete() could not complete leg motion of this type.");
@@ -55,13 +67,13 @@ bool StepCompleter::complete(const State& state, const StepQueue& queue, Step& s
   if (step.baseMotion_) {
     switch (step.baseMotion_->getType()) {
       case BaseMotionBase::Type::Auto:
-        setParameters(dynamic_cast<BaseAuto&>(*step.baseMotion_));
+        setParameters(static_cast<BaseAuto&>(*step.baseMotion_));
         break;
       case BaseMotionBase::Type::Target:
-        setParameters(dynamic_cast<BaseTarget&>(*step.baseMotion_));
+        setParameters(static_cast<BaseTarget&>(*step.baseMotion_));
         break;
       case BaseMotionBase::Type::Trajectory:
-        setParameters(dynamic_cast<BaseTrajectory&>(*step.baseMotion_));
+        setParameters(static_cast<BaseTrajectory&>(*step.baseMotion_));
         break;
       default:
         break;
@@ -72,6 +84,47 @@ bool StepCompleter::complete(const State& state, const StepQueue& queue, Step& s
   return true;
 }
 
+bool StepCompleter::complete(const State& state, const StepQueue& queue, const Step& precomputedStep, Step& step)
+{
+  if (!complete(state, queue, step)) return false;
+  if (!step.needsComputation() || precomputedStep.getId() != step.getId()) return true;
+
+  // Check that all motions requiring computation are available.
+  for (const auto& legMotion : step.legMotions_) {
+    if (!legMotion.second->needsComputation()) continue;
+    if (!precomputedStep.hasLegMotion(legMotion.first)) return true;
+    if (!precomputedStep.getLegMotion(legMotion.first).isComputed()) return true;
+  }
+  if (step.baseMotion_ && step.baseMotion_->needsComputation()) {
+    if (!precomputedStep.hasBaseMotion() || !precomputedStep.getBaseMotion().isComputed()) return true;
+  }
+
+  for (auto& legMotion : step.legMotions_) {
+    if (!legMotion.second->needsComputation()) continue;
+    const bool hasContactAtStart = legMotion.second->hasContactAtStart_;
+    legMotion.second = precomputedStep.getLegMotion(legMotion.first).clone();
+    legMotion.second->hasContactAtStart_ = hasContactAtStart;
+  }
+  if (step.baseMotion_ && step.baseMotion_->needsComputation()) {
+    step.baseMotion_ = precomputedStep.getBaseMotion().clone();
+  }
+  step.isComputed_ = true;
+  return true;
+}
+
+bool StepCompleter::completeJointMotions(const State& state, Step& step) const
+{
+  for (auto& legMotion : step.legMotions_) {
+    if (legMotion.second->getTrajectoryType() != LegMotionBase::TrajectoryType::Joints) continue;
+    setParameters(*legMotion.second);
+    if (legMotion.second->getType() == LegMotionBase::Type::JointTrajectory) {
+      setParameters(static_cast<JointTrajectory&>(*legMotion.second));
+    }
+    if (!complete(state, step, static_cast<JointMotionBase&>(*legMotion.second))) return false;
+  }
+  return true;
+}
+
 bool StepCompleter::complete(const State& state, const Step& step, EndEffectorMotionBase& endEffectorMotion) const
 {
   // Input.
@@ -82,7 +135,7 @@ bool StepCompleter::complete(const State& state, const Step& step, EndEffectorMo
 //  bool effortIn = controlSetupIn.at(ControlLevel::Effort);
 
   // Output.
-  ControlSetup controlSetupOut = endEffectorMotion.getControlSetup();
+  const ControlSetup& controlSetupOut = endEffectorMotion.getControlSetup();
   bool positionOut = controlSetupOut.at(ControlLevel::Position);
   bool velocityOut = controlSetupOut.at(ControlLevel::Velocity);
   bool accelerationOut = controlSetupOut.at(ControlLevel::Acceleration);
@@ -120,14 +173,14 @@ bool StepCompleter::complete(const State& state, const Step& step, EndEffectorMo
 bool StepCompleter::complete(const State& state, const Step& step, JointMotionBase& jointMotion) const
 {
   // Input.
-  ControlSetup controlSetupIn = state.getControlSetup(jointMotion.getLimb());
+  const ControlSetup& controlSetupIn = state.getControlSetup(jointMotion.getLimb());
   bool positionIn = controlSetupIn.at(ControlLevel::Position);
   bool velocityIn = controlSetupIn.at(ControlLevel::Velocity);
   bool accelerationIn = controlSetupIn.at(ControlLevel::Acceleration);
   bool effortIn = controlSetupIn.at(ControlLevel::Effort);
 
   // Output.
-  ControlSetup controlSetupOut = jointMotion.getControlSetup();
+  const ControlSetup& controlSetupOut = jointMotion.getControlSetup();
   bool positionOut = controlSetupOut.at(ControlLevel::Position);
   bool velocityOut = controlSetupOut.at(ControlLevel::Velocity);
   bool accelerationOut = controlSetupOut.at(ControlLevel::Acceleration);
@@ -212,6 +265,11 @@ void StepCompleter::setParameters(Footstep& footstep) const
   footstep.liftOffSpeed_ = parameters.liftOffSpeed;
   footstep.touchdownSpeed_ = parameters.touchdownSpeed;
   footstep.minimumDuration_ = parameters.minimumDuration;
+
+  if (footstep.samplingTimeStep_ == 0.0) {
+    footstep.samplingTimeStep_ = parameters_.samplingParameters.timeStep;
+    footstep.samplingInterpolation_ = parameters_.samplingParameters.interpolation;
+  }
 }
 
 void StepCompleter::setParameters(EndEffectorTarget& endEffectorTarget) const
@@ -224,19 +282,39 @@ void StepCompleter::setParameters(EndEffectorTarget& endEffectorTarget) const
   endEffectorTarget.minimumDuration_ = parameters.minimumDuration;
 }
 
+void StepCompleter::setParameters(EndEffectorTrajectory& endEffectorTrajectory) const
+{
+  const auto& parameters = parameters_.samplingParameters;
+
+  if (endEffectorTrajectory.samplingTimeStep_ == 0.0) {
+    endEffectorTrajectory.samplingTimeStep_ = parameters.timeStep;
+    endEffectorTrajectory.samplingInterpolation_ = parameters.interpolation;
+  }
+}
+
+void StepCompleter::setParameters(JointTrajectory& jointTrajectory) const
+{
+  const auto& parameters = parameters_.samplingParameters;
+
+  if (jointTrajectory.samplingTimeStep_ == 0.0) {
+    jointTrajectory.samplingTimeStep_ = parameters.timeStep;
+    jointTrajectory.samplingInterpolation_ = parameters.interpolation;
+  }
+}
+
 void StepCompleter::setParameters(LegMode& legMode) const
 {
   const auto& parameters = parameters_.legModeParameters;
 
   if (legMode.duration_ == 0.0)
     legMode.duration_ = parameters.duration;
-  if (legMode.frameId_.empty())
-    legMode.frameId_ = parameters.frameId;
+  if (!adapter_.getFrameRegistry().isValid(legMode.frameId_))
+    legMode.frameId_ = adapter_.getFrameRegistry().intern(parameters.frameId);
 }
 
 void StepCompleter::setParameters(BaseAuto& baseAuto) const
 {
-  baseAuto.frameId_ =  adapter_.getWorldFrameId();
+  baseAuto.frameId_ = adapter_.getFrameRegistry().intern(adapter_.getWorldFrameId());
 
   const auto& parameters = parameters_.baseAutoParameters;
 
@@ -251,6 +329,14 @@ void StepCompleter::setParameters(BaseAuto& baseAuto) const
   if (baseAuto.supportMargin_ == 0.0)
     baseAuto.supportMargin_ = parameters.supportMargin;
   baseAuto.minimumDuration_ = parameters.minimumDuration;
+  baseAuto.maxOptimizationIterations_ = parameters.maxOptimizationIterations;
+  baseAuto.maxOptimizationDuration_ = parameters.maxOptimizationDuration;
+  baseAuto.persistentOptimization_ = getPersistentOptimization();
+
+  if (baseAuto.samplingTimeStep_ == 0.0) {
+    baseAuto.samplingTimeStep_ = parameters_.samplingParameters.timeStep;
+    baseAuto.samplingInterpolation_ = parameters_.samplingParameters.interpolation;
+  }
 
   baseAuto.nominalPlanarStanceInBaseFrame_.clear();
   baseAuto.nominalPlanarStanceInBaseFrame_ = parameters.nominalPlanarStanceInBaseFrame;
@@ -274,5 +360,17 @@ void StepCompleter::setParameters(BaseTrajectory& baseTrajectory) const
 //    baseAuto.controllerType_ = parameters.controllerType;
 }
 
-} /* namespace */
+std::shared_ptr<BaseAuto::PersistentOptimization> StepCompleter::getPersistentOptimization() const
+{
+  std::call_once(persistentOptimizationFlag_, [this]() {
+    std::unique_ptr<AdapterBase> adapter = adapter_.clone();
+    if (!adapter) return;
+    std::shared_ptr<BaseAuto::PersistentOptimization> optimization(new BaseAuto::PersistentOptimization());
+    optimization->adapter = std::move(adapter);
+    optimization->poseOptimizationSQP.reset(new PoseOptimizationSQP(*optimization->adapter));
+    persistentOptimization_ = optimization;
+  });
+  return persistentOptimization_;
+}
 
+} /* namespace */
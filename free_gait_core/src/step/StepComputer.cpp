@@ -56,5 +56,29 @@ void StepComputer::getStep(Step& step)
   step = step_;
 }
 
+size_t StepComputer::getLookahead() const
+{
+  return 0;
+}
+
+bool StepComputer::precompute(const Step& step)
+{
+  return false;
+}
+
+bool StepComputer::hasPrecomputation(const std::string& stepId)
+{
+  return false;
+}
+
+bool StepComputer::getPrecomputedStep(const std::string& stepId, Step& step)
+{
+  return false;
+}
+
+void StepComputer::clearPrecomputations()
+{
+}
+
 } /* namespace */
 
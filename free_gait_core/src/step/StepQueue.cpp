@@ -9,10 +9,22 @@
 #include "free_gait_core/step/StepQueue.hpp"
 
 // STD
+#include <atomic>
 #include <stdexcept>
 
 namespace free_gait {
 
+namespace {
+
+//! Assigns the sequence number to a step that is queued for the first time.
+void assignSequenceNumber(uint64_t& sequenceNumber)
+{
+  static std::atomic<uint64_t> lastSequenceNumber(0);
+  if (sequenceNumber == 0) sequenceNumber = ++lastSequenceNumber;
+}
+
+}
+
 StepQueue::StepQueue()
     : active_(false),
       hasSwitchedStep_(false),
@@ -47,17 +59,21 @@ StepQueue& StepQueue::operator=(const StepQueue& other)
 void StepQueue::add(const Step& step)
 {
   queue_.push_back(step);
+  assignSequenceNumber(queue_.back().sequenceNumber_);
 }
 
 void StepQueue::add(const std::vector<Step> steps)
 {
   std::deque<Step>::iterator iterator = queue_.end();
+  const size_t nSteps = queue_.size();
   queue_.insert(iterator, steps.begin(), steps.end());
+  for (size_t i = nSteps; i < queue_.size(); ++i) assignSequenceNumber(queue_[i].sequenceNumber_);
 }
 
 void StepQueue::addInFront(const Step& step)
 {
   queue_.push_front(step);
+  assignSequenceNumber(queue_.front().sequenceNumber_);
   active_ = false;
 }
 
@@ -168,6 +184,7 @@ void StepQueue::replaceCurrentStep(const Step& step)
 {
   queue_.pop_front();
   queue_.push_front(step);
+  assignSequenceNumber(queue_.front().sequenceNumber_);
 }
 
 const Step& StepQueue::getNextStep() const
@@ -193,6 +210,11 @@ const Step& StepQueue::getPreviousStep() const
   return *previousStep_;
 }
 
+void StepQueue::setPreviousStep(const Step& step)
+{
+  previousStep_.reset(new Step(step));
+}
+
 std::deque<Step>::size_type StepQueue::size() const
 {
   return queue_.size();
@@ -0,0 +1,159 @@
+/*
+ * AdapterBaseTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#include "free_gait_core/TypeDefs.hpp"
+#include "free_gait_core/executor/FrameRegistry.hpp"
+#include "AdapterDummy.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STD
+#include <string>
+#include <vector>
+
+using namespace free_gait;
+
+void setBasePose(const AdapterDummy& adapter, const Position& position, const RotationQuaternion& orientation)
+{
+  State state(adapter.getState());
+  state.setPositionWorldToBaseInWorldFrame(position);
+  state.setOrientationBaseToWorld(orientation);
+  adapter.setInternalDataFromState(state);
+}
+
+TEST(frameRegistry, intern)
+{
+  FrameRegistry registry;
+  const FrameId odom = registry.intern("odom");
+  const FrameId base = registry.intern("base");
+  EXPECT_NE(odom, base);
+  EXPECT_EQ(odom, registry.intern("odom"));
+  EXPECT_EQ(base, registry.find("base"));
+  EXPECT_EQ(FrameRegistry::invalidFrameId, registry.find("map"));
+  EXPECT_EQ("base", registry.getName(base));
+  EXPECT_EQ("", registry.getName(FrameRegistry::invalidFrameId));
+  EXPECT_EQ(2u, registry.size());
+}
+
+TEST(frameRegistry, growsBeyondBlock)
+{
+  FrameRegistry registry;
+  std::vector<FrameId> frameIds;
+  for (size_t i = 0; i < 3 * FrameRegistry::blockSize + 1; ++i) {
+    frameIds.push_back(registry.intern("frame_" + std::to_string(i)));
+    ASSERT_NE(FrameRegistry::invalidFrameId, frameIds.back());
+  }
+  EXPECT_EQ(frameIds.size(), registry.size());
+  for (size_t i = 0; i < frameIds.size(); ++i) {
+    const std::string name = "frame_" + std::to_string(i);
+    EXPECT_EQ(frameIds[i], registry.intern(name));
+    EXPECT_EQ(frameIds[i], registry.find(name));
+    EXPECT_EQ(name, registry.getName(frameIds[i]));
+  }
+}
+
+TEST(frameRegistry, description)
+{
+  FrameRegistry registry;
+  const FrameId odom = registry.internOrThrow("odom");
+  EXPECT_EQ(odom, registry.intern("odom"));
+  EXPECT_EQ("'odom'", registry.getDescription(odom));
+  EXPECT_NE(std::string::npos, registry.getDescription(FrameRegistry::invalidFrameId).find("not registered"));
+}
+
+TEST(adapterBase, cachedFrameTransforms)
+{
+  AdapterDummy adapter;
+  const RotationQuaternion orientation(RotationMatrix(EulerAnglesZyx(0.5, 0.1, -0.2)));
+  setBasePose(adapter, Position(1.0, 2.0, 0.5), orientation);
+  const FrameId world = adapter.getFrameRegistry().intern(adapter.getWorldFrameId());
+  const FrameId base = adapter.getFrameRegistry().intern(adapter.getBaseFrameId());
+  adapter.resetFrameTransformCache();
+
+  EXPECT_TRUE(adapter.frameIdExists(world));
+  EXPECT_FALSE(adapter.frameIdExists(adapter.getFrameRegistry().intern("unknown")));
+  EXPECT_FALSE(adapter.frameIdExists(FrameRegistry::invalidFrameId));
+
+  const Position position(0.3, -0.2, 0.1);
+  const Vector vector(0.1, 0.4, -0.3);
+  for (const auto& frames : {std::make_pair(world, base), std::make_pair(base, world),
+      std::make_pair(world, world), std::make_pair(base, base)}) {
+    const std::string& input = adapter.getFrameRegistry().getName(frames.first);
+    const std::string& output = adapter.getFrameRegistry().getName(frames.second);
+    EXPECT_TRUE(adapter.transformPosition(input, output, position).vector().isApprox(
+        adapter.transformPosition(frames.first, frames.second, position).vector()));
+    EXPECT_TRUE(adapter.transformVector(input, output, vector).vector().isApprox(
+        adapter.transformVector(frames.first, frames.second, vector).vector()));
+  }
+  const Pose pose(position, RotationQuaternion(RotationMatrix(EulerAnglesZyx(0.2, 0.0, 0.0))));
+  const Pose poseInWorldFrame = adapter.transformPose(base, world, pose);
+  EXPECT_TRUE(poseInWorldFrame.getPosition().vector().isApprox(
+      adapter.transformPosition(adapter.getBaseFrameId(), adapter.getWorldFrameId(), position).vector()));
+  EXPECT_NEAR(0.0, poseInWorldFrame.getRotation().getDisparityAngle(orientation * pose.getRotation()), 1e-10);
+
+  // Changing the base pose invalidates the cached transforms.
+  setBasePose(adapter, Position(-1.0, 0.0, 0.5), orientation);
+  EXPECT_TRUE(adapter.transformPosition(adapter.getBaseFrameId(), adapter.getWorldFrameId(), position).vector().isApprox(
+      adapter.transformPosition(base, world, position).vector()));
+  EXPECT_THROW(adapter.transformPosition(adapter.getFrameRegistry().intern("unknown"), world, position),
+               std::invalid_argument);
+}
+
+TEST(adapterBase, cachedMapFrameTransforms)
+{
+  //! Adapter with a map frame.
+  class MapAdapterDummy : public AdapterDummy
+  {
+   public:
+    virtual Pose getFrameTransform(const std::string& frameId) const
+    {
+      return Pose(Position(2.0, -1.0, 0.1), RotationQuaternion(RotationMatrix(EulerAnglesZyx(0.7, 0.0, 0.0))));
+    }
+  };
+
+  MapAdapterDummy adapter;
+  setBasePose(adapter, Position(1.0, 2.0, 0.5), RotationQuaternion(RotationMatrix(EulerAnglesZyx(0.5, 0.1, -0.2))));
+  const FrameId world = adapter.getFrameRegistry().intern(adapter.getWorldFrameId());
+  const FrameId base = adapter.getFrameRegistry().intern(adapter.getBaseFrameId());
+  const FrameId map = adapter.getFrameRegistry().intern("map");
+  adapter.resetFrameTransformCache();
+
+  const Position position(0.3, -0.2, 0.1);
+  const Vector vector(0.1, 0.4, -0.3);
+  for (const auto& frames : {std::make_pair(world, map), std::make_pair(map, world),
+      std::make_pair(base, map), std::make_pair(map, base)}) {
+    const std::string& input = adapter.getFrameRegistry().getName(frames.first);
+    const std::string& output = adapter.getFrameRegistry().getName(frames.second);
+    EXPECT_TRUE(adapter.transformPosition(input, output, position).vector().isApprox(
+        adapter.transformPosition(frames.first, frames.second, position).vector()));
+    EXPECT_TRUE(adapter.transformVector(input, output, vector).vector().isApprox(
+        adapter.transformVector(frames.first, frames.second, vector).vector()));
+  }
+
+  // Vectors are rotated like positions.
+  const Position origin = adapter.transformPosition(world, map, Position());
+  EXPECT_TRUE(adapter.transformVector(world, map, vector).vector().isApprox(
+      (adapter.transformPosition(world, map, Position(vector.vector())) - origin).vector()));
+}
+
+TEST(adapterBase, cachedFrameTransformsBeyondBlock)
+{
+  AdapterDummy adapter;
+  const FrameId world = adapter.getFrameRegistry().intern(adapter.getWorldFrameId());
+  for (size_t i = 0; i < 2 * FrameRegistry::blockSize; ++i) {
+    adapter.getFrameRegistry().intern("cached_frame_" + std::to_string(i));
+  }
+  const FrameId base = adapter.getFrameRegistry().intern("cached_frame_base");
+  ASSERT_GE(base, FrameRegistry::blockSize);
+  ASSERT_NE(FrameRegistry::invalidFrameId, base);
+  adapter.resetFrameTransformCache();
+  EXPECT_TRUE(adapter.frameIdExists(world));
+  EXPECT_FALSE(adapter.frameIdExists(base));
+  const Position position(0.3, -0.2, 0.1);
+  EXPECT_EQ(position, adapter.transformPosition(world, world, position));
+}
@@ -16,6 +16,7 @@ AdapterDummy::AdapterDummy()
       baseFrameId_("base")
 {
   state_.reset(new State());
+  stateCopy_.reset(new State());
 
   limbs_.push_back(LimbEnum::LF_LEG);
   limbs_.push_back(LimbEnum::RF_LEG);
@@ -33,6 +34,23 @@ AdapterDummy::~AdapterDummy()
 {
 }
 
+std::unique_ptr<AdapterBase> AdapterDummy::clone() const
+{
+  std::unique_ptr<AdapterDummy> adapter(new AdapterDummy());
+  *(adapter->state_) = *state_;
+  *(adapter->stateCopy_) = *stateCopy_;
+  return std::move(adapter);
+}
+
+bool AdapterDummy::updateClone(AdapterBase& clone) const
+{
+  AdapterDummy* adapter = dynamic_cast<AdapterDummy*>(&clone);
+  if (!adapter) return false;
+  *(adapter->state_) = *state_;
+  *(adapter->stateCopy_) = *stateCopy_;
+  return true;
+}
+
 bool AdapterDummy::resetExtrasWithRobot(const StepQueue& stepQueue, State& state)
 {
   return true;
@@ -97,13 +115,15 @@ bool AdapterDummy::getLimbJointPositionsFromPositionBaseToFootInBaseFrame(
     const Position& positionBaseToFootInBaseFrame, const LimbEnum& limb,
     JointPositionsLeg& jointPositions) const
 {
-  throw std::runtime_error("AdapterDummy::getLimbJointPositionsFromPositionBaseToFootInBaseFrame() is not implemented.");
+  // Cartesian legs: The joint positions are the position of the foot relative to the hip.
+  jointPositions = JointPositionsLeg((positionBaseToFootInBaseFrame - getPositionBaseToHipInBaseFrame(limb)).vector());
+  return true;
 }
 
 Position AdapterDummy::getPositionBaseToFootInBaseFrame(
     const LimbEnum& limb, const JointPositionsLeg& jointPositions) const
 {
-  throw std::runtime_error("AdapterDummy::getPositionBaseToFootInBaseFrame() is not implemented.");
+  return getPositionBaseToHipInBaseFrame(limb) + Position(jointPositions.vector());
 }
 
 Position AdapterDummy::getPositionBaseToHipInBaseFrame(const LimbEnum& limb) const
@@ -124,12 +144,12 @@ Position AdapterDummy::getPositionBaseToHipInBaseFrame(const LimbEnum& limb) con
 
 bool AdapterDummy::isExecutionOk() const
 {
-  throw std::runtime_error("AdapterDummy::isExecutionOk() is not implemented.");
+  return true;
 }
 
 bool AdapterDummy::isLegGrounded(const LimbEnum& limb) const
 {
-  throw std::runtime_error("AdapterDummy::isLegGrounded() is not implemented.");
+  return true;
 }
 
 JointPositionsLeg AdapterDummy::getJointPositionsForLimb(const LimbEnum& limb) const
@@ -204,12 +224,12 @@ AngularAcceleration AdapterDummy::getAngularAccelerationBaseInBaseFrame() const
 
 Position AdapterDummy::getPositionBaseToFootInBaseFrame(const LimbEnum& limb) const
 {
-  throw std::runtime_error("AdapterDummy::getPositionBaseToFootInBaseFrame() is not implemented.");
+  return getPositionBaseToFootInBaseFrame(limb, state_->getJointPositionsForLimb(limb));
 }
 
 Position AdapterDummy::getPositionWorldToFootInWorldFrame(const LimbEnum& limb) const
 {
-  throw std::runtime_error("AdapterDummy::getPositionWorldToFootInWorldFrame() is not implemented.");
+  return transformPosition(baseFrameId_, worldFrameId_, getPositionBaseToFootInBaseFrame(limb));
 }
 
 Position AdapterDummy::getCenterOfMassInWorldFrame() const
@@ -229,40 +249,60 @@ Pose AdapterDummy::getFrameTransform(const std::string& frameId) const
 
 ControlSetup AdapterDummy::getControlSetup(const BranchEnum& branch) const
 {
-  throw std::runtime_error("AdapterDummy::getControlSetup() is not implemented.");
+  ControlSetup controlSetup;
+  controlSetup[ControlLevel::Position] = true;
+  controlSetup[ControlLevel::Velocity] = false;
+  controlSetup[ControlLevel::Acceleration] = false;
+  controlSetup[ControlLevel::Effort] = false;
+  return controlSetup;
 }
 
 ControlSetup AdapterDummy::getControlSetup(const LimbEnum& limb) const
 {
-  throw std::runtime_error("AdapterDummy::getControlSetup() is not implemented.");
+  return getControlSetup(QD::mapEnums<QD::BranchEnum>(limb));
 }
 
 //! State depending on real robot.
 JointVelocitiesLeg AdapterDummy::getJointVelocitiesFromEndEffectorLinearVelocityInWorldFrame(
     const LimbEnum& limb, const LinearVelocity& endEffectorLinearVelocityInWorldFrame) const
 {
-  throw std::runtime_error("AdapterDummy::getJointVelocitiesFromEndEffectorLinearVelocityInWorldFrame() is not implemented.");
+  const LinearVelocity velocityInBaseFrame(
+      transformLinearVelocity(worldFrameId_, baseFrameId_, endEffectorLinearVelocityInWorldFrame));
+  return JointVelocitiesLeg(velocityInBaseFrame.vector());
 }
 
 LinearVelocity AdapterDummy::getEndEffectorLinearVelocityFromJointVelocities(const LimbEnum& limb,
                                                                        const JointVelocitiesLeg& jointVelocities,
                                                                        const std::string& frameId) const
 {
-  throw std::runtime_error("AdapterDummy::getEndEffectorLinearVelocityFromJointVelocities() is not implemented.");
+  return transformLinearVelocity(baseFrameId_, frameId, LinearVelocity(jointVelocities.vector()));
 }
 
 JointAccelerationsLeg AdapterDummy::getJointAccelerationsFromEndEffectorLinearAccelerationInWorldFrame(
     const LimbEnum& limb, const LinearAcceleration& endEffectorLinearAccelerationInWorldFrame) const
 {
-  throw std::runtime_error("AdapterDummy::getJointAccelerationsFromEndEffectorLinearAccelerationInWorldFrame() is not implemented.");
+  const LinearAcceleration accelerationInBaseFrame(
+      transformLinearAcceleration(worldFrameId_, baseFrameId_, endEffectorLinearAccelerationInWorldFrame));
+  return JointAccelerationsLeg(accelerationInBaseFrame.vector());
 }
 
-bool AdapterDummy::setInternalDataFromState(const State& state) const
+bool AdapterDummy::setInternalDataFromState(const State& state, bool updateContacts, bool updatePosition,
+                                            bool updateVelocity, bool updateAcceleration) const
 {
   *state_ = state;
   return true;
 }
 
+void AdapterDummy::createCopyOfState() const
+{
+  *stateCopy_ = *state_;
+}
+
+void AdapterDummy::resetToCopyOfState() const
+{
+  *state_ = *stateCopy_;
+}
+
 const State& AdapterDummy::getState() const
 {
   return *state_;
@@ -14,11 +14,18 @@
 
 namespace free_gait {
 
+/*!
+ * Adapter for tests and benchmarks without robot model. The legs are modeled
+ * as Cartesian legs, i.e. the joint positions of a leg are the position of the
+ * foot relative to the hip in base frame.
+ */
 class AdapterDummy : public AdapterBase
 {
  public:
   AdapterDummy();
   virtual ~AdapterDummy();
+  virtual std::unique_ptr<AdapterBase> clone() const;
+  virtual bool updateClone(AdapterBase& clone) const;
 
   //! Copying data from real robot to free gait state.
   virtual bool resetExtrasWithRobot(const StepQueue& stepQueue, State& state);
@@ -83,12 +90,16 @@ class AdapterDummy : public AdapterBase
       const LimbEnum& limb, const LinearAcceleration& endEffectorLinearAccelerationInWorldFrame) const;
 
   //! Hook to write data to internal robot representation from state.
-  virtual bool setInternalDataFromState(const State& state) const;
+  virtual bool setInternalDataFromState(const State& state, bool updateContacts = true, bool updatePosition = true,
+                                        bool updateVelocity = true, bool updateAcceleration = false) const;
+  virtual void createCopyOfState() const;
+  virtual void resetToCopyOfState() const;
 
   const State& getState() const;
 
  private:
   std::unique_ptr<State> state_;
+  std::unique_ptr<State> stateCopy_;
   std::vector<LimbEnum> limbs_;
   std::vector<BranchEnum> branches_;
   const std::string worldFrameId_;
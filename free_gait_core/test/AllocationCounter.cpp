@@ -0,0 +1,75 @@
+/*
+ * AllocationCounter.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#include "AllocationCounter.hpp"
+
+// STD
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<bool> isCounting(false);
+std::atomic<size_t> nAllocations(0);
+
+void* countedAllocation(std::size_t size)
+{
+  if (isCounting.load(std::memory_order_relaxed)) {
+    nAllocations.fetch_add(1, std::memory_order_relaxed);
+  }
+  void* pointer = std::malloc(size == 0 ? 1 : size);
+  if (!pointer) throw std::bad_alloc();
+  return pointer;
+}
+
+} // namespace
+
+void* operator new(std::size_t size)
+{
+  return countedAllocation(size);
+}
+
+void* operator new[](std::size_t size)
+{
+  return countedAllocation(size);
+}
+
+void operator delete(void* pointer) noexcept
+{
+  std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+  std::free(pointer);
+}
+
+namespace free_gait {
+
+AllocationCounter::AllocationCounter()
+{
+  nAllocations.store(0);
+  isCounting.store(true);
+}
+
+AllocationCounter::~AllocationCounter()
+{
+  stop();
+}
+
+void AllocationCounter::stop()
+{
+  isCounting.store(false);
+}
+
+size_t AllocationCounter::getNumberOfAllocations() const
+{
+  return nAllocations.load();
+}
+
+} /* namespace free_gait */
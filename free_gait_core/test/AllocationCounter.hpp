@@ -0,0 +1,36 @@
+/*
+ * AllocationCounter.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace free_gait {
+
+/*!
+ * Counts the heap allocations of the test binary while it is in scope.
+ * Used to check that the real-time path of the executor does not allocate.
+ */
+class AllocationCounter
+{
+ public:
+  AllocationCounter();
+  virtual ~AllocationCounter();
+
+  /*!
+   * Stops counting, subsequent allocations are ignored.
+   */
+  void stop();
+
+  /*!
+   * Returns the number of allocations since construction (or until stop()).
+   * @return the number of allocations.
+   */
+  size_t getNumberOfAllocations() const;
+};
+
+} /* namespace free_gait */
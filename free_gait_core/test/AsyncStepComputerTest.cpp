@@ -0,0 +1,162 @@
+/*
+ * AsyncStepComputerTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#include "free_gait_core/TypeDefs.hpp"
+#include "free_gait_core/executor/Executor.hpp"
+#include "free_gait_core/leg_motion/JointTrajectory.hpp"
+#include "free_gait_core/step/AsyncStepComputer.hpp"
+#include "AdapterDummy.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+using namespace free_gait;
+
+Step createJointTrajectoryStep(const LimbEnum& limb, const JointPositionsLeg& target)
+{
+  std::unordered_map<ControlLevel, std::vector<JointTrajectory::Time>, EnumClassHash> times;
+  times[ControlLevel::Position].push_back(1.0);
+  std::unordered_map<ControlLevel, std::vector<std::vector<JointTrajectory::ValueType>>, EnumClassHash> values;
+  for (size_t i = 0; i < 3; ++i) values[ControlLevel::Position].push_back({target(i)});
+  JointTrajectory jointTrajectory(limb);
+  jointTrajectory.setTrajectory(times, values, std::vector<JointNodeEnum>());
+  Step step;
+  step.addLegMotion(jointTrajectory);
+  return step;
+}
+
+TEST(asyncStepComputer, computeInBackground)
+{
+  AsyncStepComputer computer(2);
+  ASSERT_TRUE(computer.initialize());
+  Step step = createJointTrajectoryStep(LimbEnum::LF_LEG, JointPositionsLeg(Eigen::Vector3d(0.1, 0.2, 0.3)));
+  State state;
+  AdapterDummy adapter;
+  StepParameters parameters;
+  StepCompleter completer(parameters, adapter);
+  state.initialize(adapter.getLimbs(), adapter.getBranches());
+  ASSERT_TRUE(completer.completeJointMotions(state, step));
+
+  computer.setStep(step);
+  ASSERT_TRUE(computer.compute());
+  ASSERT_TRUE(computer.waitUntilIdle(1.0));
+  ASSERT_TRUE(computer.isDone());
+  EXPECT_FALSE(computer.isBusy());
+
+  Step computedStep;
+  computer.getStep(computedStep);
+  computer.resetIsDone();
+  EXPECT_FALSE(computer.isDone());
+  EXPECT_TRUE(computedStep.isComputed());
+  const auto& jointMotion = dynamic_cast<const JointMotionBase&>(computedStep.getLegMotion(LimbEnum::LF_LEG));
+  EXPECT_NEAR(0.3, jointMotion.evaluatePosition(1.0)(2), 1e-6);
+}
+
+TEST(asyncStepComputer, executorUsesPrecomputedSteps)
+{
+  AdapterDummy adapter;
+  State state;
+  StepParameters parameters;
+  StepCompleter completer(parameters, adapter);
+  AsyncStepComputer computer(1, 1);
+  Executor executor(completer, computer, adapter, state);
+  ASSERT_TRUE(executor.initialize());
+  ASSERT_TRUE(executor.advance(0.01)); // Resets the executor.
+
+  const JointPositionsLeg target(Eigen::Vector3d(0.2, 0.4, 0.6));
+  executor.getQueue().add(createJointTrajectoryStep(LimbEnum::LF_LEG, JointPositionsLeg(Eigen::Vector3d(0.1, 0.2, 0.3))));
+  executor.getQueue().add(createJointTrajectoryStep(LimbEnum::LF_LEG, target));
+
+  // The executor advances while the steps are computed in the background.
+  // Waiting for the computations after each advance makes the test
+  // deterministic, the precomputation is finished before the step switch.
+  bool success = true;
+  for (size_t i = 0; i < 1000 && (executor.getQueue().active() || !executor.getQueue().empty()); ++i) {
+    success = executor.advance(0.01) && success;
+    ASSERT_TRUE(computer.waitUntilIdle(1.0));
+  }
+  ASSERT_TRUE(success);
+  EXPECT_TRUE(executor.getQueue().empty());
+  bool isPrecomputedStepUsed = false;
+  uint64_t sequence = 0, nDropped;
+  ExecutorFeedbackEvent event;
+  while (executor.getFeedback().read(sequence, event, nDropped)) {
+    if (event.type == ExecutorFeedbackEvent::Type::UsingPrecomputedStep) isPrecomputedStepUsed = true;
+  }
+  EXPECT_TRUE(isPrecomputedStepUsed);
+  for (size_t i = 0; i < 3; ++i) {
+    EXPECT_NEAR(target(i), executor.getState().getJointPositionsForLimb(LimbEnum::LF_LEG)(i), 1e-3);
+  }
+}
+
+TEST(asyncStepComputer, computationThrows)
+{
+  AsyncStepComputer computer(1);
+  ASSERT_TRUE(computer.initialize());
+
+  // The times of the position values are missing.
+  std::unordered_map<ControlLevel, std::vector<JointTrajectory::Time>, EnumClassHash> times;
+  times[ControlLevel::Velocity].push_back(1.0);
+  std::unordered_map<ControlLevel, std::vector<std::vector<JointTrajectory::ValueType>>, EnumClassHash> values;
+  for (size_t i = 0; i < 3; ++i) values[ControlLevel::Position].push_back({0.1});
+  JointTrajectory jointTrajectory(LimbEnum::LF_LEG);
+  jointTrajectory.setTrajectory(times, values, std::vector<JointNodeEnum>());
+  Step step;
+  step.addLegMotion(jointTrajectory);
+
+  computer.setStep(step);
+  ASSERT_TRUE(computer.compute());
+  ASSERT_TRUE(computer.waitUntilIdle(1.0));
+  ASSERT_TRUE(computer.isDone());
+  Step computedStep;
+  computer.getStep(computedStep);
+  EXPECT_FALSE(computedStep.isComputed());
+}
+
+TEST(asyncStepComputer, executorIgnoresPrecomputationsOfReplacedSteps)
+{
+  AdapterDummy adapter;
+  State state;
+  StepParameters parameters;
+  StepCompleter completer(parameters, adapter);
+  AsyncStepComputer computer(1, 1);
+  Executor executor(completer, computer, adapter, state);
+  ASSERT_TRUE(executor.initialize());
+  ASSERT_TRUE(executor.advance(0.01)); // Resets the executor.
+
+  executor.getQueue().add(createJointTrajectoryStep(LimbEnum::LF_LEG, JointPositionsLeg(Eigen::Vector3d(0.1, 0.2, 0.3))));
+  Step replacedStep = createJointTrajectoryStep(LimbEnum::LF_LEG, JointPositionsLeg(Eigen::Vector3d(0.2, 0.4, 0.6)));
+  replacedStep.setId("next");
+  executor.getQueue().add(replacedStep);
+  for (size_t i = 0; i < 100 && !computer.hasPrecomputation("next"); ++i) {
+    ASSERT_TRUE(executor.advance(0.01));
+    ASSERT_TRUE(computer.waitUntilIdle(1.0));
+  }
+  ASSERT_TRUE(computer.hasPrecomputation("next"));
+
+  // A different step with the same id replaces the precomputed step.
+  const JointPositionsLeg target(Eigen::Vector3d(-0.1, 0.1, 0.2));
+  Step step = createJointTrajectoryStep(LimbEnum::LF_LEG, target);
+  step.setId("next");
+  executor.getQueue().clearNextSteps();
+  executor.getQueue().add(step);
+
+  bool success = true;
+  for (size_t i = 0; i < 1000 && (executor.getQueue().active() || !executor.getQueue().empty()); ++i) {
+    success = executor.advance(0.01) && success;
+    ASSERT_TRUE(computer.waitUntilIdle(1.0));
+  }
+  ASSERT_TRUE(success);
+  uint64_t sequence = 0, nDropped;
+  ExecutorFeedbackEvent event;
+  while (executor.getFeedback().read(sequence, event, nDropped)) {
+    EXPECT_NE(ExecutorFeedbackEvent::Type::UsingPrecomputedStep, event.type);
+  }
+  for (size_t i = 0; i < 3; ++i) {
+    EXPECT_NEAR(target(i), executor.getState().getJointPositionsForLimb(LimbEnum::LF_LEG)(i), 1e-3);
+  }
+}
@@ -0,0 +1,286 @@
+/*
+ * BatchExecutorTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#include "free_gait_core/TypeDefs.hpp"
+#include "free_gait_core/executor/BatchExecutor.hpp"
+#include "free_gait_core/executor/CandidateEvaluator.hpp"
+#include "ExecutorFixture.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STD
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <future>
+
+using namespace free_gait;
+
+namespace {
+
+void processAndWait(BatchExecutor& batchExecutor, const std::vector<Step>& steps)
+{
+  ASSERT_TRUE(batchExecutor.submit(steps).get());
+}
+
+class BatchExecutorFixture : public ExecutorFixture
+{
+ protected:
+  BatchExecutorFixture()
+      : batchExecutor(executor)
+  {
+  }
+
+  BatchExecutor batchExecutor;
+};
+
+}
+
+TEST_F(BatchExecutorFixture, parallelMatchesSerial)
+{
+  const std::vector<Step> steps = createBaseTrajectorySteps(adapter, 6);
+
+  // Parallel processing is opt-in.
+  EXPECT_EQ(1u, batchExecutor.getNumberOfThreads());
+  processAndWait(batchExecutor, steps);
+  const StateBatch serialBatch = batchExecutor.getStateBatch();
+
+  batchExecutor.setAdapterFactory([]() {return std::unique_ptr<AdapterBase>(new AdapterDummy());});
+  batchExecutor.setNumberOfThreads(3);
+  processAndWait(batchExecutor, steps);
+  const StateBatch& parallelBatch = batchExecutor.getStateBatch();
+
+  ASSERT_EQ(serialBatch.size(), parallelBatch.size());
+  for (size_t i = 0; i < serialBatch.size(); ++i) {
+    EXPECT_NEAR(serialBatch.getTimes()[i], parallelBatch.getTimes()[i], 1e-9);
+    EXPECT_NEAR(serialBatch.getPositionsWorldToBaseInWorldFrame()[i].x(),
+                parallelBatch.getPositionsWorldToBaseInWorldFrame()[i].x(), 1e-9);
+    EXPECT_EQ(serialBatch.getStepIdAtIndex(i), parallelBatch.getStepIdAtIndex(i));
+  }
+  // Last sample is after the queue ran empty.
+  EXPECT_NEAR(0.6, parallelBatch.getPositionsWorldToBaseInWorldFrame()[parallelBatch.size() - 2].x(), 1e-3);
+}
+
+TEST_F(BatchExecutorFixture, parallelWithAdapterClones)
+{
+  batchExecutor.setComputeDerivedData(true);
+  const std::vector<Step> steps = createBaseTrajectorySteps(adapter, 4);
+
+  batchExecutor.setNumberOfThreads(1);
+  processAndWait(batchExecutor, steps);
+  const StateBatch serialBatch = batchExecutor.takeStateBatch();
+  EXPECT_TRUE(batchExecutor.getStateBatch().empty());
+  EXPECT_EQ(serialBatch.size(), serialBatch.getEndEffectorPositions().front().size());
+
+  // Without factory, the executor's adapter is cloned.
+  batchExecutor.setNumberOfThreads(2);
+  processAndWait(batchExecutor, steps);
+  const StateBatch& parallelBatch = batchExecutor.getStateBatch();
+  ASSERT_EQ(serialBatch.size(), parallelBatch.size());
+  EXPECT_NEAR(serialBatch.getPositionsWorldToBaseInWorldFrame()[serialBatch.size() - 2].x(),
+              parallelBatch.getPositionsWorldToBaseInWorldFrame()[parallelBatch.size() - 2].x(), 1e-9);
+  EXPECT_EQ(parallelBatch.size(), parallelBatch.getEndEffectorPositions().front().size());
+  EXPECT_EQ(serialBatch.getStances().size(), parallelBatch.getStances().size());
+}
+
+TEST_F(BatchExecutorFixture, streaming)
+{
+  batchExecutor.setComputeDerivedData(true);
+  const std::vector<Step> steps = createBaseTrajectorySteps(adapter, 4);
+
+  for (const double chunkDuration : {0.0, 0.25}) {
+    for (const size_t nThreads : {1, 2}) {
+      size_t nCallbacks = 0;
+      bool isProcessingDuringCallbacks = true;
+      batchExecutor.addChunkCallback([&](const StateBatchStream::Chunk&) {
+        ++nCallbacks;
+        isProcessingDuringCallbacks = isProcessingDuringCallbacks && batchExecutor.isProcessing();
+      });
+      batchExecutor.setStreaming(true, chunkDuration);
+      batchExecutor.setNumberOfThreads(nThreads);
+      processAndWait(batchExecutor, steps);
+
+      const auto stream = batchExecutor.getStream();
+      EXPECT_TRUE(stream->isComplete());
+      EXPECT_TRUE(isProcessingDuringCallbacks);
+      const std::vector<StateBatchStream::Chunk> chunks = stream->getChunks();
+      EXPECT_EQ(nCallbacks, chunks.size());
+      EXPECT_LT(3u, chunks.size());
+      EXPECT_TRUE(stream->getChunks(chunks.size()).empty());
+
+      // Concatenated chunks equal the batch.
+      StateBatch stateBatch;
+      for (const auto& chunk : chunks) {
+        if (chunkDuration > 0.0 && chunk != chunks.back()) {
+          EXPECT_GE(chunkDuration, chunk->getEndTime() - chunk->getStartTime());
+        }
+        stateBatch.append(*chunk, 0.0);
+      }
+      const StateBatch& expectedStateBatch = batchExecutor.getStateBatch();
+      ASSERT_EQ(expectedStateBatch.size(), stateBatch.size());
+      for (size_t i = 0; i < stateBatch.size(); ++i) {
+        EXPECT_EQ(expectedStateBatch.getTimes()[i], stateBatch.getTimes()[i]);
+        EXPECT_EQ(expectedStateBatch.getStepIdAtIndex(i), stateBatch.getStepIdAtIndex(i));
+      }
+      EXPECT_EQ(stateBatch.size(), stateBatch.getEndEffectorPositions().front().size());
+      EXPECT_EQ(expectedStateBatch.getStances().size(), stateBatch.getStances().size());
+    }
+  }
+}
+
+TEST_F(BatchExecutorFixture, adaptiveTimeStep)
+{
+  batchExecutor.setNumberOfThreads(1);
+  const std::vector<Step> steps = createBaseTrajectorySteps(adapter, 4);
+
+  processAndWait(batchExecutor, steps);
+  const StateBatch fixedBatch = batchExecutor.getStateBatch();
+
+  AdaptiveTimeStepper::Parameters adaptiveParameters;
+  adaptiveParameters.minTimeStep = 0.1;
+  EXPECT_THROW(batchExecutor.setAdaptiveTimeStep(true, adaptiveParameters), std::invalid_argument);
+  adaptiveParameters.minTimeStep = 0.001;
+  adaptiveParameters.tolerance = 1e-4;
+  batchExecutor.setAdaptiveTimeStep(true, adaptiveParameters);
+  processAndWait(batchExecutor, steps);
+  const StateBatch adaptiveBatch = batchExecutor.getStateBatch();
+  EXPECT_GT(fixedBatch.size() / 4, adaptiveBatch.size());
+  EXPECT_NEAR(fixedBatch.getEndTime(), adaptiveBatch.getEndTime(), 4 * 0.001 + 1e-6);
+
+  // Linear interpolation of the adaptive samples matches the fixed samples
+  // (up to the different sampling of the step switches).
+  const auto& times = adaptiveBatch.getTimes();
+  const auto& positions = adaptiveBatch.getPositionsWorldToBaseInWorldFrame();
+  for (size_t i = 0; i < fixedBatch.size(); ++i) {
+    const double time = fixedBatch.getTimes()[i];
+    if (time <= times.front() || time >= times.back()) continue;
+    const size_t k = adaptiveBatch.getIndex(time);
+    const double phase = (time - times[k - 1]) / (times[k] - times[k - 1]);
+    const double x = (1.0 - phase) * positions[k - 1].x() + phase * positions[k].x();
+    EXPECT_NEAR(fixedBatch.getPositionsWorldToBaseInWorldFrame()[i].x(), x, 0.005);
+  }
+
+  // The ends of the steps are sampled exactly.
+  AdaptiveTimeStepper timeStepper(adaptiveParameters);
+  StepQueue queue;
+  queue.add(steps);
+  queue.advance(0.0);
+  queue.getCurrentStep().update();
+  while (queue.getCurrentStep().getTime() < queue.getCurrentStep().getTotalDuration()) {
+    const double timeStep = timeStepper.getTimeStep(queue);
+    EXPECT_GE(adaptiveParameters.maxTimeStep + adaptiveParameters.minTimeStep, timeStep);
+    queue.advance(timeStep);
+  }
+  EXPECT_EQ(queue.getCurrentStep().getTotalDuration(), queue.getCurrentStep().getTime());
+}
+
+TEST_F(BatchExecutorFixture, latestRequestWins)
+{
+  batchExecutor.setNumberOfThreads(1);
+
+  // Block the worker in the first chunk of the first request.
+  std::promise<void> started, release;
+  std::shared_future<void> released(release.get_future());
+  std::atomic<size_t> nChunks(0), nCallbacks(0);
+  batchExecutor.setStreaming(true);
+  batchExecutor.addChunkCallback([&](const StateBatchStream::Chunk&) {
+    if (nChunks++ > 0) return;
+    started.set_value();
+    released.wait();
+  });
+  batchExecutor.addProcessingCallback([&](bool) {++nCallbacks;});
+
+  std::future<bool> first = batchExecutor.submit(createBaseTrajectorySteps(adapter, 6));
+  started.get_future().wait();
+  std::future<bool> superseded = batchExecutor.submit(createBaseTrajectorySteps(adapter, 2));
+  std::future<bool> latest = batchExecutor.submit(createBaseTrajectorySteps(adapter, 3));
+  EXPECT_TRUE(batchExecutor.isProcessing());
+  EXPECT_FALSE(superseded.get());
+  release.set_value();
+  EXPECT_FALSE(first.get());
+  EXPECT_TRUE(latest.get());
+  EXPECT_FALSE(batchExecutor.isProcessing());
+  EXPECT_EQ(2u, nCallbacks);
+  const double expectedEndPosition = 0.3;
+  EXPECT_NEAR(expectedEndPosition, batchExecutor.getStateBatch().getPositionsWorldToBaseInWorldFrame().back().x(), 1e-3);
+
+  // Cancelling the waiting request.
+  std::future<bool> cancelled = batchExecutor.submit(createBaseTrajectorySteps(adapter, 2));
+  batchExecutor.cancelProcessing();
+  cancelled.get();
+  EXPECT_FALSE(batchExecutor.isProcessing());
+  const std::future<bool> afterCancelling = batchExecutor.submit(createBaseTrajectorySteps(adapter, 1));
+  EXPECT_EQ(std::future_status::ready, afterCancelling.wait_for(std::chrono::seconds(10)));
+}
+
+TEST(candidateEvaluator, supportMargin)
+{
+  const std::vector<Position> footholds{Position(1.0, 1.0, 0.0), Position(-1.0, 1.0, 0.1),
+                                        Position(-1.0, -1.0, 0.0), Position(1.0, -1.0, 0.0)};
+  EXPECT_NEAR(1.0, CandidateEvaluator::computeSupportMargin(footholds, Position(0.0, 0.0, 0.5)), 1e-10);
+  EXPECT_NEAR(0.5, CandidateEvaluator::computeSupportMargin(footholds, Position(0.5, 0.2, 0.5)), 1e-10);
+  EXPECT_NEAR(-1.0, CandidateEvaluator::computeSupportMargin(footholds, Position(2.0, 0.0, 0.5)), 1e-10);
+  const std::vector<Position> line{footholds[0], footholds[2]};
+  EXPECT_NEAR(0.0, CandidateEvaluator::computeSupportMargin(line, Position(0.0, 0.0, 0.5)), 1e-10);
+  EXPECT_NEAR(-std::sqrt(0.5), CandidateEvaluator::computeSupportMargin(line, Position(1.0, 0.0, 0.5)), 1e-10);
+  EXPECT_GT(0.0, CandidateEvaluator::computeSupportMargin({}, Position()));
+}
+
+TEST(candidateEvaluator, evaluate)
+{
+  AdapterDummy adapter;
+  State startState(adapter.getState());
+  for (const auto& limb : adapter.getLimbs()) startState.setSupportLeg(limb, true);
+  StepParameters parameters;
+  CandidateEvaluator evaluator(adapter, parameters);
+  JointPositions minJointPositions, maxJointPositions;
+  minJointPositions.vector().setConstant(-1.0);
+  maxJointPositions.vector().setConstant(1.0);
+  evaluator.setJointLimits(minJointPositions, maxJointPositions);
+  const std::vector<std::vector<Step>> candidates{createBaseTrajectorySteps(adapter, 2), createBaseTrajectorySteps(adapter, 4),
+                                                  createBaseTrajectorySteps(adapter, 3)};
+  const std::vector<double> durations{0.7, 1.8, 1.2};
+
+  std::vector<CandidateEvaluator::Summary> serialSummaries, summaries;
+  std::vector<StateBatch> stateBatches;
+  evaluator.setNumberOfThreads(1);
+  ASSERT_TRUE(evaluator.evaluate(candidates, startState, serialSummaries));
+  evaluator.setNumberOfThreads(3);
+  ASSERT_TRUE(evaluator.evaluate(candidates, startState, summaries, &stateBatches));
+  ASSERT_EQ(candidates.size(), summaries.size());
+  ASSERT_EQ(candidates.size(), stateBatches.size());
+
+  for (size_t i = 0; i < candidates.size(); ++i) {
+    const CandidateEvaluator::Summary& summary = summaries[i];
+    EXPECT_TRUE(summary.isValid);
+    EXPECT_NEAR(durations[i], summary.duration, 5.0 * evaluator.getTimeStep());
+    EXPECT_DOUBLE_EQ(serialSummaries[i].duration, summary.duration);
+    EXPECT_DOUBLE_EQ(serialSummaries[i].stabilityMargin, summary.stabilityMargin);
+    EXPECT_DOUBLE_EQ(serialSummaries[i].jointLimitMargin, summary.jointLimitMargin);
+    EXPECT_LT(0.0, summary.stabilityMargin);
+    EXPECT_LT(0.0, summary.jointLimitMargin);
+    EXPECT_GE(1.0, summary.jointLimitMargin);
+    EXPECT_NEAR(summary.duration, stateBatches[i].getEndTime(), 1e-10);
+    EXPECT_NEAR(0.1 * candidates[i].size(), stateBatches[i].getPositionsWorldToBaseInWorldFrame().back().x(), 1e-3);
+  }
+}
+
+TEST(candidateEvaluator, withoutAdapter)
+{
+  AdapterDummy adapter;
+  State startState(adapter.getState());
+  StepParameters parameters;
+  CandidateEvaluator evaluator(adapter, parameters);
+  evaluator.setAdapterFactory([]() {return std::unique_ptr<AdapterBase>();});
+  evaluator.setNumberOfThreads(2);
+  std::vector<CandidateEvaluator::Summary> summaries;
+  EXPECT_FALSE(evaluator.evaluate({createBaseTrajectorySteps(adapter, 2), createBaseTrajectorySteps(adapter, 3)}, startState, summaries));
+  ASSERT_EQ(2u, summaries.size());
+  EXPECT_FALSE(summaries[0].isValid);
+  EXPECT_FALSE(summaries[1].isValid);
+}
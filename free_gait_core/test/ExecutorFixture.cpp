@@ -0,0 +1,48 @@
+/*
+ * ExecutorFixture.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#include "ExecutorFixture.hpp"
+#include "free_gait_core/base_motion/BaseTrajectory.hpp"
+
+namespace free_gait {
+
+Step createBaseTrajectoryStep(const AdapterBase& adapter, const Position& position, const double duration)
+{
+  BaseTrajectory baseTrajectory;
+  std::unordered_map<ControlLevel, std::string, EnumClassHash> frameIds;
+  frameIds[ControlLevel::Position] = adapter.getWorldFrameId();
+  std::unordered_map<ControlLevel, std::vector<BaseTrajectory::Time>, EnumClassHash> times;
+  times[ControlLevel::Position].push_back(duration);
+  std::unordered_map<ControlLevel, std::vector<BaseTrajectory::ValueType>, EnumClassHash> values;
+  values[ControlLevel::Position].push_back(Pose(position, RotationQuaternion()));
+  baseTrajectory.setTrajectory(frameIds, times, values);
+  Step step;
+  step.addBaseMotion(baseTrajectory);
+  return step;
+}
+
+std::vector<Step> createBaseTrajectorySteps(const AdapterBase& adapter, const size_t nSteps)
+{
+  std::vector<Step> steps;
+  for (size_t i = 0; i < nSteps; ++i) {
+    steps.push_back(createBaseTrajectoryStep(adapter, Position(0.1 * (i + 1), 0.0, 0.5), 0.3 + 0.1 * i));
+  }
+  return steps;
+}
+
+ExecutorFixture::ExecutorFixture()
+    : completer(parameters, adapter),
+      executor(completer, computer, adapter, state)
+{
+}
+
+void ExecutorFixture::SetUp()
+{
+  ASSERT_TRUE(executor.initialize());
+}
+
+} /* namespace free_gait */
@@ -0,0 +1,61 @@
+/*
+ * ExecutorFixture.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#pragma once
+
+#include "free_gait_core/TypeDefs.hpp"
+#include "free_gait_core/executor/Executor.hpp"
+#include "free_gait_core/executor/State.hpp"
+#include "free_gait_core/step/Step.hpp"
+#include "free_gait_core/step/StepCompleter.hpp"
+#include "free_gait_core/step/StepComputer.hpp"
+#include "AdapterDummy.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STD
+#include <vector>
+
+namespace free_gait {
+
+/*!
+ * Creates a step with a base trajectory to a position.
+ * @param adapter the adapter.
+ * @param position the target position of the base in world frame.
+ * @param duration the duration of the step [s].
+ * @return the step.
+ */
+Step createBaseTrajectoryStep(const AdapterBase& adapter, const Position& position, const double duration = 1.0);
+
+/*!
+ * Creates steps with base trajectories, moving the base by 0.1 m along x
+ * per step, with durations of 0.3 s, 0.4 s, ...
+ * @param adapter the adapter.
+ * @param nSteps the number of steps.
+ * @return the steps.
+ */
+std::vector<Step> createBaseTrajectorySteps(const AdapterBase& adapter, const size_t nSteps);
+
+/*!
+ * Executor on the dummy adapter, initialized for each test.
+ */
+class ExecutorFixture : public ::testing::Test
+{
+ protected:
+  ExecutorFixture();
+  virtual void SetUp();
+
+  AdapterDummy adapter;
+  State state;
+  StepParameters parameters;
+  StepCompleter completer;
+  StepComputer computer;
+  Executor executor;
+};
+
+} /* namespace free_gait */
@@ -0,0 +1,310 @@
+/*
+ * ExecutorTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#include "free_gait_core/TypeDefs.hpp"
+#include "free_gait_core/base_motion/BaseTrajectory.hpp"
+#include "free_gait_core/executor/Executor.hpp"
+#include "free_gait_core/executor/ExecutorCommandQueue.hpp"
+#include "ExecutorFixture.hpp"
+#include "AllocationCounter.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STD
+#include <sstream>
+
+using namespace free_gait;
+
+size_t countFeedbackEvents(const Executor& executor, const ExecutorFeedbackEvent::Type type)
+{
+  size_t count = 0;
+  uint64_t sequence = 0, nDropped;
+  ExecutorFeedbackEvent event;
+  while (executor.getFeedback().read(sequence, event, nDropped)) {
+    if (event.type == type) ++count;
+  }
+  return count;
+}
+
+TEST_F(ExecutorFixture, realTimeAdvanceDoesNotAllocate)
+{
+  ASSERT_TRUE(executor.advance(0.01)); // Resets the executor.
+
+  executor.getQueue().add(createBaseTrajectoryStep(adapter, Position(0.1, 0.0, 0.5)));
+
+  // Switching to the step (completion) is allowed to allocate.
+  ASSERT_TRUE(executor.advance(0.01));
+  ASSERT_TRUE(executor.getQueue().active());
+
+  bool success = true;
+  AllocationCounter allocationCounter;
+  for (size_t i = 0; i < 50; ++i) {
+    success = executor.advance(0.01) && success;
+  }
+  allocationCounter.stop();
+
+  ASSERT_TRUE(success);
+  ASSERT_TRUE(executor.getQueue().active());
+  EXPECT_EQ(0u, allocationCounter.getNumberOfAllocations());
+}
+
+TEST_F(ExecutorFixture, profiling)
+{
+  typedef ExecutorProfiler::Phase Phase;
+  typedef ExecutorProfiler::StepType StepType;
+  executor.setProfiling(true);
+  ASSERT_TRUE(executor.advance(0.01));
+  EXPECT_EQ(1u, executor.getProfiler().getStatistics(Phase::Advance, StepType::None).nSamples);
+
+  executor.getQueue().add(createBaseTrajectoryStep(adapter, Position(0.1, 0.0, 0.5)));
+  executor.getQueue().add(createBaseTrajectoryStep(adapter, Position(0.2, 0.0, 0.5)));
+  ASSERT_TRUE(executor.advance(0.01));
+
+  // Measuring does not allocate.
+  bool success = true;
+  AllocationCounter allocationCounter;
+  for (size_t i = 0; i < 50; ++i) {
+    success = executor.advance(0.01) && success;
+  }
+  allocationCounter.stop();
+  ASSERT_TRUE(success);
+  EXPECT_EQ(0u, allocationCounter.getNumberOfAllocations());
+  while (!executor.getQueue().empty()) ASSERT_TRUE(executor.advance(0.01));
+
+  const ExecutorProfiler& profiler = executor.getProfiler();
+  const size_t nAdvances = profiler.getStatistics(Phase::Advance).nSamples;
+  EXPECT_EQ(nAdvances, profiler.getStatistics(Phase::UpdateStateWithMeasurements).nSamples);
+  EXPECT_EQ(nAdvances, profiler.getStatistics(Phase::WriteLegMotion).nSamples);
+  EXPECT_EQ(2u, profiler.getStatistics(Phase::CompleteStep, StepType::BaseTrajectory).nSamples);
+  EXPECT_EQ(0u, profiler.getStatistics(Phase::CompleteStep, StepType::BaseAuto).nSamples);
+
+  const LatencyHistogram::Statistics statistics = profiler.getStatistics(Phase::Advance, StepType::BaseTrajectory);
+  EXPECT_LT(0.0, statistics.median);
+  EXPECT_LE(statistics.median, statistics.percentile99);
+  EXPECT_LE(statistics.percentile99, statistics.max);
+  EXPECT_LE(statistics.max, profiler.getStatistics(Phase::Advance).max);
+  EXPECT_EQ(0u, profiler.getStatistics(Phase::FailedAdvance).nSamples);
+}
+
+TEST_F(ExecutorFixture, profilingFailedAdvance)
+{
+  typedef ExecutorProfiler::Phase Phase;
+  executor.setProfiling(true);
+  ASSERT_TRUE(executor.advance(0.01));
+
+  // The completion fails for an unknown frame.
+  BaseTrajectory baseTrajectory;
+  std::unordered_map<ControlLevel, std::string, EnumClassHash> frameIds;
+  frameIds[ControlLevel::Position] = "unknown";
+  std::unordered_map<ControlLevel, std::vector<BaseTrajectory::Time>, EnumClassHash> times;
+  times[ControlLevel::Position].push_back(1.0);
+  std::unordered_map<ControlLevel, std::vector<BaseTrajectory::ValueType>, EnumClassHash> values;
+  values[ControlLevel::Position].push_back(Pose(Position(0.1, 0.0, 0.5), RotationQuaternion()));
+  baseTrajectory.setTrajectory(frameIds, times, values);
+  Step step;
+  step.addBaseMotion(baseTrajectory);
+  executor.getQueue().add(step);
+  ASSERT_FALSE(executor.advance(0.01));
+
+  const ExecutorProfiler& profiler = executor.getProfiler();
+  EXPECT_EQ(2u, profiler.getStatistics(Phase::Advance).nSamples);
+  EXPECT_EQ(1u, profiler.getStatistics(Phase::FailedAdvance).nSamples);
+  EXPECT_EQ(0u, profiler.getStatistics(Phase::CompleteStep).nSamples);
+}
+
+TEST_F(ExecutorFixture, commandQueue)
+{
+  ASSERT_TRUE(executor.advance(0.01));
+
+  std::vector<Step> steps;
+  steps.push_back(createBaseTrajectoryStep(adapter, Position(0.1, 0.0, 0.5)));
+  steps.push_back(createBaseTrajectoryStep(adapter, Position(0.2, 0.0, 0.5)));
+  ExecutorCommandQueue& commandQueue = executor.getCommandQueue();
+  ASSERT_TRUE(commandQueue.push(ExecutorCommand::addSteps(steps)));
+  ASSERT_TRUE(commandQueue.push(ExecutorCommand::setPreemptionType(Executor::PreemptionType::PREEMPT_IMMEDIATE)));
+  EXPECT_EQ(2u, commandQueue.getNumberOfPushedCommands());
+  EXPECT_TRUE(executor.getQueue().empty()); // Processed at the next advance.
+
+  ExecutorSnapshot snapshot;
+  executor.getSnapshot(snapshot);
+  EXPECT_EQ(0u, snapshot.nProcessedCommands);
+  ASSERT_TRUE(executor.advance(0.01));
+  executor.getSnapshot(snapshot);
+  EXPECT_EQ(2u, snapshot.nProcessedCommands);
+  EXPECT_EQ(2u, snapshot.queueSize);
+  EXPECT_TRUE(snapshot.isQueueActive);
+  EXPECT_EQ(steps.front().getId(), snapshot.stepId);
+  EXPECT_TRUE(snapshot.isBaseActive);
+  EXPECT_TRUE(snapshot.activeLimbs.none());
+  EXPECT_DOUBLE_EQ(1.0, snapshot.stepDuration);
+
+  EXPECT_EQ(1u, countFeedbackEvents(executor, ExecutorFeedbackEvent::Type::StepStarted));
+  const uint64_t feedbackSequence = snapshot.feedbackSequence;
+  ASSERT_TRUE(executor.stop());
+  EXPECT_FALSE(executor.getQueue().empty()); // Processed at the next advance.
+  ASSERT_TRUE(executor.advance(0.01));
+  executor.getSnapshot(snapshot);
+  EXPECT_EQ(feedbackSequence + 1, snapshot.feedbackSequence);
+  EXPECT_EQ(1u, countFeedbackEvents(executor, ExecutorFeedbackEvent::Type::StopRequested));
+  EXPECT_EQ(0u, snapshot.queueSize);
+  EXPECT_TRUE(executor.getQueue().empty());
+
+  // Full queue.
+  for (size_t i = 0; i < ExecutorCommandQueue::capacity; ++i) {
+    ASSERT_TRUE(commandQueue.push(ExecutorCommand::pause(false)));
+  }
+  EXPECT_FALSE(commandQueue.push(ExecutorCommand::pause(false)));
+  ASSERT_TRUE(executor.advance(0.01));
+  EXPECT_EQ(commandQueue.getNumberOfPushedCommands(), commandQueue.getNumberOfProcessedCommands());
+}
+
+TEST_F(ExecutorFixture, snapshotReaders)
+{
+  std::unique_ptr<ExecutorSnapshotReader> reader = executor.createSnapshotReader();
+  std::unique_ptr<ExecutorSnapshotReader> otherReader = executor.createSnapshotReader();
+  ASSERT_TRUE(reader && otherReader);
+  EXPECT_FALSE(reader->update());
+  ASSERT_TRUE(executor.advance(0.01)); // Resets the executor.
+
+  const Step step = createBaseTrajectoryStep(adapter, Position(0.1, 0.0, 0.5));
+  executor.getQueue().add(step);
+  ASSERT_TRUE(executor.advance(0.01));
+
+  // Publishing to the readers does not allocate.
+  AllocationCounter allocationCounter;
+  const bool success = executor.advance(0.01);
+  allocationCounter.stop();
+  ASSERT_TRUE(success);
+  EXPECT_EQ(0u, allocationCounter.getNumberOfAllocations());
+
+  ASSERT_TRUE(reader->update());
+  EXPECT_FALSE(reader->update());
+  const ExecutorSnapshot& snapshot = reader->getSnapshot();
+  EXPECT_EQ(step.getId(), snapshot.stepId);
+  EXPECT_EQ(step.getId(), snapshot.state.getStepId());
+  EXPECT_TRUE(snapshot.state.getRobotExecutionStatus());
+  EXPECT_LT(0.0, snapshot.stepPhase);
+  EXPECT_EQ(state.getPositionWorldToBaseInWorldFrame(), snapshot.state.getPositionWorldToBaseInWorldFrame());
+
+  // Readers are independent.
+  ASSERT_TRUE(otherReader->update());
+  EXPECT_EQ(snapshot.feedbackSequence, otherReader->getSnapshot().feedbackSequence);
+
+  // Buffers of destroyed readers are reused.
+  otherReader.reset();
+  std::vector<std::unique_ptr<ExecutorSnapshotReader>> readers;
+  while (std::unique_ptr<ExecutorSnapshotReader> newReader = executor.createSnapshotReader()) {
+    readers.push_back(std::move(newReader));
+  }
+  EXPECT_EQ(7u, readers.size());
+}
+
+TEST_F(ExecutorFixture, speculativeCompletion)
+{
+  ASSERT_TRUE(executor.setSpeculativeCompletion(true));
+  ASSERT_TRUE(executor.advance(0.01)); // Resets the executor.
+
+  for (size_t i = 1; i <= 3; ++i) {
+    executor.getQueue().add(createBaseTrajectoryStep(adapter, Position(0.1 * i, 0.0, 0.5)));
+  }
+
+  bool success = true;
+  for (size_t i = 0; i < 1000 && !executor.getQueue().empty(); ++i) {
+    success = executor.advance(0.01) && success;
+    ASSERT_TRUE(executor.waitForSpeculativeCompletion(1.0));
+  }
+  ASSERT_TRUE(success);
+  EXPECT_TRUE(executor.getQueue().empty());
+  EXPECT_EQ(2u, countFeedbackEvents(executor, ExecutorFeedbackEvent::Type::UsingSpeculativeStep));
+  EXPECT_EQ(0u, countFeedbackEvents(executor, ExecutorFeedbackEvent::Type::RejectedSpeculativeStep));
+  EXPECT_NEAR(0.3, executor.getState().getPositionWorldToBaseInWorldFrame().x(), 1e-3);
+}
+
+TEST_F(ExecutorFixture, speculativeCompletionFallback)
+{
+  ASSERT_TRUE(executor.setSpeculativeCompletion(true));
+  ASSERT_TRUE(executor.advance(0.01)); // Resets the executor.
+
+  executor.getQueue().add(createBaseTrajectoryStep(adapter, Position(0.1, 0.0, 0.5)));
+  executor.getQueue().add(createBaseTrajectoryStep(adapter, Position(0.2, 0.0, 0.5)));
+
+  bool success = true;
+  for (size_t i = 0; i < 1000 && !executor.getQueue().empty(); ++i) {
+    success = executor.advance(0.01) && success;
+    ASSERT_TRUE(executor.waitForSpeculativeCompletion(1.0));
+    if (i == 50) {
+      // Disturb the measured joint positions of the (unactuated) legs.
+      State measuredState(executor.getState());
+      measuredState.setJointPositionsForLimb(LimbEnum::LF_LEG, JointPositionsLeg(Eigen::Vector3d(0.1, 0.1, 0.1)));
+      adapter.setInternalDataFromState(measuredState);
+    }
+  }
+  ASSERT_TRUE(success);
+  EXPECT_TRUE(executor.getQueue().empty());
+  EXPECT_EQ(0u, countFeedbackEvents(executor, ExecutorFeedbackEvent::Type::UsingSpeculativeStep));
+  EXPECT_EQ(1u, countFeedbackEvents(executor, ExecutorFeedbackEvent::Type::RejectedSpeculativeStep));
+  EXPECT_NEAR(0.2, executor.getState().getPositionWorldToBaseInWorldFrame().x(), 1e-3);
+}
+
+TEST_F(ExecutorFixture, feedbackEvents)
+{
+  typedef ExecutorFeedbackEvent::Type Type;
+  ASSERT_TRUE(executor.advance(0.01)); // Resets the executor.
+
+  const Step step = createBaseTrajectoryStep(adapter, Position(0.1, 0.0, 0.5));
+  executor.getQueue().add(step);
+  ASSERT_TRUE(executor.advance(0.01));
+  executor.pause(true);
+  ASSERT_TRUE(executor.advance(0.01));
+  executor.pause(false);
+  ASSERT_TRUE(executor.advance(0.01));
+
+  uint64_t sequence = 0, nDropped;
+  ExecutorFeedbackEvent event;
+  ASSERT_TRUE(executor.getFeedback().read(sequence, event, nDropped));
+  EXPECT_EQ(Type::StepStarted, event.type);
+  EXPECT_EQ(step.getId(), event.getStepId());
+  std::ostringstream stream;
+  stream << event;
+  EXPECT_EQ("Switched step to: " + step.getId(), stream.str());
+  ASSERT_TRUE(executor.getFeedback().read(sequence, event, nDropped));
+  EXPECT_EQ(Type::Paused, event.type);
+  ASSERT_TRUE(executor.getFeedback().read(sequence, event, nDropped));
+  EXPECT_EQ(Type::Resumed, event.type);
+  EXPECT_FALSE(executor.getFeedback().read(sequence, event, nDropped));
+  EXPECT_EQ(0u, nDropped);
+}
+
+TEST(executorFeedbackRing, overwritesOldestEvents)
+{
+  typedef ExecutorFeedbackEvent::ErrorCode ErrorCode;
+  ExecutorFeedbackRing ring;
+  const std::string stepId(100, 'a');
+  AllocationCounter allocationCounter;
+  for (size_t i = 0; i < ExecutorFeedbackRing::capacity + 10; ++i) {
+    ring.pushError(ErrorCode::FrameNotFound, stepId, LimbEnum::RH_LEG);
+  }
+  allocationCounter.stop();
+  EXPECT_EQ(0u, allocationCounter.getNumberOfAllocations());
+  EXPECT_EQ(ExecutorFeedbackRing::capacity + 10, ring.getSequence());
+
+  uint64_t sequence = 0, nDropped;
+  ExecutorFeedbackEvent event;
+  ASSERT_TRUE(ring.read(sequence, event, nDropped));
+  EXPECT_EQ(10u, nDropped);
+  EXPECT_EQ(11u, sequence);
+  EXPECT_EQ(ErrorCode::FrameNotFound, event.errorCode);
+  EXPECT_TRUE(event.hasLimb);
+  EXPECT_EQ(LimbEnum::RH_LEG, event.limb);
+  EXPECT_EQ(stepId.substr(0, ExecutorFeedbackEvent::maxStepIdLength), event.getStepId());
+
+  size_t nEvents = 1;
+  while (ring.read(sequence, event, nDropped)) ++nEvents;
+  EXPECT_EQ(ExecutorFeedbackRing::capacity, nEvents);
+  EXPECT_EQ(ring.getSequence(), sequence);
+}
@@ -8,10 +8,17 @@
 
 #include "free_gait_core/TypeDefs.hpp"
 #include "free_gait_core/leg_motion/Footstep.hpp"
+#include "free_gait_core/leg_motion/HermiteSpline.hpp"
+#include "free_gait_core/leg_motion/JointTrajectory.hpp"
+#include "free_gait_core/leg_motion/SampledTrajectory.hpp"
 
 // gtest
 #include <gtest/gtest.h>
 
+// STD
+#include <algorithm>
+#include <cmath>
+
 using namespace free_gait;
 
 TEST(footstep, triangleLowLongStep)
@@ -55,3 +62,264 @@ TEST(footstep, trianglehighLong)
     EXPECT_LT(position.x(), target.x() + 0.001);
   }
 }
+
+TEST(footstep, evaluate)
+{
+  Footstep footstep(LimbEnum::LF_LEG);
+  footstep.updateStartPosition(Position(0.0, 0.0, 0.0));
+  footstep.setTargetPosition("map", Position(0.3, 0.1, 0.05));
+  footstep.setProfileHeight(0.08);
+  footstep.setProfileType("trapezoid");
+  footstep.setAverageVelocity(0.3);
+  ASSERT_TRUE(footstep.compute(true));
+
+  // Knots are reproduced.
+  for (size_t i = 0; i < footstep.getTimes().size(); ++i) {
+    EXPECT_TRUE(footstep.evaluatePosition(footstep.getTimes()[i]).vector().isApprox(footstep.getKnotValues()[i], 1e-10));
+  }
+
+  // Derivatives are consistent with the positions.
+  const double delta = 1e-6;
+  for (double time = 0.01; time < footstep.getDuration(); time += 0.05) {
+    Position position;
+    LinearVelocity velocity;
+    LinearAcceleration acceleration;
+    footstep.evaluate(time, position, velocity, acceleration);
+    EXPECT_TRUE(position.vector().isApprox(footstep.evaluatePosition(time).vector()));
+    const Eigen::Vector3d finiteVelocity = (footstep.evaluatePosition(time + delta).vector()
+        - footstep.evaluatePosition(time - delta).vector()) / (2.0 * delta);
+    EXPECT_LT((finiteVelocity - velocity.vector()).norm(), 1e-5);
+    const Eigen::Vector3d finiteAcceleration = (footstep.evaluateVelocity(time + delta).vector()
+        - footstep.evaluateVelocity(time - delta).vector()) / (2.0 * delta);
+    EXPECT_LT((finiteAcceleration - acceleration.vector()).norm(), 1e-4);
+  }
+}
+
+TEST(hermiteSpline, cubic)
+{
+  // Piecewise cubic polynomials are reproduced from their values and first derivatives.
+  auto polynomial = [](const double t, const int derivative) {
+    const Eigen::Vector2d c0(1.0, -0.5), c1(0.3, 2.0), c2(-1.2, 0.4), c3(0.7, -0.9);
+    if (derivative == 0) return Eigen::Vector2d(c0 + t * (c1 + t * (c2 + t * c3)));
+    if (derivative == 1) return Eigen::Vector2d(c1 + t * (2.0 * c2 + t * 3.0 * c3));
+    return Eigen::Vector2d(2.0 * c2 + t * 6.0 * c3);
+  };
+  const std::vector<double> times{0.0, 0.4, 0.4, 1.0, 1.5};
+  HermiteSpline<2>::Values values, firstDerivatives;
+  for (const double time : times) {
+    values.push_back(polynomial(time, 0));
+    firstDerivatives.push_back(polynomial(time, 1));
+  }
+  HermiteSpline<2> spline;
+  spline.setKnots(times, values, firstDerivatives);
+  EXPECT_EQ(0.0, spline.getMinTime());
+  EXPECT_EQ(1.5, spline.getMaxTime());
+  EXPECT_EQ(3u, spline.getSegmentIndex(1.5));
+
+  for (double time = 0.0; time <= 1.5; time += 0.01) {
+    Eigen::Vector2d value, firstDerivative, secondDerivative;
+    spline.evaluate(time, value, firstDerivative, secondDerivative);
+    EXPECT_TRUE(value.isApprox(polynomial(time, 0), 1e-10));
+    EXPECT_TRUE(firstDerivative.isApprox(polynomial(time, 1), 1e-10));
+    EXPECT_TRUE(secondDerivative.isApprox(polynomial(time, 2), 1e-8));
+  }
+  EXPECT_TRUE(spline.evaluate(2.0).isApprox(values.back()));
+  EXPECT_TRUE(spline.evaluate(-1.0).isApprox(values.front()));
+
+  EXPECT_THROW(spline.setKnots({0.0, 1.0}, values, firstDerivatives), std::invalid_argument);
+  EXPECT_THROW(spline.setKnots({0.0, 1.0, 0.5, 2.0, 3.0}, values, firstDerivatives), std::invalid_argument);
+}
+
+TEST(hermiteSpline, quintic)
+{
+  // Quintic polynomials are reproduced from their values, first, and second derivatives.
+  auto polynomial = [](const double t, const int derivative) {
+    const double c[6] = {0.2, -1.0, 0.5, 2.0, -3.0, 1.1};
+    double value = 0.0;
+    for (int i = 5; i >= derivative; --i) {
+      double factor = 1.0;
+      for (int j = 0; j < derivative; ++j) factor *= i - j;
+      value = value * t + factor * c[i];
+    }
+    return value;
+  };
+  const std::vector<double> times{0.0, 0.7, 1.2};
+  HermiteSpline<1>::Values values, firstDerivatives, secondDerivatives;
+  for (const double time : times) {
+    values.push_back(HermiteSpline<1>::ValueType::Constant(polynomial(time, 0)));
+    firstDerivatives.push_back(HermiteSpline<1>::ValueType::Constant(polynomial(time, 1)));
+    secondDerivatives.push_back(HermiteSpline<1>::ValueType::Constant(polynomial(time, 2)));
+  }
+  HermiteSpline<1> spline;
+  spline.setKnots(times, values, firstDerivatives, secondDerivatives);
+
+  for (double time = 0.0; time <= 1.2; time += 0.01) {
+    HermiteSpline<1>::ValueType value, firstDerivative, secondDerivative;
+    spline.evaluate(time, value, firstDerivative, secondDerivative);
+    EXPECT_NEAR(polynomial(time, 0), value(0), 1e-10);
+    EXPECT_NEAR(polynomial(time, 1), firstDerivative(0), 1e-9);
+    EXPECT_NEAR(polynomial(time, 2), secondDerivative(0), 1e-8);
+    EXPECT_EQ(value, spline.evaluateDerivative(time, 0));
+    EXPECT_EQ(firstDerivative, spline.evaluateDerivative(time, 1));
+    EXPECT_EQ(secondDerivative, spline.evaluateDerivative(time, 2));
+  }
+}
+
+TEST(hermiteSpline, segmentCursor)
+{
+  std::vector<double> times;
+  HermiteSpline<1>::Values values, firstDerivatives;
+  for (size_t i = 0; i < 50; ++i) {
+    times.push_back(0.1 * i + (i > 20 && i < 24 ? 0.0 : 0.001 * i)); // With segments of zero duration.
+    values.push_back(HermiteSpline<1>::ValueType::Constant(std::sin(0.3 * i)));
+    firstDerivatives.push_back(HermiteSpline<1>::ValueType::Constant(std::cos(0.3 * i)));
+  }
+  std::sort(times.begin(), times.end());
+  HermiteSpline<1> spline;
+  spline.setKnots(times, values, firstDerivatives);
+  const HermiteSpline<1> reference(spline);
+
+  // Searches from any hint find the same segment as a binary search.
+  for (double time = -0.1; time < spline.getMaxTime() + 0.1; time += 0.013) {
+    for (size_t hint = 0; hint < times.size() + 2; ++hint) {
+      ASSERT_EQ(spline.getSegmentIndex(time), spline.getSegmentIndex(time, hint));
+    }
+  }
+
+  // Increasing, decreasing, and random evaluation times.
+  std::vector<double> evaluationTimes;
+  for (double time = 0.0; time < spline.getMaxTime(); time += 0.0037) evaluationTimes.push_back(time);
+  for (double time = spline.getMaxTime(); time > 0.0; time -= 0.05) evaluationTimes.push_back(time);
+  for (size_t i = 0; i < 200; ++i) evaluationTimes.push_back(std::fmod(i * 0.7919, spline.getMaxTime()));
+  for (const double time : evaluationTimes) {
+    HermiteSpline<1>::ValueType value, firstDerivative, secondDerivative;
+    HermiteSpline<1>::ValueType referenceValue, referenceFirstDerivative, referenceSecondDerivative;
+    spline.evaluate(time, value, firstDerivative, secondDerivative);
+    HermiteSpline<1>(reference).evaluate(time, referenceValue, referenceFirstDerivative, referenceSecondDerivative);
+    EXPECT_EQ(referenceValue, value);
+    EXPECT_EQ(referenceFirstDerivative, firstDerivative);
+    EXPECT_EQ(referenceSecondDerivative, secondDerivative);
+  }
+}
+
+TEST(footstep, sampling)
+{
+  Footstep footstep(LimbEnum::LF_LEG);
+  footstep.updateStartPosition(Position(0.0, 0.0, 0.0));
+  footstep.setTargetPosition("map", Position(0.3, 0.1, 0.05));
+  footstep.setProfileHeight(0.08);
+  footstep.setProfileType("triangle");
+  footstep.setAverageVelocity(0.3);
+  ASSERT_TRUE(footstep.compute(true));
+  Footstep sampledFootstep(footstep);
+  const double timeStep = 0.01;
+  sampledFootstep.setSampling(timeStep, SampleInterpolation::Cubic);
+  EXPECT_EQ(timeStep, sampledFootstep.getSamplingTimeStep());
+
+  // The footstep is cubic between its knots, where the cubic interpolation is exact.
+  const auto& knotTimes = footstep.getTimes();
+  for (double time = 0.0; time <= footstep.getDuration(); time += 0.0013) {
+    Position position, sampledPosition;
+    LinearVelocity velocity, sampledVelocity;
+    LinearAcceleration acceleration, sampledAcceleration;
+    footstep.evaluate(time, position, velocity, acceleration);
+    sampledFootstep.evaluate(time, sampledPosition, sampledVelocity, sampledAcceleration);
+    bool isNearKnot = false;
+    for (const double knotTime : knotTimes) {
+      if (std::abs(time - knotTime) < timeStep) isNearKnot = true;
+    }
+    if (isNearKnot) {
+      EXPECT_LT((position.vector() - sampledPosition.vector()).norm(), 1e-3);
+      continue;
+    }
+    EXPECT_LT((position.vector() - sampledPosition.vector()).norm(), 1e-10);
+    EXPECT_LT((velocity.vector() - sampledVelocity.vector()).norm(), 1e-9);
+    EXPECT_LT((acceleration.vector() - sampledAcceleration.vector()).norm(), 1e-7);
+  }
+
+  // Recomputing samples the trajectory again, sampling can be turned off.
+  ASSERT_TRUE(sampledFootstep.compute(true));
+  EXPECT_TRUE(sampledFootstep.evaluatePosition(0.1).vector().isApprox(footstep.evaluatePosition(0.1).vector(), 1e-6));
+  sampledFootstep.setSampling(0.0, SampleInterpolation::Cubic);
+  EXPECT_EQ(footstep.evaluatePosition(0.1), sampledFootstep.evaluatePosition(0.1));
+}
+
+TEST(sampledTrajectory, errorBounds)
+{
+  // Quintic polynomial with known bounds of its derivatives on [0, 1].
+  auto polynomial = [](const double t, const int derivative) {
+    const double c[6] = {0.5, -0.2, 1.5, -2.0, 0.8, 0.3};
+    double value = 0.0;
+    for (int i = 5; i >= derivative; --i) {
+      double factor = 1.0;
+      for (int j = 0; j < derivative; ++j) factor *= i - j;
+      value = value * t + factor * c[i];
+    }
+    return value;
+  };
+  double maxDerivatives[8] = {0.0};
+  for (double t = 0.0; t <= 1.0; t += 0.001) {
+    for (int i = 0; i < 8; ++i) maxDerivatives[i] = std::max(maxDerivatives[i], std::abs(polynomial(t, i)));
+  }
+
+  const double duration = 1.0;
+  const double timeStep = 0.03;
+  for (const auto interpolation : {SampleInterpolation::Linear, SampleInterpolation::Cubic}) {
+    SampledTrajectory<1> trajectory;
+    trajectory.sample(duration, timeStep, interpolation, [&](const double time, Eigen::Matrix<double, 1, 1>& value,
+        Eigen::Matrix<double, 1, 1>& firstDerivative, Eigen::Matrix<double, 1, 1>& secondDerivative) {
+      value(0) = polynomial(time, 0);
+      firstDerivative(0) = polynomial(time, 1);
+      secondDerivative(0) = polynomial(time, 2);
+    });
+    const double h = trajectory.getTimeStep();
+    EXPECT_LE(h, timeStep);
+    EXPECT_NEAR(duration, h * (trajectory.size() - 1), 1e-12);
+
+    for (double time = 0.0; time <= duration; time += 0.0007) {
+      Eigen::Matrix<double, 1, 1> value, firstDerivative, secondDerivative;
+      trajectory.evaluate(time, value, firstDerivative, secondDerivative);
+      const double tolerance = 1e-12;
+      if (interpolation == SampleInterpolation::Linear) {
+        EXPECT_LE(std::abs(value(0) - polynomial(time, 0)), h * h / 8.0 * maxDerivatives[2] + tolerance);
+        EXPECT_LE(std::abs(firstDerivative(0) - polynomial(time, 1)), h * h / 8.0 * maxDerivatives[3] + tolerance);
+      } else {
+        EXPECT_LE(std::abs(value(0) - polynomial(time, 0)), std::pow(h, 4) / 384.0 * maxDerivatives[4] + tolerance);
+        EXPECT_LE(std::abs(firstDerivative(0) - polynomial(time, 1)), std::pow(h, 4) / 384.0 * maxDerivatives[5] + tolerance);
+      }
+      EXPECT_LE(std::abs(secondDerivative(0) - polynomial(time, 2)), h * h / 8.0 * maxDerivatives[4] + tolerance);
+      EXPECT_EQ(value, trajectory.evaluateDerivative(time, 0));
+      EXPECT_EQ(firstDerivative, trajectory.evaluateDerivative(time, 1));
+      EXPECT_EQ(secondDerivative, trajectory.evaluateDerivative(time, 2));
+    }
+  }
+}
+
+TEST(jointTrajectory, evaluateDerivatives)
+{
+  std::unordered_map<ControlLevel, std::vector<JointTrajectory::Time>, EnumClassHash> times;
+  times[ControlLevel::Position] = {0.0, 0.4, 1.0};
+  std::unordered_map<ControlLevel, std::vector<std::vector<JointTrajectory::ValueType>>, EnumClassHash> values;
+  values[ControlLevel::Position] = {{0.0, 0.3, 0.1}, {0.2, -0.1, 0.4}, {-0.3, 0.2, 0.0}};
+  for (const double timeStep : {0.0, 0.02}) {
+    JointTrajectory jointTrajectory(LimbEnum::LF_LEG);
+    jointTrajectory.setTrajectory(times, values, std::vector<JointNodeEnum>());
+    jointTrajectory.setSampling(timeStep, SampleInterpolation::Cubic);
+    ASSERT_TRUE(jointTrajectory.compute());
+    for (double time = 0.0; time <= 1.0; time += 0.013) {
+      JointPositionsLeg position;
+      JointVelocitiesLeg velocity;
+      JointAccelerationsLeg acceleration;
+      jointTrajectory.evaluate(time, position, velocity, acceleration);
+      EXPECT_EQ(position.vector(), jointTrajectory.evaluatePosition(time).vector());
+      EXPECT_EQ(velocity.vector(), jointTrajectory.evaluateVelocity(time).vector());
+      EXPECT_EQ(acceleration.vector(), jointTrajectory.evaluateAcceleration(time).vector());
+    }
+  }
+
+  // A leg has three joints.
+  values[ControlLevel::Position].push_back({0.0, 0.1, 0.2});
+  JointTrajectory jointTrajectory(LimbEnum::LF_LEG);
+  jointTrajectory.setTrajectory(times, values, std::vector<JointNodeEnum>());
+  EXPECT_FALSE(jointTrajectory.compute());
+}
@@ -0,0 +1,57 @@
+/*
+ * LatencyHistogramTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#include "free_gait_core/executor/LatencyHistogram.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+using namespace free_gait;
+
+TEST(LatencyHistogram, buckets)
+{
+  for (uint64_t duration : {0ul, 1ul, 7ul, 8ul, 15ul, 16ul, 17ul, 1000ul, 123456ul, 987654321ul}) {
+    const size_t bucket = LatencyHistogram::getBucket(duration);
+    EXPECT_LE(duration, LatencyHistogram::getBucketUpperBound(bucket));
+    if (bucket > 0) {
+      EXPECT_GT(duration, LatencyHistogram::getBucketUpperBound(bucket - 1));
+    }
+  }
+  EXPECT_EQ(LatencyHistogram::nBuckets - 1, LatencyHistogram::getBucket(UINT64_MAX));
+}
+
+TEST(LatencyHistogram, statistics)
+{
+  LatencyHistogram histogram;
+  EXPECT_EQ(0u, histogram.getStatistics().nSamples);
+  // 1us for 98 samples, 100us and 1ms once.
+  for (size_t i = 0; i < 98; ++i) histogram.add(1000);
+  histogram.add(100000);
+  histogram.add(1000000);
+
+  const LatencyHistogram::Statistics statistics = histogram.getStatistics();
+  EXPECT_EQ(100u, statistics.nSamples);
+  EXPECT_NEAR(1e-6, statistics.median, 0.125e-6);
+  EXPECT_NEAR(1e-4, statistics.percentile99, 0.125e-4);
+  EXPECT_DOUBLE_EQ(1e-3, statistics.max);
+}
+
+TEST(LatencyHistogram, rolling)
+{
+  LatencyHistogram histogram;
+  histogram.add(1000000);
+  for (size_t i = 0; i < 2 * LatencyHistogram::windowSize; ++i) histogram.add(1000);
+
+  // The old sample has been dropped.
+  const LatencyHistogram::Statistics statistics = histogram.getStatistics();
+  EXPECT_GE(2 * LatencyHistogram::windowSize, statistics.nSamples);
+  EXPECT_LE(LatencyHistogram::windowSize, statistics.nSamples);
+  EXPECT_DOUBLE_EQ(1e-6, statistics.max);
+
+  histogram.clear();
+  EXPECT_EQ(0u, histogram.getStatistics().nSamples);
+}
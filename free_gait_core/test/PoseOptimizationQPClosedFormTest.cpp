@@ -0,0 +1,158 @@
+/*
+ * PoseOptimizationQPClosedFormTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#include "free_gait_core/TypeDefs.hpp"
+#include "free_gait_core/pose_optimization/PoseOptimizationQP.hpp"
+#include "AdapterDummy.hpp"
+#include "AllocationCounter.hpp"
+
+#include <grid_map_core/Polygon.hpp>
+
+// gtest
+#include <gtest/gtest.h>
+
+using namespace free_gait;
+
+Stance createNominalStance()
+{
+  return Stance({
+    {LimbEnum::LF_LEG, Position(1.0, 0.5, -0.4)},
+    {LimbEnum::RF_LEG, Position(1.0, -0.5, -0.4)},
+    {LimbEnum::LH_LEG, Position(-1.0, 0.5, -0.4)},
+    {LimbEnum::RH_LEG, Position(-1.0, -0.5, -0.4)} });
+}
+
+Stance createStance(const Position& offset)
+{
+  Stance stance(createNominalStance());
+  for (auto& footPosition : stance) {
+    footPosition.second.z() = -0.1;
+    footPosition.second += offset;
+  }
+  return stance;
+}
+
+grid_map::Polygon createSquare(const double halfLength)
+{
+  grid_map::Polygon polygon;
+  polygon.addVertex(grid_map::Position(halfLength, halfLength));
+  polygon.addVertex(grid_map::Position(-halfLength, halfLength));
+  polygon.addVertex(grid_map::Position(-halfLength, -halfLength));
+  polygon.addVertex(grid_map::Position(halfLength, -halfLength));
+  return polygon;
+}
+
+TEST(poseOptimizationQPClosedForm, unconstrained)
+{
+  Position position;
+  ASSERT_TRUE(PoseOptimizationQP::optimizePosition(createStance(Position(0.2, 0.1, 0.0)), createNominalStance(),
+                                                   RotationMatrix(), Position(), grid_map::Polygon(), position));
+  EXPECT_NEAR(0.2, position.x(), 1e-10);
+  EXPECT_NEAR(0.1, position.y(), 1e-10);
+  EXPECT_NEAR(0.3, position.z(), 1e-10);
+}
+
+TEST(poseOptimizationQPClosedForm, inside)
+{
+  Position position;
+  ASSERT_TRUE(PoseOptimizationQP::optimizePosition(createStance(Position(0.2, 0.1, 0.0)), createNominalStance(),
+                                                   RotationMatrix(), Position(), createSquare(0.5), position));
+  EXPECT_NEAR(0.2, position.x(), 1e-10);
+  EXPECT_NEAR(0.1, position.y(), 1e-10);
+}
+
+TEST(poseOptimizationQPClosedForm, edgeActive)
+{
+  Position position;
+  ASSERT_TRUE(PoseOptimizationQP::optimizePosition(createStance(Position(0.8, 0.1, 0.0)), createNominalStance(),
+                                                   RotationMatrix(), Position(), createSquare(0.5), position));
+  EXPECT_NEAR(0.5, position.x(), 1e-10);
+  EXPECT_NEAR(0.1, position.y(), 1e-10);
+  EXPECT_NEAR(0.3, position.z(), 1e-10);
+}
+
+TEST(poseOptimizationQPClosedForm, vertexActive)
+{
+  // Clockwise ordered triangle.
+  grid_map::Polygon triangle;
+  triangle.addVertex(grid_map::Position(0.0, 0.0));
+  triangle.addVertex(grid_map::Position(0.0, 1.0));
+  triangle.addVertex(grid_map::Position(1.0, 0.0));
+  Position position;
+  ASSERT_TRUE(PoseOptimizationQP::optimizePosition(createStance(Position(-0.3, -0.2, 0.0)), createNominalStance(),
+                                                   RotationMatrix(), Position(), triangle, position));
+  EXPECT_NEAR(0.0, position.x(), 1e-10);
+  EXPECT_NEAR(0.0, position.y(), 1e-10);
+}
+
+TEST(poseOptimizationQPClosedForm, centerOfMassOffset)
+{
+  // The center of mass (not the base) has to be inside the support region.
+  const Position centerOfMassInBaseFrame(0.1, 0.0, 0.0);
+  const RotationMatrix orientation(EulerAnglesZyx(M_PI_2, 0.0, 0.0));
+  Stance stance(createNominalStance());
+  for (auto& footPosition : stance) footPosition.second = orientation.rotate(footPosition.second) + Position(0.0, 0.8, 0.0);
+  Position position;
+  ASSERT_TRUE(PoseOptimizationQP::optimizePosition(stance, createNominalStance(), orientation,
+                                                   centerOfMassInBaseFrame, createSquare(0.5), position));
+  EXPECT_NEAR(0.0, position.x(), 1e-10);
+  EXPECT_NEAR(0.4, position.y(), 1e-10);
+  EXPECT_NEAR(0.0, position.z(), 1e-10);
+}
+
+TEST(poseOptimizationQPClosedForm, noAllocations)
+{
+  const Stance stance(createStance(Position(0.8, 0.7, 0.0)));
+  const Stance nominalStance(createNominalStance());
+  const grid_map::Polygon supportRegion(createSquare(0.5));
+  Position position;
+  AllocationCounter allocationCounter;
+  const bool success = PoseOptimizationQP::optimizePosition(stance, nominalStance, RotationMatrix(), Position(),
+                                                            supportRegion, position);
+  allocationCounter.stop();
+  ASSERT_TRUE(success);
+  EXPECT_EQ(0u, allocationCounter.getNumberOfAllocations());
+  EXPECT_NEAR(0.5, position.x(), 1e-10);
+  EXPECT_NEAR(0.5, position.y(), 1e-10);
+}
+
+TEST(poseOptimizationQPClosedForm, equalsGenericSolver)
+{
+  AdapterDummy adapter;
+  PoseOptimizationQP optimization(adapter);
+  const Stance nominalStance(createNominalStance());
+
+  // Counterclockwise ordered triangle.
+  grid_map::Polygon triangle;
+  triangle.addVertex(grid_map::Position(0.0, 0.0));
+  triangle.addVertex(grid_map::Position(1.0, 0.0));
+  triangle.addVertex(grid_map::Position(0.0, 1.0));
+
+  const std::vector<grid_map::Polygon> supportRegions{createSquare(0.5), triangle};
+  const std::vector<Position> offsets{Position(0.2, 0.1, 0.0), Position(0.8, 0.1, 0.0), Position(0.8, 0.7, 0.0),
+                                      Position(-0.9, 0.3, 0.2), Position(0.3, -0.8, -0.1)};
+  const std::vector<RotationMatrix> orientations{RotationMatrix(), RotationMatrix(EulerAnglesZyx(0.4, 0.0, 0.0)),
+                                                 RotationMatrix(EulerAnglesZyx(-0.3, 0.1, 0.05))};
+  const Position centerOfMassInBaseFrame(0.05, -0.02, 0.0);
+
+  for (const auto& supportRegion : supportRegions) {
+    for (const auto& offset : offsets) {
+      for (const auto& orientation : orientations) {
+        const Stance stance(createStance(offset));
+        Position closedFormPosition, genericPosition;
+        ASSERT_TRUE(PoseOptimizationQP::optimizePosition(stance, nominalStance, orientation, centerOfMassInBaseFrame,
+                                                         supportRegion, closedFormPosition));
+        ASSERT_TRUE(optimization.optimizePositionWithGenericSolver(stance, nominalStance, orientation,
+                                                                   centerOfMassInBaseFrame, supportRegion,
+                                                                   genericPosition));
+        EXPECT_NEAR(genericPosition.x(), closedFormPosition.x(), 1e-6);
+        EXPECT_NEAR(genericPosition.y(), closedFormPosition.y(), 1e-6);
+        EXPECT_NEAR(genericPosition.z(), closedFormPosition.z(), 1e-6);
+      }
+    }
+  }
+}
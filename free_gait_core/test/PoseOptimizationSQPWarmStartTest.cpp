@@ -0,0 +1,119 @@
+/*
+ * PoseOptimizationSQPWarmStartTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#include "free_gait_core/TypeDefs.hpp"
+#include "free_gait_core/pose_optimization/PoseOptimizationSQP.hpp"
+#include "AdapterDummy.hpp"
+
+#include <grid_map_core/Polygon.hpp>
+
+// gtest
+#include <gtest/gtest.h>
+
+using namespace free_gait;
+
+namespace {
+
+void setUpOptimization(const AdapterDummy& adapter, PoseOptimizationSQP& optimization)
+{
+  optimization.setCurrentState(adapter.getState());
+  optimization.setNominalStance(Stance({
+    {LimbEnum::LF_LEG, Position(1.0, 0.5, -0.4)},
+    {LimbEnum::RF_LEG, Position(1.0, -0.5, -0.4)},
+    {LimbEnum::LH_LEG, Position(-1.0, 0.5, -0.4)},
+    {LimbEnum::RH_LEG, Position(-1.0, -0.5, -0.4)} }));
+  Stance stance({
+    {LimbEnum::LF_LEG, Position(1.2, 0.6, -0.1)},
+    {LimbEnum::RF_LEG, Position(1.2, -0.4, -0.1)},
+    {LimbEnum::LH_LEG, Position(-0.8, 0.6, -0.1)},
+    {LimbEnum::RH_LEG, Position(-0.8, -0.4, -0.1)} });
+  optimization.setStance(stance);
+  optimization.setSupportStance(stance);
+  grid_map::Polygon supportRegion;
+  for (const auto& limb : {LimbEnum::LF_LEG, LimbEnum::LH_LEG, LimbEnum::RH_LEG, LimbEnum::RF_LEG}) {
+    supportRegion.addVertex(stance.at(limb).vector().head<2>());
+  }
+  optimization.setSupportRegion(supportRegion);
+  PoseOptimizationSQP::LimbLengths minLimbLengths, maxLimbLengths;
+  for (const auto& foot : stance) {
+    minLimbLengths[foot.first] = 0.0;
+    maxLimbLengths[foot.first] = 2.0;
+  }
+  optimization.setLimbLengthConstraints(minLimbLengths, maxLimbLengths);
+}
+
+}
+
+TEST(poseOptimizationSQP, warmStart)
+{
+  AdapterDummy adapter;
+  PoseOptimizationSQP optimization(adapter);
+  setUpOptimization(adapter, optimization);
+  optimization.setMaxIterations(100);
+  const Pose initialPose(Position(0.0, 0.0, 0.1), RotationQuaternion());
+
+  Pose coldPose(initialPose);
+  ASSERT_TRUE(optimization.optimize(coldPose));
+  EXPECT_FALSE(optimization.isWarmStarted());
+  const size_t nColdIterations = optimization.getNumberOfIterations();
+
+  Pose warmPose(initialPose);
+  ASSERT_TRUE(optimization.optimize(warmPose));
+  EXPECT_TRUE(optimization.isWarmStarted());
+  EXPECT_LE(optimization.getNumberOfIterations(), nColdIterations);
+  EXPECT_NEAR(coldPose.getPosition().x(), warmPose.getPosition().x(), 1e-3);
+  EXPECT_NEAR(coldPose.getPosition().y(), warmPose.getPosition().y(), 1e-3);
+  EXPECT_NEAR(coldPose.getPosition().z(), warmPose.getPosition().z(), 1e-3);
+  EXPECT_NEAR(0.0, warmPose.getRotation().getDisparityAngle(coldPose.getRotation()), 1e-3);
+
+  // Without warm start, the optimization is started from the provided pose.
+  optimization.resetWarmStart();
+  Pose resetPose(initialPose);
+  ASSERT_TRUE(optimization.optimize(resetPose));
+  EXPECT_FALSE(optimization.isWarmStarted());
+  EXPECT_EQ(nColdIterations, optimization.getNumberOfIterations());
+}
+
+TEST(poseOptimizationSQP, iterationBudget)
+{
+  AdapterDummy adapter;
+  PoseOptimizationSQP optimization(adapter);
+  setUpOptimization(adapter, optimization);
+  optimization.setWarmStart(false);
+
+  for (const size_t maxIterations : {size_t(1), size_t(2), size_t(5)}) {
+    optimization.setMaxIterations(maxIterations);
+    EXPECT_EQ(maxIterations, optimization.getIterationBudget());
+    Pose pose(Position(0.0, 0.0, 0.1), RotationQuaternion());
+    ASSERT_TRUE(optimization.optimize(pose));
+    EXPECT_LE(optimization.getNumberOfIterations(), maxIterations);
+  }
+}
+
+TEST(poseOptimizationSQP, timeBudget)
+{
+  AdapterDummy adapter;
+  PoseOptimizationSQP optimization(adapter);
+  setUpOptimization(adapter, optimization);
+  optimization.setWarmStart(false);
+  optimization.setMaxIterations(20);
+
+  // Before the first optimization, the duration of an iteration is unknown.
+  optimization.setMaxDuration(1e-6);
+  EXPECT_EQ(20, optimization.getIterationBudget());
+  Pose pose(Position(0.0, 0.0, 0.1), RotationQuaternion());
+  ASSERT_TRUE(optimization.optimize(pose));
+
+  // A budget shorter than an iteration still allows one iteration.
+  EXPECT_EQ(1, optimization.getIterationBudget());
+  pose = Pose(Position(0.0, 0.0, 0.1), RotationQuaternion());
+  ASSERT_TRUE(optimization.optimize(pose));
+  EXPECT_LE(optimization.getNumberOfIterations(), 1);
+
+  optimization.setMaxDuration(0.0);
+  EXPECT_EQ(20, optimization.getIterationBudget());
+}
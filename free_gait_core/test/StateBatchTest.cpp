@@ -0,0 +1,172 @@
+/*
+ * StateBatchTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#include "free_gait_core/TypeDefs.hpp"
+#include "free_gait_core/executor/StateBatch.hpp"
+#include "free_gait_core/executor/StateBatchComputer.hpp"
+#include "AdapterDummy.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STD
+#include <algorithm>
+#include <string>
+#include <tuple>
+
+using namespace free_gait;
+
+namespace {
+
+State createState(const double x, const std::string& stepId)
+{
+  State state;
+  state.setPositionWorldToBaseInWorldFrame(Position(x, 0.0, 0.5));
+  state.setSupportLeg(LimbEnum::LF_LEG, x > 0.5);
+  state.setStepId(stepId);
+  return state;
+}
+
+State createWalkingState(const AdapterDummy& adapter, const size_t i)
+{
+  State state(adapter.getState());
+  state.setPositionWorldToBaseInWorldFrame(Position(0.01 * i, 0.0, 0.5));
+  for (const auto& limb : adapter.getLimbs()) {
+    const bool isSupportLeg = (i / 20 + getIndex(limb)) % 4 != 0;
+    state.setSupportLeg(limb, isSupportLeg);
+    if (isSupportLeg) {
+      state.setSurfaceNormal(limb, Vector(0.0, 0.1 * getIndex(limb), 1.0));
+    } else {
+      state.removeSurfaceNormal(limb);
+    }
+  }
+  state.setStepId(i < 40 ? "" : std::to_string(i / 20));
+  return state;
+}
+
+void expectEqualPositions(const std::vector<std::map<double, Position>>& expected,
+                          const std::vector<std::map<double, Position>>& actual)
+{
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_EQ(expected[i].size(), actual[i].size());
+    for (const auto& entry : expected[i]) {
+      ASSERT_EQ(1u, actual[i].count(entry.first));
+      EXPECT_TRUE(entry.second.vector().isApprox(actual[i].at(entry.first).vector()));
+    }
+  }
+}
+
+void expectEqualDerivedData(const StateBatch& expected, const StateBatch& actual)
+{
+  expectEqualPositions(expected.getEndEffectorPositions(), actual.getEndEffectorPositions());
+  expectEqualPositions(expected.getEndEffectorTargets(), actual.getEndEffectorTargets());
+  const auto expectedSurfaceNormals = expected.getSurfaceNormals();
+  const auto actualSurfaceNormals = actual.getSurfaceNormals();
+  ASSERT_EQ(expectedSurfaceNormals.size(), actualSurfaceNormals.size());
+  for (size_t i = 0; i < expectedSurfaceNormals.size(); ++i) {
+    ASSERT_EQ(expectedSurfaceNormals[i].size(), actualSurfaceNormals[i].size());
+    for (const auto& entry : expectedSurfaceNormals[i]) {
+      ASSERT_EQ(1u, actualSurfaceNormals[i].count(entry.first));
+      const auto& surfaceNormal = actualSurfaceNormals[i].at(entry.first);
+      EXPECT_TRUE(std::get<0>(entry.second).vector().isApprox(std::get<0>(surfaceNormal).vector()));
+      EXPECT_TRUE(std::get<1>(entry.second).vector().isApprox(std::get<1>(surfaceNormal).vector()));
+    }
+  }
+  const auto expectedStances = expected.getStances();
+  const auto actualStances = actual.getStances();
+  ASSERT_EQ(expectedStances.size(), actualStances.size());
+  for (const auto& entry : expectedStances) {
+    ASSERT_EQ(1u, actualStances.count(entry.first));
+    EXPECT_EQ(entry.second.size(), actualStances.at(entry.first).size());
+  }
+  for (size_t i = 2; i < 10; ++i) {
+    std::string stepId = std::to_string(i);
+    double expectedEndTime = 0.0, actualEndTime = 0.0;
+    EXPECT_TRUE(expected.getEndTimeOfStep(stepId, expectedEndTime));
+    EXPECT_TRUE(actual.getEndTimeOfStep(stepId, actualEndTime));
+    EXPECT_EQ(expectedEndTime, actualEndTime);
+  }
+}
+
+}
+
+TEST(stateBatch, uniformGrid)
+{
+  StateBatch stateBatch;
+  const double timeStep = 0.001;
+  double time = 0.0;
+  for (size_t i = 0; i < 1000; ++i) {
+    time += timeStep; // Accumulated, as in the batch executor.
+    stateBatch.addState(time, createState(i * 0.001, i < 500 ? "first" : "second"));
+  }
+  ASSERT_EQ(1000u, stateBatch.size());
+  EXPECT_FALSE(stateBatch.isValidTime(0.0));
+  EXPECT_EQ(0u, stateBatch.getIndex(0.001));
+  EXPECT_EQ(1u, stateBatch.getIndex(0.0015));
+  EXPECT_EQ(999u, stateBatch.getIndex(10.0));
+
+  // Compare against binary search.
+  const auto& times = stateBatch.getTimes();
+  for (double t = 0.001; t < 1.001; t += 0.00037) {
+    const size_t expectedIndex = std::lower_bound(times.begin(), times.end(), t) - times.begin();
+    EXPECT_EQ(std::min(expectedIndex, times.size() - 1), stateBatch.getIndex(t));
+  }
+
+  const State state = stateBatch.getState(0.7);
+  EXPECT_NEAR(0.699, state.getPositionWorldToBaseInWorldFrame().x(), 1e-9);
+  EXPECT_TRUE(state.isSupportLeg(LimbEnum::LF_LEG));
+  EXPECT_FALSE(state.isSupportLeg(LimbEnum::RF_LEG));
+  EXPECT_EQ("second", state.getStepId());
+  EXPECT_EQ("first", stateBatch.getStepIdAtIndex(0));
+}
+
+TEST(stateBatch, nonUniformGrid)
+{
+  StateBatch stateBatch;
+  stateBatch.addState(0.0, createState(0.0, ""));
+  stateBatch.addState(0.1, createState(0.1, ""));
+  stateBatch.addState(0.5, createState(0.5, ""));
+  stateBatch.addState(0.5, createState(0.6, "")); // Overwrites.
+  stateBatch.addState(2.0, createState(2.0, ""));
+  EXPECT_THROW(stateBatch.addState(1.0, createState(1.0, "")), std::invalid_argument);
+  ASSERT_EQ(4u, stateBatch.size());
+  EXPECT_EQ(1u, stateBatch.getIndex(0.05));
+  EXPECT_EQ(2u, stateBatch.getIndex(0.3));
+  EXPECT_NEAR(0.6, stateBatch.getState(0.5).getPositionWorldToBaseInWorldFrame().x(), 1e-9);
+  EXPECT_EQ(3u, stateBatch.getIndex(1.5));
+  stateBatch.clear();
+  EXPECT_TRUE(stateBatch.empty());
+}
+
+TEST(stateBatchComputer, incrementalUpdate)
+{
+  AdapterDummy adapter;
+  StateBatchComputer stateBatchComputer(adapter);
+  StateBatch stateBatch;
+  for (size_t i = 0; i < 200; ++i) {
+    stateBatch.addState(0.01 * (i + 1), createWalkingState(adapter, i));
+    if (i % 7 == 0) stateBatchComputer.update(stateBatch);
+  }
+  // Overwritten state after an update.
+  stateBatch.addState(2.0, createWalkingState(adapter, 0));
+  stateBatchComputer.update(stateBatch);
+  EXPECT_EQ(200u, stateBatch.getEndEffectorPositions().front().size());
+  EXPECT_FALSE(stateBatch.getStances().empty());
+
+  // Compare against separate passes.
+  StateBatch expectedStateBatch(stateBatch);
+  stateBatchComputer.computeEndEffectorTrajectories(expectedStateBatch);
+  stateBatchComputer.computeEndEffectorTargetsAndSurfaceNormals(expectedStateBatch);
+  stateBatchComputer.computeStances(expectedStateBatch);
+  stateBatchComputer.computeStepIds(expectedStateBatch);
+  expectEqualDerivedData(expectedStateBatch, stateBatch);
+
+  StateBatch computedStateBatch(stateBatch);
+  stateBatchComputer.compute(computedStateBatch);
+  expectEqualDerivedData(expectedStateBatch, computedStateBatch);
+}
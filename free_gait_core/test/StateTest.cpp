@@ -0,0 +1,89 @@
+/*
+ * StateTest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#include "free_gait_core/TypeDefs.hpp"
+#include "free_gait_core/executor/State.hpp"
+#include "AllocationCounter.hpp"
+
+// gtest
+#include <gtest/gtest.h>
+
+// STD
+#include <string>
+#include <type_traits>
+
+using namespace free_gait;
+
+TEST(controlSetup, access)
+{
+  static_assert(std::is_trivially_copyable<ControlSetup>::value, "ControlSetup should be trivially copyable.");
+  ControlSetup controlSetup { {ControlLevel::Position, true}, {ControlLevel::Velocity, false},
+                              {ControlLevel::Acceleration, false}, {ControlLevel::Effort, true} };
+  EXPECT_TRUE(controlSetup.at(ControlLevel::Position));
+  EXPECT_FALSE(controlSetup.at(ControlLevel::Velocity));
+  EXPECT_TRUE(controlSetup[ControlLevel::Effort]);
+
+  controlSetup[ControlLevel::Position] = false;
+  controlSetup[ControlLevel::Acceleration] = true;
+  EXPECT_FALSE(controlSetup[ControlLevel::Position]);
+  EXPECT_TRUE(controlSetup[ControlLevel::Acceleration]);
+
+  size_t nActive = 0;
+  for (const auto& controlLevel : controlSetup) {
+    if (controlLevel.second) ++nActive;
+  }
+  EXPECT_EQ(2u, nActive);
+
+  controlSetup.clear();
+  EXPECT_TRUE(controlSetup.none());
+}
+
+TEST(state, limbProperties)
+{
+  State state;
+  state.initialize({LimbEnum::LF_LEG, LimbEnum::RF_LEG, LimbEnum::LH_LEG, LimbEnum::RH_LEG},
+                   {BranchEnum::BASE, BranchEnum::LF_LEG, BranchEnum::RF_LEG, BranchEnum::LH_LEG, BranchEnum::RH_LEG});
+  EXPECT_EQ(0u, state.getNumberOfSupportLegs());
+  state.setSupportLeg(LimbEnum::LF_LEG, true);
+  state.setSupportLeg(LimbEnum::RH_LEG, true);
+  EXPECT_EQ(2u, state.getNumberOfSupportLegs());
+  EXPECT_TRUE(state.isSupportLeg(LimbEnum::RH_LEG));
+  EXPECT_FALSE(state.isSupportLeg(LimbEnum::RF_LEG));
+
+  EXPECT_FALSE(state.hasSurfaceNormal(LimbEnum::LH_LEG));
+  EXPECT_THROW(state.getSurfaceNormal(LimbEnum::LH_LEG), std::out_of_range);
+  state.setSurfaceNormal(LimbEnum::LH_LEG, Vector::UnitZ());
+  EXPECT_TRUE(state.hasSurfaceNormal(LimbEnum::LH_LEG));
+  EXPECT_EQ(1.0, state.getSurfaceNormal(LimbEnum::LH_LEG).z());
+  state.removeSurfaceNormal(LimbEnum::LH_LEG);
+  EXPECT_FALSE(state.hasSurfaceNormal(LimbEnum::LH_LEG));
+
+  EXPECT_TRUE(state.isControlSetupEmpty(LimbEnum::RF_LEG));
+  ControlSetup controlSetup;
+  controlSetup[ControlLevel::Velocity] = true;
+  state.setControlSetup(LimbEnum::RF_LEG, controlSetup);
+  EXPECT_FALSE(state.isControlSetupEmpty(BranchEnum::RF_LEG));
+  EXPECT_TRUE(state.getControlSetup(LimbEnum::RF_LEG).at(ControlLevel::Velocity));
+
+  State stateCopy(state);
+  EXPECT_EQ(2u, stateCopy.getNumberOfSupportLegs());
+  EXPECT_EQ(controlSetup, stateCopy.getControlSetup(BranchEnum::RF_LEG));
+}
+
+TEST(state, reserveStepId)
+{
+  State state;
+  state.reserveStepId(128);
+  const std::string stepId(100, 'a');
+  AllocationCounter allocationCounter;
+  state.setStepId(stepId);
+  state.setStepId("");
+  state.setStepId(stepId);
+  allocationCounter.stop();
+  EXPECT_EQ(0u, allocationCounter.getNumberOfAllocations());
+  EXPECT_EQ(stepId, state.getStepId());
+}
@@ -8,6 +8,18 @@
 
 #include "free_gait_core/TypeDefs.hpp"
 #include "free_gait_core/step/Step.hpp"
+#include "free_gait_core/leg_motion/EndEffectorTrajectory.hpp"
+#include "free_gait_core/leg_motion/LegMotionVariant.hpp"
+#include "free_gait_core/base_motion/BaseTrajectory.hpp"
+#include "free_gait_core/base_motion/BaseAuto.hpp"
+#include "free_gait_core/step/StepCompleter.hpp"
+#include "free_gait_core/step/StepQueue.hpp"
+#include "free_gait_core/executor/State.hpp"
+#include "AdapterDummy.hpp"
+
+// STD
+#include <string>
+#include <vector>
 
 // gtest
 #include <gtest/gtest.h>
@@ -25,3 +37,109 @@ TEST(step, initialization)
   ASSERT_FALSE(step.hasLegMotion());
   ASSERT_FALSE(step.hasLegMotion(LimbEnum::RF_LEG));
 }
+
+TEST(step, frameHandles)
+{
+  EndEffectorTrajectory legMotion(LimbEnum::LF_LEG);
+  legMotion.setTrajectory({{ControlLevel::Position, "odom"}}, {0.0, 1.0},
+                          {{ControlLevel::Position, {Position(0.0, 0.0, 0.0).vector(), Position(0.1, 0.0, 0.0).vector()}}});
+  BaseTrajectory baseMotion;
+  baseMotion.setTrajectory({{ControlLevel::Position, "map"}}, {{ControlLevel::Position, {0.0, 1.0}}},
+                           {{ControlLevel::Position, {Pose(), Pose()}}});
+  Step step;
+  step.addLegMotion(legMotion);
+  step.addBaseMotion(baseMotion);
+
+  const Step stepCopy(step);
+  const FrameRegistry& registry = FrameRegistry::getInstance();
+  const auto& endEffectorMotion = dynamic_cast<const EndEffectorMotionBase&>(stepCopy.getLegMotion(LimbEnum::LF_LEG));
+  EXPECT_EQ(registry.find("odom"), endEffectorMotion.getFrameHandle(ControlLevel::Position));
+  EXPECT_EQ("odom", endEffectorMotion.getFrameId(ControlLevel::Position));
+  EXPECT_EQ(FrameRegistry::invalidFrameId, endEffectorMotion.getFrameHandle(ControlLevel::Effort));
+  EXPECT_EQ(registry.find("map"), stepCopy.getBaseMotion().getFrameHandle(ControlLevel::Position));
+  EXPECT_EQ("map", stepCopy.getBaseMotion().getFrameId(ControlLevel::Position));
+}
+
+TEST(step, frameHandlesBeyondBlock)
+{
+  // Motions keep the names of their frames, however many frames are registered.
+  std::vector<EndEffectorTrajectory> legMotions;
+  for (size_t i = 0; i < FrameRegistry::blockSize + 1; ++i) {
+    legMotions.emplace_back(LimbEnum::LF_LEG);
+    legMotions.back().setTrajectory({{ControlLevel::Position, "step_frame_" + std::to_string(i)}}, {0.0, 1.0},
+                                    {{ControlLevel::Position, {Position(0.0, 0.0, 0.0).vector(), Position(0.1, 0.0, 0.0).vector()}}});
+  }
+  for (size_t i = 0; i < legMotions.size(); ++i) {
+    EXPECT_NE(FrameRegistry::invalidFrameId, legMotions[i].getFrameHandle(ControlLevel::Position));
+    EXPECT_EQ("step_frame_" + std::to_string(i), legMotions[i].getFrameId(ControlLevel::Position));
+  }
+}
+
+TEST(legMotionVariant, dispatch)
+{
+  EndEffectorTrajectory endEffectorTrajectory(LimbEnum::LF_LEG);
+  endEffectorTrajectory.setTrajectory({{ControlLevel::Position, "odom"}}, {0.0, 1.0},
+                                      {{ControlLevel::Position, {Position(0.0, 0.0, 0.0).vector(), Position(0.2, 0.0, 0.1).vector()}}});
+  AdapterDummy adapter;
+  ASSERT_TRUE(endEffectorTrajectory.prepareComputation(State(), Step(), adapter));
+
+  const LegMotionVariant empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_FALSE(empty.isEndEffectorMotion());
+
+  const LegMotionVariant legMotion(endEffectorTrajectory);
+  EXPECT_EQ(LegMotionVariant::Type::EndEffectorTrajectory, legMotion.getType());
+  EXPECT_TRUE(legMotion.isEndEffectorMotion());
+  EXPECT_FALSE(legMotion.isJointMotion());
+  EXPECT_EQ(endEffectorTrajectory.getControlSetup(), legMotion.getControlSetup());
+  EXPECT_EQ(endEffectorTrajectory.getFrameHandle(ControlLevel::Position), legMotion.getFrameHandle(ControlLevel::Position));
+  for (const double time : {0.0, 0.3, 1.0}) {
+    EXPECT_TRUE(endEffectorTrajectory.evaluatePosition(time).vector().isApprox(legMotion.evaluatePosition(time).vector()));
+  }
+  EXPECT_THROW(legMotion.evaluateJointPositions(0.0), std::runtime_error);
+}
+
+TEST(stepCompleter, sampling)
+{
+  AdapterDummy adapter;
+  State state;
+  state.initialize(adapter.getLimbs(), adapter.getBranches());
+  state.setPoseBaseToWorld(Pose(Position(0.0, 0.0, 0.45), RotationQuaternion()));
+  for (const auto& limb : adapter.getLimbs()) {
+    state.setJointPositionsForLimb(limb, JointPositionsLeg(Eigen::Vector3d(0.0, 0.0, -0.45)));
+    state.setSupportLeg(limb, true);
+  }
+  adapter.setInternalDataFromState(state);
+
+  Footstep footstep(LimbEnum::LF_LEG);
+  footstep.setTargetPosition(adapter.getWorldFrameId(),
+                             adapter.getPositionWorldToFootInWorldFrame(LimbEnum::LF_LEG) + Position(0.1, 0.0, 0.0));
+  Step step;
+  step.addLegMotion(footstep);
+  step.addBaseMotion(BaseAuto());
+  StepQueue queue;
+  queue.add(step);
+
+  StepParameters parameters;
+  parameters.samplingParameters.timeStep = 0.01;
+  StepCompleter completer(parameters, adapter);
+  Step completedStep(queue.getCurrentStep());
+  ASSERT_TRUE(completer.complete(state, queue, completedStep));
+  EXPECT_EQ(0.01, completedStep.getLegMotion(LimbEnum::LF_LEG).getSamplingTimeStep());
+  EXPECT_EQ(0.01, completedStep.getBaseMotion().getSamplingTimeStep());
+
+  // The sampled base motion matches the curve.
+  std::unique_ptr<BaseMotionBase> baseMotion = completedStep.getBaseMotion().clone();
+  baseMotion->setSampling(0.0, SampleInterpolation::Cubic);
+  ASSERT_GT(baseMotion->getDuration(), 0.0);
+  for (double time = 0.0; time <= baseMotion->getDuration(); time += 0.007) {
+    Pose pose, sampledPose;
+    Twist twist, sampledTwist;
+    baseMotion->evaluate(time, pose, twist);
+    completedStep.getBaseMotion().evaluate(time, sampledPose, sampledTwist);
+    EXPECT_LT((pose.getPosition() - sampledPose.getPosition()).norm(), 1e-6);
+    EXPECT_LT(pose.getRotation().getDisparityAngle(sampledPose.getRotation()), 1e-6);
+    EXPECT_LT((twist.getTranslationalVelocity().vector() - sampledTwist.getTranslationalVelocity().vector()).norm(), 1e-4);
+    EXPECT_LT((twist.getRotationalVelocity().vector() - sampledTwist.getRotationalVelocity().vector()).norm(), 1e-3);
+  }
+}
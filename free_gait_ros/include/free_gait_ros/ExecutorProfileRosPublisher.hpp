@@ -0,0 +1,41 @@
+/*
+ * ExecutorProfileRosPublisher.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#pragma once
+
+// Free Gait
+#include <free_gait_core/free_gait_core.hpp>
+
+// ROS
+#include <ros/ros.h>
+#include <free_gait_msgs/ExecutorProfile.h>
+
+namespace free_gait {
+
+/*!
+ * Publishes the latency statistics of the executor (see ExecutorProfiler).
+ * Publishing reads the statistics without locking the executor and is
+ * meant to be called at a low rate from a non real-time thread.
+ */
+class ExecutorProfileRosPublisher
+{
+ public:
+  ExecutorProfileRosPublisher(ros::NodeHandle& nodeHandle);
+  virtual ~ExecutorProfileRosPublisher();
+
+  bool publish(const ExecutorProfiler& profiler);
+
+ private:
+  void addPhaseStatistics(const std::string& phase, const std::string& stepType,
+                          const LatencyHistogram::Statistics& statistics,
+                          free_gait_msgs::ExecutorProfile& message) const;
+
+  ros::NodeHandle& nodeHandle_;
+  ros::Publisher publisher_;
+};
+
+} /* namespace free_gait */
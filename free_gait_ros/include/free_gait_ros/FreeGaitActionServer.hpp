@@ -11,6 +11,7 @@
 // Free Gait
 #include "free_gait_core/free_gait_core.hpp"
 #include "free_gait_ros/StepRosConverter.hpp"
+#include "free_gait_ros/ExecutorProfileRosPublisher.hpp"
 
 // Quadruped model
 #include "quadruped_model/QuadrupedModel.hpp"
@@ -49,6 +50,13 @@ class FreeGaitActionServer
   void goalCallback();
   void preemptCallback();
   void publishFeedback();
+
+  /*!
+   * Publishes the latency statistics of the executor, at most once per
+   * profile period (parameter `/free_gait/executor_profile_period` [s]).
+   * Called by update().
+   */
+  void publishProfile();
   void setSucceeded();
   void setPreempted();
   void setAborted();
@@ -76,6 +84,20 @@ class FreeGaitActionServer
 
   //! Number of steps of the current goal.
   size_t nStepsInCurrentGoal_;
+
+  //! Number of commands to the executor pushed up to the current goal or preemption.
+  std::atomic<uint64_t> nPushedCommands_;
+
+  //! Reader of the executor snapshots.
+  std::unique_ptr<ExecutorSnapshotReader> snapshotReader_;
+
+  //! Sequence number of the last executor feedback event published.
+  uint64_t feedbackSequence_;
+
+  //! Publisher of the executor latency statistics.
+  ExecutorProfileRosPublisher profilePublisher_;
+  ros::WallDuration profilePeriod_;
+  ros::WallTime lastProfileTime_;
 };
 
 } /* namespace */
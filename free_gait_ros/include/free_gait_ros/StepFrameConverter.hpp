@@ -57,6 +57,14 @@ class StepFrameConverter
 
  private:
 
+  /*!
+   * Interns the target frame id of a conversion (see FrameRegistry).
+   * @param[in] frameId the frame id.
+   * @param[out] frameHandle the handle of the frame.
+   * @return true if successful, false if the frame could not be registered.
+   */
+  bool internFrameId(const std::string& frameId, FrameId& frameHandle) const;
+
   /// TF buffer used to read the transformations.
   /// Note: Needs to be updated from outside with
   /// a TF Listener!
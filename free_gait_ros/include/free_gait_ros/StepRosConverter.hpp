@@ -64,6 +64,14 @@ class StepRosConverter
   bool toMessage(const CustomCommand& customCommand, free_gait_msgs::CustomCommand& message);
 
  private:
+  /*!
+   * Interns the frame id of a message (see FrameRegistry).
+   * @param[in] frameId the frame id.
+   * @param[out] frameHandle the handle of the frame.
+   * @return true if successful, false if the frame could not be registered.
+   */
+  bool internFrameId(const std::string& frameId, FrameId& frameHandle) const;
+
   const AdapterBase& adapter_;
 };
 
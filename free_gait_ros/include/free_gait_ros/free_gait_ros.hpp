@@ -16,4 +16,5 @@
 #include "free_gait_ros/StepRosConverter.hpp"
 #include "free_gait_ros/StepFrameConverter.hpp"
 #include "free_gait_ros/StateRosPublisher.hpp"
+#include "free_gait_ros/ExecutorProfileRosPublisher.hpp"
 #include "free_gait_ros/RosVisualization.hpp"
@@ -0,0 +1,58 @@
+/*
+ * ExecutorProfileRosPublisher.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *   Institute: ETH Zurich, Robotic Systems Lab
+ */
+
+#include <free_gait_ros/ExecutorProfileRosPublisher.hpp>
+
+namespace free_gait {
+
+ExecutorProfileRosPublisher::ExecutorProfileRosPublisher(ros::NodeHandle& nodeHandle)
+    : nodeHandle_(nodeHandle)
+{
+  const std::string topic = nodeHandle_.param("/free_gait/executor_profile_topic", std::string("executor_profile"));
+  publisher_ = nodeHandle_.advertise<free_gait_msgs::ExecutorProfile>(topic, 1, false);
+}
+
+ExecutorProfileRosPublisher::~ExecutorProfileRosPublisher()
+{
+}
+
+bool ExecutorProfileRosPublisher::publish(const ExecutorProfiler& profiler)
+{
+  if (publisher_.getNumSubscribers() == 0) return true;
+
+  free_gait_msgs::ExecutorProfile message;
+  message.header.stamp = ros::Time::now();
+  for (size_t i = 0; i < ExecutorProfiler::nPhases; ++i) {
+    const auto phase = static_cast<ExecutorProfiler::Phase>(i);
+    const std::string& phaseName = ExecutorProfiler::getPhaseName(phase);
+    addPhaseStatistics(phaseName, "all", profiler.getStatistics(phase), message);
+    for (size_t j = 0; j < ExecutorProfiler::nStepTypes; ++j) {
+      const auto stepType = static_cast<ExecutorProfiler::StepType>(j);
+      addPhaseStatistics(phaseName, ExecutorProfiler::getStepTypeName(stepType),
+                         profiler.getStatistics(phase, stepType), message);
+    }
+  }
+  publisher_.publish(message);
+  return true;
+}
+
+void ExecutorProfileRosPublisher::addPhaseStatistics(const std::string& phase, const std::string& stepType,
+                                                     const LatencyHistogram::Statistics& statistics,
+                                                     free_gait_msgs::ExecutorProfile& message) const
+{
+  if (statistics.nSamples == 0) return;
+  free_gait_msgs::ExecutorPhaseStatistics phaseStatistics;
+  phaseStatistics.phase = phase;
+  phaseStatistics.step_type = stepType;
+  phaseStatistics.number_of_samples = statistics.nSamples;
+  phaseStatistics.median = ros::Duration(statistics.median);
+  phaseStatistics.percentile_99 = ros::Duration(statistics.percentile99);
+  phaseStatistics.max = ros::Duration(statistics.max);
+  message.phases.push_back(phaseStatistics);
+}
+
+} /* namespace free_gait */
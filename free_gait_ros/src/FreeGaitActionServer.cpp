@@ -14,6 +14,7 @@
 #include <free_gait_msgs/ExecuteStepsResult.h>
 
 #include <iostream>
+#include <sstream>
 
 namespace free_gait {
 
@@ -27,8 +28,14 @@ FreeGaitActionServer::FreeGaitActionServer(ros::NodeHandle nodeHandle, const std
       isInitializingNewGoal_(false),
       isPreempting_(false),
       isBlocked_(false),
-      nStepsInCurrentGoal_(0)
+      nStepsInCurrentGoal_(0),
+      nPushedCommands_(0),
+      snapshotReader_(executor.createSnapshotReader()),
+      feedbackSequence_(executor.getFeedback().getSequence()),
+      profilePublisher_(nodeHandle_),
+      profilePeriod_(nodeHandle_.param("/free_gait/executor_profile_period", 1.0))
 {
+  if (!snapshotReader_) throw std::runtime_error("FreeGaitActionServer: Could not create executor snapshot reader.");
 }
 
 FreeGaitActionServer::~FreeGaitActionServer()
@@ -60,10 +67,13 @@ void FreeGaitActionServer::start()
 
 void FreeGaitActionServer::update()
 {
+  publishProfile();
   if (!server_.isActive() || isBlocked_ || isInitializingNewGoal_) return;
-  Executor::Lock lock(executor_.getMutex());
-  bool stepQueueEmpty = executor_.getQueue().empty();
-  lock.unlock();
+  snapshotReader_->update();
+  const ExecutorSnapshot& snapshot = snapshotReader_->getSnapshot();
+  // Wait until the executor has processed the commands of the goal.
+  if (snapshot.nProcessedCommands < nPushedCommands_) return;
+  bool stepQueueEmpty = snapshot.queueSize == 0;
   if (stepQueueEmpty) {
     if (nStepsInCurrentGoal_ == 0 ) {
       //Server is awaiting, action is idle
@@ -76,12 +86,18 @@ void FreeGaitActionServer::update()
     }
   } else {
     // Ongoing.
-    lock.lock();
-    if (executor_.getQueue().active()) publishFeedback();
-    lock.unlock();
+    if (snapshot.isQueueActive) publishFeedback();
   }
 }
 
+void FreeGaitActionServer::publishProfile()
+{
+  const ros::WallTime now = ros::WallTime::now();
+  if (now - lastProfileTime_ < profilePeriod_) return;
+  lastProfileTime_ = now;
+  profilePublisher_.publish(executor_.getProfiler());
+}
+
 void FreeGaitActionServer::block()
 {
   isBlocked_ = true;
@@ -130,22 +146,8 @@ void FreeGaitActionServer::goalCallback()
     adapter_.fromMessage(stepMessage, step);
     steps.push_back(step);
   }
-  Executor::Lock lock(executor_.getMutex());
-
-  // Check if last step and first step of new goal are
-  // pure `BaseAuto` commands: In this case, replace the
-  // last one with the new one for smooth motion.
-  if (executor_.getQueue().size() >= 2) {
-    const auto& step = *executor_.getQueue().getQueue().end();
-    if (!step.hasLegMotion() && step.hasBaseMotion()) {
-      if (step.getBaseMotion().getType() == BaseMotionBase::Type::Auto) {
-        executor_.getQueue().clearLastNSteps(1);
-      }
-    }
-  }
-  executor_.getQueue().add(steps);
 
-  Executor::PreemptionType preemptionType;
+  Executor::PreemptionType preemptionType = Executor::PreemptionType::PREEMPT_STEP;
   switch (goal->preempt) {
     case free_gait_msgs::ExecuteStepsGoal::PREEMPT_IMMEDIATE:
         preemptionType = Executor::PreemptionType::PREEMPT_IMMEDIATE;
@@ -159,10 +161,22 @@ void FreeGaitActionServer::goalCallback()
     default:
       break;
   }
-  executor_.setPreemptionType(preemptionType);
+
+  // Check if last step and first step of new goal are
+  // pure `BaseAuto` commands: In this case, replace the
+  // last one with the new one for smooth motion.
+  // The executor processes the commands at its next advance.
+  ExecutorCommandQueue& commandQueue = executor_.getCommandQueue();
+  if (!commandQueue.push(ExecutorCommand::addSteps(steps, true))
+      || !commandQueue.push(ExecutorCommand::setPreemptionType(preemptionType))) {
+    ROS_ERROR("Executor command queue is full, goal is aborted.");
+    isInitializingNewGoal_ = false;
+    setAborted();
+    return;
+  }
+  nPushedCommands_ = commandQueue.getNumberOfPushedCommands();
   nStepsInCurrentGoal_ = goal->steps.size();
   isPreempting_ = false;
-  lock.unlock();
   isInitializingNewGoal_ = false;
 }
 
@@ -173,23 +187,26 @@ void FreeGaitActionServer::preemptCallback()
     ROS_WARN("StepAction cannot be preempted, server is blocked!");
     return;
   }
-  Executor::Lock lock(executor_.getMutex());
-  executor_.stop();
+  if (!executor_.getCommandQueue().push(ExecutorCommand::stop())) {
+    ROS_ERROR("Executor command queue is full, StepAction cannot be preempted.");
+    return;
+  }
+  nPushedCommands_ = executor_.getCommandQueue().getNumberOfPushedCommands();
   isPreempting_ = true;
 }
 
 void FreeGaitActionServer::publishFeedback()
 {
   free_gait_msgs::ExecuteStepsFeedback feedback;
-  Executor::Lock lock(executor_.getMutex());
-  if (executor_.getQueue().empty()) return;
-  feedback.step_id = executor_.getState().getStepId();
-  feedback.queue_size = executor_.getQueue().size();
+  const ExecutorSnapshot& snapshot = snapshotReader_->getSnapshot();
+  if (snapshot.queueSize == 0) return;
+  feedback.step_id = snapshot.stepId;
+  feedback.queue_size = snapshot.queueSize;
   feedback.number_of_steps_in_goal = nStepsInCurrentGoal_;
   feedback.step_number = feedback.number_of_steps_in_goal - feedback.queue_size + 1;
 
-  if (executor_.getState().getRobotExecutionStatus() == false
-      || executor_.getQueue().active() == false) {
+  if (snapshot.robotExecutionStatus == false
+      || snapshot.isQueueActive == false) {
     feedback.status = free_gait_msgs::ExecuteStepsFeedback::PROGRESS_PAUSED;
   } else {
       feedback.status = free_gait_msgs::ExecuteStepsFeedback::PROGRESS_EXECUTING;
@@ -199,23 +216,33 @@ void FreeGaitActionServer::publishFeedback()
 //        break;
   }
 
-  feedback.description = executor_.getFeedbackDescription();
-  executor_.clearFeedbackDescription();
+  // Format the feedback events added since the last feedback.
+  std::ostringstream description;
+  ExecutorFeedbackEvent event;
+  uint64_t nDropped = 0;
+  const char* separator = "";
+  while (executor_.getFeedback().read(feedbackSequence_, event, nDropped)) {
+    if (nDropped > 0) {
+      description << separator << "(" << nDropped << " feedback events have been dropped.)";
+      separator = "\n\n--------\n\n";
+    }
+    description << separator << event;
+    separator = "\n\n--------\n\n";
+  }
+  feedback.description = description.str();
 
-  if (executor_.getQueue().active()) {
-    const auto& step = executor_.getQueue().getCurrentStep();
-    feedback.duration = ros::Duration(step.getTotalDuration());
-    feedback.phase = step.getTotalPhase();
-    for (const auto& legMotion : step.getLegMotions()) {
-      const std::string legName(executor_.getAdapter().getLimbStringFromLimbEnum(legMotion.first));
-      feedback.active_branches.push_back(legName);
+  if (snapshot.isQueueActive) {
+    feedback.duration = ros::Duration(snapshot.stepDuration);
+    feedback.phase = snapshot.stepPhase;
+    for (const auto& limb : executor_.getAdapter().getLimbs()) {
+      if (!snapshot.activeLimbs.test(getIndex(limb))) continue;
+      feedback.active_branches.push_back(executor_.getAdapter().getLimbStringFromLimbEnum(limb));
     }
-    if (step.hasBaseMotion()) {
+    if (snapshot.isBaseActive) {
       feedback.active_branches.push_back(executor_.getAdapter().getBaseString());
     }
   }
 
-  lock.unlock();
   server_.publishFeedback(feedback);
 }
 
@@ -80,10 +80,10 @@ bool StepFrameConverter::adaptCoordinates(Footstep& footstep, const std::string&
                                           const ros::Time& time)
 {
   Transform transform;
-  if (footstep.getFrameId(ControlLevel::Position) == sourceFrameId) {
+  if (footstep.getFrameHandle(ControlLevel::Position) == FrameRegistry::getInstance().find(sourceFrameId)) {
     if (!getTransform(sourceFrameId, targetFrameId, transformInSourceFrame, time, transform)) return false;
+    if (!internFrameId(targetFrameId, footstep.frameId_)) return false;
     footstep.target_ = transform.transform(footstep.target_);
-    footstep.frameId_ = targetFrameId;
   }
 
   return true;
@@ -95,12 +95,12 @@ bool StepFrameConverter::adaptCoordinates(EndEffectorTrajectory& endEffectorTraj
                                           const ros::Time& time)
 {
   Transform transform;
-  if (endEffectorTrajectory.getFrameId(ControlLevel::Position) == sourceFrameId) {
+  if (endEffectorTrajectory.getFrameHandle(ControlLevel::Position) == FrameRegistry::getInstance().find(sourceFrameId)) {
     if (!getTransform(sourceFrameId, targetFrameId, transformInSourceFrame, time, transform)) return false;
+    if (!internFrameId(targetFrameId, endEffectorTrajectory.frameIds_[ControlLevel::Position])) return false;
     for (auto& knot : endEffectorTrajectory.values_.at(ControlLevel::Position)){
       knot = (transform.transform(Position(knot))).vector();
     }
-    endEffectorTrajectory.frameIds_.at(ControlLevel::Position) = targetFrameId;
   }
 
   return true;
@@ -112,18 +112,29 @@ bool StepFrameConverter::adaptCoordinates(BaseTrajectory& baseTrajectory, const
                                           const ros::Time& time)
 {
   Transform transform;
-  if (baseTrajectory.getFrameId(ControlLevel::Position) == sourceFrameId) {
+  if (baseTrajectory.getFrameHandle(ControlLevel::Position) == FrameRegistry::getInstance().find(sourceFrameId)) {
     if (!getTransform(sourceFrameId, targetFrameId, transformInSourceFrame, time, transform)) return false;
+    if (!internFrameId(targetFrameId, baseTrajectory.frameIds_[ControlLevel::Position])) return false;
     for (auto& knot : baseTrajectory.values_.at(ControlLevel::Position)){
       knot.getPosition() = transform.transform(knot.getPosition());
       knot.getRotation() = transform.getRotation()*knot.getRotation();
     }
-    baseTrajectory.frameIds_.at(ControlLevel::Position) = targetFrameId;
   }
 
   return true;
 }
 
+bool StepFrameConverter::internFrameId(const std::string& frameId, FrameId& frameHandle) const
+{
+  try {
+    frameHandle = FrameRegistry::getInstance().internOrThrow(frameId);
+  } catch (const std::runtime_error& exception) {
+    ROS_ERROR("StepFrameConverter: Could not adapt coordinates: %s", exception.what());
+    return false;
+  }
+  return true;
+}
+
 bool StepFrameConverter::getTransform(const std::string& sourceFrameId,
                                       const std::string& targetFrameId,
                                       const Transform& transformInSourceFrame,
@@ -25,6 +25,17 @@ StepRosConverter::~StepRosConverter()
 {
 }
 
+bool StepRosConverter::internFrameId(const std::string& frameId, FrameId& frameHandle) const
+{
+  try {
+    frameHandle = FrameRegistry::getInstance().internOrThrow(frameId);
+  } catch (const std::runtime_error& exception) {
+    std::cerr << "StepRosConverter: Could not read from ROS message: " << exception.what() << std::endl;
+    return false;
+  }
+  return true;
+}
+
 bool StepRosConverter::fromMessage(const std::vector<free_gait_msgs::Step>& message, std::vector<free_gait::Step>& steps)
 {
   steps.resize(message.size());
@@ -113,7 +124,7 @@ bool StepRosConverter::fromMessage(const free_gait_msgs::Footstep& message,
   footstep.limb_ = adapter_.getLimbEnumFromLimbString(message.name);
 
   // Target.
-  footstep.frameId_ = message.target.header.frame_id;
+  if (!internFrameId(message.target.header.frame_id, footstep.frameId_)) return false;
   Position target;
   kindr_ros::convertFromRosGeometryMsg(message.target.point, target);
   footstep.target_ = target;
@@ -148,7 +159,9 @@ bool StepRosConverter::fromMessage(const free_gait_msgs::EndEffectorTarget& mess
   // Target position.
   endEffectorTarget.controlSetup_[ControlLevel::Position] = !message.target_position.empty();
   if (endEffectorTarget.controlSetup_[ControlLevel::Position]) {
-    endEffectorTarget.frameIds_[ControlLevel::Position] = message.target_position[0].header.frame_id;
+    if (!internFrameId(message.target_position[0].header.frame_id, endEffectorTarget.frameIds_[ControlLevel::Position])) {
+      return false;
+    }
     Position targetPosition;
     kindr_ros::convertFromRosGeometryMsg(message.target_position[0].point, targetPosition);
     endEffectorTarget.targetPosition_ = targetPosition;
@@ -157,7 +170,9 @@ bool StepRosConverter::fromMessage(const free_gait_msgs::EndEffectorTarget& mess
   // Target velocity.
   endEffectorTarget.controlSetup_[ControlLevel::Velocity] = !message.target_velocity.empty();
   if (endEffectorTarget.controlSetup_[ControlLevel::Velocity]) {
-    endEffectorTarget.frameIds_[ControlLevel::Velocity] = message.target_velocity[0].header.frame_id;
+    if (!internFrameId(message.target_velocity[0].header.frame_id, endEffectorTarget.frameIds_[ControlLevel::Velocity])) {
+      return false;
+    }
     LinearVelocity targetVelocity;
     kindr_ros::convertFromRosGeometryMsg(message.target_velocity[0].vector, targetVelocity);
     endEffectorTarget.targetVelocity_ = targetVelocity;
@@ -191,7 +206,7 @@ bool StepRosConverter::fromMessage(const free_gait_msgs::EndEffectorTrajectory&
   endEffectorTrajectory.limb_ = adapter_.getLimbEnumFromLimbString(message.name);
 
   // Trajectory.
-  endEffectorTrajectory.frameIds_[ControlLevel::Position] = message.trajectory.header.frame_id;
+  if (!internFrameId(message.trajectory.header.frame_id, endEffectorTrajectory.frameIds_[ControlLevel::Position])) return false;
 
   for (const auto& point : message.trajectory.points) {
     if (!point.transforms.empty()) endEffectorTrajectory.controlSetup_[ControlLevel::Position] = true;
@@ -352,7 +367,7 @@ bool StepRosConverter::fromMessage(const free_gait_msgs::BaseTarget& message,
                                    BaseTarget& baseTarget)
 {
   // Target.
-  baseTarget.frameId_ = message.target.header.frame_id;
+  if (!internFrameId(message.target.header.frame_id, baseTarget.frameId_)) return false;
   Pose target;
   kindr_ros::convertFromRosGeometryMsg(message.target.pose, target);
   baseTarget.target_ = target;
@@ -367,7 +382,7 @@ bool StepRosConverter::fromMessage(const free_gait_msgs::BaseTrajectory& message
                                    BaseTrajectory& baseTrajectory)
 {
   // Trajectory.
-  baseTrajectory.frameIds_[ControlLevel::Position] = message.trajectory.header.frame_id;
+  if (!internFrameId(message.trajectory.header.frame_id, baseTrajectory.frameIds_[ControlLevel::Position])) return false;
 
   // We assume there is only one multi dof joint (for the base) in the message.
 //  size_t nJoints = message.trajectory.joint_names.size();
@@ -516,7 +531,7 @@ bool StepRosConverter::toMessage(const Footstep& footstep, free_gait_msgs::Foots
   message.name = adapter_.getLimbStringFromLimbEnum(footstep.limb_);
 
   // Target.
-  message.target.header.frame_id = footstep.frameId_;
+  message.target.header.frame_id = footstep.getFrameId(ControlLevel::Position);
   kindr_ros::convertToRosGeometryMsg(footstep.target_, message.target.point);
 
   // Profile.
@@ -546,7 +561,7 @@ bool StepRosConverter::toMessage(const EndEffectorTrajectory& endEffectorTraject
   message.name = adapter_.getLimbStringFromLimbEnum(endEffectorTrajectory.limb_);
 
   // Trajectory.
-  message.trajectory.header.frame_id = endEffectorTrajectory.frameIds_.at(ControlLevel::Position);
+  message.trajectory.header.frame_id = endEffectorTrajectory.getFrameId(ControlLevel::Position);
   message.trajectory.points.resize(endEffectorTrajectory.times_.size());
   size_t i = 0;
   for (auto& point : message.trajectory.points) {
@@ -632,7 +647,7 @@ bool StepRosConverter::toMessage(const BaseAuto& baseAuto, free_gait_msgs::BaseA
 
 bool StepRosConverter::toMessage(const BaseTrajectory& baseTrajectory, free_gait_msgs::BaseTrajectory& message)
 {
-  message.trajectory.header.frame_id = baseTrajectory.frameIds_.at(ControlLevel::Position);
+  message.trajectory.header.frame_id = baseTrajectory.getFrameId(ControlLevel::Position);
   message.trajectory.points.resize(baseTrajectory.values_.at(ControlLevel::Position).size());
   size_t i = 0;
   for (auto& point : message.trajectory.points) {
@@ -100,6 +100,8 @@ Q_OBJECT
   free_gait::AdapterRos adapterRos_;
 
   FreeGaitPreviewPlayback playback_;
+  //! Copy of the state batch of the playback shown by the visual.
+  free_gait::StateBatch stateBatch_;
   FreeGaitPreviewVisual* visual_;
   free_gait::StepRosConverter stepRosConverter_;
   free_gait_msgs::ExecuteStepsActionFeedback feedbackMessage_;
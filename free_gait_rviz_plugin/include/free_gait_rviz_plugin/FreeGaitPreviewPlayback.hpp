@@ -20,6 +20,7 @@
 #include <memory>
 #include <functional>
 #include <mutex>
+#include <atomic>
 
 namespace free_gait_rviz_plugin {
 
@@ -52,7 +53,11 @@ class FreeGaitPreviewPlayback
   void goToTime(const ros::Time& time);
   void clear();
 
-  const free_gait::StateBatch& getStateBatch() const;
+  /*!
+   * Returns a copy of the state batch, as chunks of a running request are
+   * appended to it concurrently.
+   */
+  free_gait::StateBatch getStateBatch() const;
   const ros::Time& getTime() const;
   void update(double timeStep);
   void setSpeedFactor(const double speedFactor);
@@ -62,6 +67,7 @@ class FreeGaitPreviewPlayback
 
  private:
   void processingCallback(bool success);
+  void chunkCallback(const free_gait::StateBatchStream::Chunk& chunk);
   void publish(const ros::Time& time);
 
   ros::NodeHandle& nodeHandle_;
@@ -75,12 +81,15 @@ class FreeGaitPreviewPlayback
   std::unique_ptr<free_gait::StepComputer> computer_;
   std::unique_ptr<free_gait::Executor> executor_;
   free_gait::StateBatch stateBatch_;
-  free_gait::StateBatchComputer stateBatchComputer_;
-  std::recursive_mutex dataMutex_;
+  mutable std::recursive_mutex dataMutex_;
   free_gait::StateRosPublisher stateRosPublisher_;
   PlayMode playMode_;
   ros::Time time_;
   double speedFactor_;
+
+  //! Simulated duration of the parts of the preview shown while processing [s].
+  static constexpr double chunkDuration_ = 0.5;
+  std::atomic<size_t> nReceivedChunks_;
 };
 
 } /* namespace free_gait_rviz_plugin */
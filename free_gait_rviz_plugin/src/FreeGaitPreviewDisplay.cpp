@@ -313,7 +313,8 @@ void FreeGaitPreviewDisplay::newGoalAvailable()
 
   // Auto-enable visuals.
   ROS_DEBUG("FreeGaitPreviewDisplay::newGoalAvailable: Drawing visualizations.");
-  visual_->setStateBatch(playback_.getStateBatch());
+  stateBatch_ = playback_.getStateBatch();
+  visual_->setStateBatch(stateBatch_);
   if (autoEnableVisualsProperty_->getBool()) {
     setEnabledRobotModel(true);
     visualsTree_->setBool(true);
@@ -324,10 +325,10 @@ void FreeGaitPreviewDisplay::newGoalAvailable()
   // Playback.
   ROS_DEBUG("FreeGaitPreviewDisplay::newGoalAvailable: Setting up control.");
   playButtonProperty_->setReadOnly(false);
-  const double midTime = (playback_.getStateBatch().getEndTime() - playback_.getStateBatch().getStartTime()) / 2.0;
+  const double midTime = (stateBatch_.getEndTime() - stateBatch_.getStartTime()) / 2.0;
   timelimeSliderProperty_->setValuePassive(midTime); // This is required for not triggering value change signal.
-  timelimeSliderProperty_->setMin(playback_.getStateBatch().getStartTime());
-  timelimeSliderProperty_->setMax(playback_.getStateBatch().getEndTime());
+  timelimeSliderProperty_->setMin(stateBatch_.getStartTime());
+  timelimeSliderProperty_->setMax(stateBatch_.getEndTime());
   timelimeSliderProperty_->setValuePassive(playback_.getTime().toSec());
   timelimeSliderProperty_->setReadOnly(false);
   ROS_DEBUG_STREAM("Setting slider min and max time to: " << timelimeSliderProperty_->getMin()
@@ -463,9 +464,10 @@ void FreeGaitPreviewDisplay::processMessage(const free_gait_msgs::ExecuteStepsAc
     adapterRos_.updateAdapterWithState();
   } else if (startStateMethodProperty_->getOptionInt() == StartStateMethod::ContinuePreviewedState) {
       double time;
-      bool success = playback_.getStateBatch().getEndTimeOfStep(feedbackMessage_.feedback.step_id, time);
+      const free_gait::StateBatch stateBatch = playback_.getStateBatch();
+      bool success = stateBatch.getEndTimeOfStep(feedbackMessage_.feedback.step_id, time);
       if (success) {
-        adapterRos_.getAdapter().setInternalDataFromState(playback_.getStateBatch().getState(time));
+        adapterRos_.getAdapter().setInternalDataFromState(stateBatch.getState(time));
       } else {
         ROS_DEBUG("FreeGaitPreviewDisplay::processMessage: No corresponding step found, resetting real state.");
         adapterRos_.updateAdapterWithState();
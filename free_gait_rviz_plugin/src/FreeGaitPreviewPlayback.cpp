@@ -19,9 +19,9 @@ FreeGaitPreviewPlayback::FreeGaitPreviewPlayback(ros::NodeHandle& nodeHandle,
     : nodeHandle_(nodeHandle),
       playMode_(PlayMode::ONHOLD),
       time_(0.0),
-      stateBatchComputer_(adapter),
       stateRosPublisher_(nodeHandle, adapter),
-      speedFactor_(1.0)
+      speedFactor_(1.0),
+      nReceivedChunks_(0)
 {
   executorState_.reset(new State());
 
@@ -33,12 +33,19 @@ FreeGaitPreviewPlayback::FreeGaitPreviewPlayback(ros::NodeHandle& nodeHandle,
   executor_->initialize();
 
   batchExecutor_.reset(new BatchExecutor(*executor_));
+  batchExecutor_->setComputeDerivedData(true);
+  batchExecutor_->setStreaming(true, chunkDuration_);
   batchExecutor_->addProcessingCallback(
       std::bind(&FreeGaitPreviewPlayback::processingCallback, this, std::placeholders::_1));
+  batchExecutor_->addChunkCallback(
+      std::bind(&FreeGaitPreviewPlayback::chunkCallback, this, std::placeholders::_1));
 }
 
 FreeGaitPreviewPlayback::~FreeGaitPreviewPlayback()
 {
+  // Join the worker of the batch executor first, it uses the executor and
+  // calls back into the playback.
+  batchExecutor_.reset();
 }
 
 void FreeGaitPreviewPlayback::addNewGoalCallback(std::function<void()> callback)
@@ -88,8 +95,9 @@ void FreeGaitPreviewPlayback::clear()
   stateBatch_.clear();
 }
 
-const free_gait::StateBatch& FreeGaitPreviewPlayback::getStateBatch() const
+free_gait::StateBatch FreeGaitPreviewPlayback::getStateBatch() const
 {
+  Lock lock(dataMutex_);
   return stateBatch_;
 }
 
@@ -124,7 +132,11 @@ void FreeGaitPreviewPlayback::update(double timeStep)
     case PlayMode::FORWARD: {
       Lock lock(dataMutex_);
       time_ += ros::Duration(speedFactor_ * timeStep);
-      if (time_ > ros::Time(stateBatch_.getEndTime())) {
+      if (time_ > ros::Time(stateBatch_.getEndTime()) && batchExecutor_->isProcessing()) {
+        // Wait for the next chunk.
+        time_ = ros::Time(stateBatch_.getEndTime());
+        publish(time_);
+      } else if (time_ > ros::Time(stateBatch_.getEndTime())) {
         stop();
         reachedEndCallback_();
       } else {
@@ -146,15 +158,33 @@ void FreeGaitPreviewPlayback::update(double timeStep)
 
 void FreeGaitPreviewPlayback::processingCallback(bool success)
 {
-  ROS_DEBUG("FreeGaitPreviewPlayback::processingCallback: Finished processing new goal, copying new data.");
+  ROS_DEBUG("FreeGaitPreviewPlayback::processingCallback: Finished processing new goal, moving new data.");
+  Lock lock(dataMutex_);
+  const size_t nReceivedChunks = nReceivedChunks_;
+  nReceivedChunks_ = 0; // Chunks of the next request.
   if (!success) return;
+  if (nReceivedChunks == 0) clear();
+  stateBatch_ = batchExecutor_->takeStateBatch(); // Derived data computed by the batch executor.
+  if (stateBatch_.empty()) return;
+  if (nReceivedChunks == 0) {
+    time_.fromSec(stateBatch_.getStartTime());
+    ROS_DEBUG_STREAM("Resetting time to " << time_ << ".");
+  }
+  newGoalCallback_();
+}
+
+void FreeGaitPreviewPlayback::chunkCallback(const free_gait::StateBatchStream::Chunk& chunk)
+{
   Lock lock(dataMutex_);
+  if (nReceivedChunks_++ > 0) {
+    stateBatch_.append(*chunk, 0.0);
+    return;
+  }
+
+  // Show the first part of the preview while the rest is simulated.
+  ROS_DEBUG("FreeGaitPreviewPlayback::chunkCallback: Received first part of new goal.");
   clear();
-  stateBatch_ = batchExecutor_->getStateBatch(); // Deep copy.
-  stateBatchComputer_.computeEndEffectorTrajectories(stateBatch_);
-  stateBatchComputer_.computeEndEffectorTargetsAndSurfaceNormals(stateBatch_);
-  stateBatchComputer_.computeStances(stateBatch_);
-  stateBatchComputer_.computeStepIds(stateBatch_);
+  stateBatch_.append(*chunk, 0.0);
   time_.fromSec(stateBatch_.getStartTime());
   ROS_DEBUG_STREAM("Resetting time to " << time_ << ".");
   newGoalCallback_();
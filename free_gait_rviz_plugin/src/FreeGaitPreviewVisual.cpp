@@ -198,7 +198,7 @@ void FreeGaitPreviewVisual::showEndEffectorTrajectories(const float width, const
 
   // Define size.
   const size_t nEndEffectors(positions.size());
-  const size_t nStates(stateBatchPtr_->getStates().size());
+  const size_t nStates(stateBatchPtr_->size());
 
   // Cleanup.
   if (endEffectorTrajectories_.size() != nEndEffectors) {